@@ -28,6 +28,7 @@
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Common/Macros.hpp>
+#include <Reaktoro/Common/MappedFile.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/Meta.hpp>
@@ -41,7 +42,9 @@
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Table.hpp>
 #include <Reaktoro/Common/TableUtils.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Common/Types.hpp>
@@ -26,6 +26,7 @@ void exportStringList(py::module& m);
 void exportStringUtils(py::module& m);
 void exportTable(py::module& m);
 void exportTimeUtils(py::module& m);
+void exportTracing(py::module& m);
 void exportTypes(py::module& m);
 void exportUnits(py::module& m);
 void exportWarnings(py::module& m);
@@ -40,6 +41,7 @@ void exportCommon(py::module& m)
     exportStringUtils(m);
     exportTable(m);
     exportTimeUtils(m);
+    exportTracing(m);
     exportTypes(m);
     exportUnits(m);
     exportWarnings(m);
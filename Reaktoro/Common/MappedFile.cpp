@@ -0,0 +1,118 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "MappedFile.hpp"
+
+// C++ includes
+#include <fstream>
+
+// POSIX includes
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Reaktoro {
+
+struct MappedFile::Impl
+{
+    /// The contents of the file.
+    Chars bytes = nullptr;
+
+    /// The number of bytes in the file.
+    Index length = 0;
+
+    /// The flag indicating whether the file was opened.
+    bool opened = false;
+
+#if defined(_WIN32)
+    /// The buffer with the contents of the file.
+    String buffer;
+#else
+    /// The file descriptor of the file.
+    int fd = -1;
+
+    /// The address of the memory mapping of the file (null if the file is empty).
+    void* mapped = nullptr;
+#endif
+
+    Impl(String const& path)
+    {
+#if defined(_WIN32)
+        std::ifstream file(path, std::ios::binary);
+        if(!file)
+            return;
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        bytes = buffer.data();
+        length = buffer.size();
+        opened = true;
+#else
+        fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return;
+        struct stat info;
+        if(::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+            return;
+        length = info.st_size;
+        opened = true;
+        if(length == 0)
+            return;
+        void* ptr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(ptr == MAP_FAILED)
+        {
+            opened = false;
+            return;
+        }
+        mapped = ptr;
+        bytes = static_cast<Chars>(ptr);
+#endif
+    }
+
+    ~Impl()
+    {
+#if !defined(_WIN32)
+        if(mapped) ::munmap(mapped, length);
+        if(fd >= 0) ::close(fd);
+#endif
+    }
+};
+
+MappedFile::MappedFile(String const& path)
+: pimpl(new Impl(path))
+{}
+
+MappedFile::~MappedFile()
+{}
+
+auto MappedFile::isOpen() const -> bool
+{
+    return pimpl->opened;
+}
+
+auto MappedFile::data() const -> Chars
+{
+    return pimpl->bytes;
+}
+
+auto MappedFile::size() const -> Index
+{
+    return pimpl->length;
+}
+
+} // namespace Reaktoro
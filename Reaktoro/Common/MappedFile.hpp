@@ -0,0 +1,58 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to map the contents of a file into memory for reading.
+/// The file is memory-mapped on POSIX systems and read into a buffer elsewhere. As with `std::ifstream`,
+/// a file that cannot be opened does not raise an error on construction, so check @ref isOpen before use.
+class MappedFile
+{
+public:
+    /// Construct a MappedFile object with the contents of the file at a given path.
+    explicit MappedFile(String const& path);
+
+    /// Construct a copy of a MappedFile object [deleted].
+    MappedFile(MappedFile const&) = delete;
+
+    /// Destroy this MappedFile object, unmapping and closing its file.
+    ~MappedFile();
+
+    /// Assign a MappedFile object to this [deleted].
+    auto operator=(MappedFile const&) -> MappedFile& = delete;
+
+    /// Return true if the file was opened and its contents are available.
+    auto isOpen() const -> bool;
+
+    /// Return the contents of the file.
+    auto data() const -> Chars;
+
+    /// Return the number of bytes in the file.
+    auto size() const -> Index;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,63 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/MappedFile.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing MappedFile", "[MappedFile]")
+{
+    const auto path = "temporary-mapped-file.bin";
+
+    const String contents("Reaktoro\0mapped file", 20);
+
+    std::ofstream(path, std::ios::binary) << contents;
+
+    {
+        MappedFile file(path);
+
+        REQUIRE( file.isOpen() );
+        CHECK( file.size() == contents.size() );
+        CHECK( std::memcmp(file.data(), contents.data(), contents.size()) == 0 );
+    }
+
+    // An empty file is opened, but it has no contents
+    std::ofstream(path, std::ios::binary | std::ios::trunc);
+
+    {
+        MappedFile file(path);
+
+        CHECK( file.isOpen() );
+        CHECK( file.size() == 0 );
+    }
+
+    std::remove(path);
+
+    // A file that does not exist is not opened
+    MappedFile file(path);
+
+    CHECK_FALSE( file.isOpen() );
+    CHECK( file.size() == 0 );
+}
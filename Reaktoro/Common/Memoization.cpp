@@ -18,22 +18,80 @@
 #include "Memoization.hpp"
 
 namespace Reaktoro {
+namespace detail {
+namespace {
 
-auto getMemoizationStatus() -> bool&
+/// The registry of the cache slot indices currently assigned to threads.
+struct MemoizationSlotRegistry
+{
+    /// The mutex guarding the assignment and release of slot indices.
+    std::mutex mutex;
+
+    /// The slot indices released by threads that have exited.
+    Vec<Index> released;
+
+    /// The number of slot indices created so far.
+    Index count = 0;
+};
+
+/// Return the registry of slot indices (never destroyed, since threads may exit after static destruction).
+auto memoizationSlotRegistry() -> MemoizationSlotRegistry&
+{
+    static auto registry = new MemoizationSlotRegistry();
+    return *registry;
+}
+
+/// The owner of the cache slot index of a thread, releasing it when the thread exits.
+struct MemoizationSlotOwner
+{
+    Index index;
+
+    MemoizationSlotOwner()
+    {
+        auto& registry = memoizationSlotRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        if(registry.released.empty())
+            index = registry.count++;
+        else
+        {
+            index = registry.released.back();
+            registry.released.pop_back();
+        }
+    }
+
+    ~MemoizationSlotOwner()
+    {
+        auto& registry = memoizationSlotRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.released.push_back(index);
+    }
+};
+
+} // namespace
+
+auto memoizationThreadSlot() -> Index
+{
+    thread_local MemoizationSlotOwner owner;
+    return owner.index;
+}
+
+} // namespace detail
+
+auto getMemoizationStatus() -> std::atomic<bool>&
 {
     /// The global variable that holds status if memoization is currently enabled or disabled.
-    static bool memoization_active = true;
+    static std::atomic<bool> memoization_active{true};
     return memoization_active;
 }
 
 auto Memoization::isEnabled() -> bool
 {
-    return getMemoizationStatus();
+    return getMemoizationStatus().load(std::memory_order_relaxed);
 }
 
 auto Memoization::isDisabled() -> bool
 {
-    return !getMemoizationStatus();
+    return !getMemoizationStatus().load(std::memory_order_relaxed);
 }
 
 auto Memoization::enable() -> void
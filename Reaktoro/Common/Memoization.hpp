@@ -17,6 +17,12 @@
 
 #pragma once
 
+// C++ includes
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Meta.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
@@ -117,9 +123,86 @@ auto assignValues(Tuple1& tuple1, const Tuple2& tuple2)
 template<typename T>
 using CacheType = typename MemoizationTraits<Decay<T>>::CacheType;
 
+/// The maximum number of threads with their own caches in a memoized function.
+/// Threads beyond this number evaluate memoized functions without memoization.
+constexpr Index memoization_max_threads = 64;
+
+/// Return the index of the cache slot of the calling thread in memoized functions.
+/// The index is assigned on first use and released when the thread exits, so
+/// that it can be reused by another thread and indices remain small.
+auto memoizationThreadSlot() -> Index;
+
+/// Used to store the caches of a memoized function in one slot per thread.
+/// This allows memoized functions, and thus the models of a chemical system
+/// using them, to be evaluated concurrently by several threads. Each thread
+/// has its own cache and its own copy of the memoized function, so that any
+/// internal state of the function (e.g., workspace captured by a mutable
+/// lambda) is not shared among threads. A slot is allocated the first time its
+/// thread uses it, and type `Cache` must have a data member `fn` of type `Fun`.
+template<typename Cache, typename Fun>
+class MemoizationSlots
+{
+public:
+    /// Construct a MemoizationSlots object with given function to be memoized.
+    explicit MemoizationSlots(Fun const& f)
+    : f(f)
+    {
+        for(auto& slot : slots)
+            slot.store(nullptr, std::memory_order_relaxed);
+    }
+
+    /// Deleted copy constructor (the slots are shared by copies of a memoized function instead).
+    MemoizationSlots(MemoizationSlots const&) = delete;
+
+    /// Destroy this MemoizationSlots object.
+    ~MemoizationSlots()
+    {
+        for(auto& slot : slots)
+            delete slot.load(std::memory_order_relaxed);
+    }
+
+    /// Return the cache of the calling thread or `nullptr` if the thread has no slot.
+    auto get() -> Cache*
+    {
+        const auto i = memoizationThreadSlot();
+        if(i >= memoization_max_threads)
+            return nullptr;
+        // Only the thread currently owning slot index `i` ever writes slot `i`
+        auto cache = slots[i].load(std::memory_order_acquire);
+        if(cache == nullptr)
+        {
+            cache = new Cache();
+            cache->fn = f;
+            slots[i].store(cache, std::memory_order_release);
+        }
+        return cache;
+    }
+
+    /// Evaluate the memoized function for a thread without a slot (serialized, since the function may have internal state).
+    template<typename... Args>
+    auto evaluate(Args&&... args)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return f(std::forward<Args>(args)...);
+    }
+
+private:
+    /// The function being memoized, copied into the slots and never evaluated by threads with a slot.
+    const Fun f;
+
+    /// The mutex serializing the evaluations of the memoized function by threads without a slot.
+    std::mutex mutex;
+
+    /// The caches of the threads indexed by their slot indices.
+    Array<std::atomic<Cache*>, memoization_max_threads> slots;
+};
+
 } // namespace detail
 
 /// The class used to control memoization in the application.
+/// Memoized functions keep a separate cache for each thread using them, so
+/// that they can be called concurrently (e.g., a single chemical system used
+/// by equilibrium solvers running in several threads).
 class Memoization
 {
 public:
@@ -140,18 +223,38 @@ public:
 };
 
 /// Return a memoized version of given function `f`.
+/// The cached results are shared among the threads calling the memoized function.
 template<typename Ret, typename... Args>
 auto memoize(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    auto cache = std::make_shared<Map<Tuple<Args...>, Ret>>();
-    return [=](Args... args) mutable -> Ret
+    struct Cache
+    {
+        Fn<Ret(Args...)> fn;
+    };
+    struct Results
+    {
+        std::shared_mutex mutex;
+        std::map<Tuple<Args...>, Ret> values; // an ordered map, since std::hash is not defined for tuples
+    };
+    auto slots = std::make_shared<detail::MemoizationSlots<Cache, Fn<Ret(Args...)>>>(f);
+    auto results = std::make_shared<Results>();
+    return [=](Args... args) -> Ret
     {
+        auto cache = slots->get();
+        if(cache == nullptr)
+            return slots->evaluate(args...);
         if(Memoization::isDisabled())
-            return f(args...);
+            return cache->fn(args...);
         Tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        {
+            std::shared_lock<std::shared_mutex> lock(results->mutex);
+            auto it = results->values.find(t);
+            if(it != results->values.end())
+                return it->second;
+        }
+        Ret result = cache->fn(args...); // evaluated without holding the lock, so that other threads are not blocked
+        std::unique_lock<std::shared_mutex> lock(results->mutex);
+        return results->values.emplace(std::move(t), std::move(result)).first->second;
     };
 }
 
@@ -163,21 +266,31 @@ auto memoize(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// Each thread calling the memoized function has its own cache with the arguments of its last call.
 template<typename Ret, typename... Args>
 auto memoizeLast(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](Args... args) mutable -> Ret
+    struct Cache
+    {
+        Fn<Ret(Args...)> fn;
+        Tuple<detail::CacheType<Args>...> args;
+        Ret result = Ret();
+        bool firsttime = true;
+    };
+    auto slots = std::make_shared<detail::MemoizationSlots<Cache, Fn<Ret(Args...)>>>(f);
+    return [=](Args... args) -> Ret
     {
+        auto cache = slots->get();
+        if(cache == nullptr)
+            return slots->evaluate(args...);
         if(Memoization::isDisabled())
-            return f(args...);
-        if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            return Ret(result);
-        detail::assignValues(cache, std::tie(args...));
-        firsttime = false;
-        return result = f(args...);
+            return cache->fn(args...);
+        if(detail::sameValues(cache->args, std::tie(args...)) && !cache->firsttime)
+            return Ret(cache->result);
+        cache->result = cache->fn(args...);
+        detail::assignValues(cache->args, std::tie(args...));
+        cache->firsttime = false;
+        return Ret(cache->result);
     };
 }
 
@@ -189,29 +302,38 @@ auto memoizeLast(Fun f)
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// Each thread calling the memoized function has its own cache with the arguments of its last call.
 template<typename Ret, typename RetRef, typename... Args>
 auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f) -> Fn<void(RetRef, Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](RetRef res, Args... args) mutable -> void
+    struct Cache
     {
-        if(Memoization::isDisabled())
-            f(res, args...);
-        else if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            res = result;
+        Fn<void(RetRef, Args...)> fn;
+        Tuple<detail::CacheType<Args>...> args;
+        Ret result = Ret();
+        bool firsttime = true;
+    };
+    auto slots = std::make_shared<detail::MemoizationSlots<Cache, Fn<void(RetRef, Args...)>>>(f);
+    return [=](RetRef res, Args... args) -> void
+    {
+        auto cache = slots->get();
+        if(cache == nullptr)
+            slots->evaluate(res, args...);
+        else if(Memoization::isDisabled())
+            cache->fn(res, args...);
+        else if(detail::sameValues(cache->args, std::tie(args...)) && !cache->firsttime)
+            res = cache->result;
         else
         {
-            f(res, args...);
-            result = res;
-            detail::assignValues(cache, std::tie(args...));
+            cache->fn(res, args...);
+            cache->result = res;
+            detail::assignValues(cache->args, std::tie(args...));
+            cache->firsttime = false;
         }
-        firsttime = false;
     };
 }
 
-/// Return a memoized version of given function `f` that caches only the arguments used in the last call./// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 /// This overload is used when `f` is a lambda function or free function.
 /// Use `memoizeLastUsingRef<Ret>(f)` to explicitly specify the `Ret` type.
 template<typename Ret, typename Fun, Requires<!isFunction<Fun>> = true>
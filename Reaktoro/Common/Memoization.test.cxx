@@ -15,6 +15,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <atomic>
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -126,3 +130,115 @@ TEST_CASE("Testing Memoization - memoizeLast without return", "[Memoization]")
 
     CHECK( counter == 5 ); // two increments above, in f1 and f2, because of different arguments
 }
+
+TEST_CASE("Testing Memoization - memoizeLast used by several threads", "[Memoization]")
+{
+    std::atomic<int> counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](double x, int y) -> double
+    {
+        ++counter;
+        return x * y;
+    };
+
+    auto f2 = memoizeLast(f1); // f2 is the memoized version of f1, shared by all threads below
+
+    auto g1 = [&](double& res, double x, int y) -> void
+    {
+        ++counter;
+        res = x + y;
+    };
+
+    auto g2 = memoizeLastUsingRef(g1); // g2 is the memoized version of g1, shared by all threads below
+
+    const auto nthreads = 8;
+    const auto ncalls = 1000;
+
+    std::atomic<int> failures = 0; // the number of wrong results returned by f2 and g2
+
+    Vec<std::thread> threads;
+    for(auto i = 0; i < nthreads; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            // Each thread alternates between its own two arguments, which would make a single shared cache miss on every call
+            for(auto k = 0; k < ncalls; ++k)
+            {
+                const double x = 1.0 + i;
+                const int y = 2 + k % 2;
+                double res = 0.0;
+                g2(res, x, y);
+                failures += f2(x, y) != x * y;
+                failures += res != x + y;
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == 0 );
+    CHECK( counter == 2 * nthreads * ncalls ); // each thread has its own cache, in which every call has different arguments than its last call
+
+    counter = 0;
+
+    Vec<std::thread> others;
+    for(auto i = 0; i < nthreads; ++i)
+    {
+        others.emplace_back([&, i]()
+        {
+            // Each thread now repeats its own arguments, which are then evaluated only once per thread and function
+            for(auto k = 0; k < ncalls; ++k)
+            {
+                const double x = 100.0 + i;
+                double res = 0.0;
+                g2(res, x, 3);
+                failures += f2(x, 3) != x * 3;
+                failures += res != x + 3;
+            }
+        });
+    }
+
+    for(auto& thread : others)
+        thread.join();
+
+    CHECK( failures == 0 );
+    CHECK( counter == 2 * nthreads );
+}
+
+TEST_CASE("Testing Memoization - memoize used by several threads", "[Memoization]")
+{
+    std::atomic<int> counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](int x) -> int
+    {
+        ++counter;
+        return x * x;
+    };
+
+    auto f2 = memoize(f1); // f2 is the memoized version of f1, shared by all threads below
+
+    std::atomic<int> failures = 0; // the number of wrong results returned by f2
+
+    Vec<std::thread> threads;
+    for(auto i = 0; i < 8; ++i)
+        threads.emplace_back([&]()
+        {
+            for(auto x = 0; x < 100; ++x)
+                failures += f2(x) != x * x;
+        });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == 0 );
+    CHECK( counter >= 100 ); // every argument is evaluated at least once (a few more times if threads raced to evaluate it)
+    CHECK( counter <= 800 );
+
+    counter = 0;
+
+    for(auto x = 0; x < 100; ++x)
+        f2(x);
+
+    CHECK( counter == 0 ); // all results have been cached and shared among the threads
+}
@@ -19,9 +19,14 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 
 namespace Reaktoro {
 
+// Note: the macros below are kept for backward compatibility. Prefer
+// TracingScope and the RKT_TRACE_SCOPE and RKT_TRACE_COUNT macros in
+// Tracing.hpp, whose timings are aggregated in reports by Tracing.
+
 #ifdef REAKTORO_DISABLE_PROFILING
 
 /// Macro to start timing of a sequence of statements.
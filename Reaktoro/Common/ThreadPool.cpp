@@ -0,0 +1,103 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ThreadPool.hpp"
+
+namespace Reaktoro {
+
+ThreadPool::ThreadPool(Index nthreads)
+{
+    if(nthreads == 0)
+        nthreads = std::max<Index>(std::thread::hardware_concurrency(), 1);
+
+    workers.reserve(nthreads);
+    for(Index i = 0; i < nthreads; ++i)
+        workers.emplace_back([=] { work(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    for(auto& worker : workers)
+        worker.join();
+}
+
+auto ThreadPool::size() const -> Index
+{
+    return workers.size();
+}
+
+auto ThreadPool::run(Index n, Task const& task) -> void
+{
+    if(n == 0)
+        return;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    job = &task;
+    ntasks = n;
+    inext = 0;
+    nbusy = workers.size();
+    error = nullptr;
+    ++generation;
+    wakeup.notify_all();
+
+    finished.wait(lock, [&] { return nbusy == 0; });
+    job = nullptr;
+
+    if(error)
+        std::rethrow_exception(error);
+}
+
+auto ThreadPool::work(Index ithread) -> void
+{
+    Index seen = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while(true)
+    {
+        wakeup.wait(lock, [&] { return stopping || generation != seen; });
+
+        if(stopping)
+            return;
+
+        seen = generation;
+
+        // Take tasks one at a time until the job is exhausted (or a task has failed)
+        while(inext < ntasks && !error)
+        {
+            const auto itask = inext++;
+            lock.unlock();
+            try { (*job)(itask, ithread); }
+            catch(...)
+            {
+                lock.lock();
+                if(!error) error = std::current_exception();
+                continue;
+            }
+            lock.lock();
+        }
+
+        if(--nbusy == 0)
+            finished.notify_one();
+    }
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,102 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to execute independent tasks concurrently on a fixed set of worker threads.
+/// The worker threads are created once and reused across calls to @ref run, so that
+/// methods called repeatedly (e.g., once per time step) do not pay for thread creation.
+class ThreadPool
+{
+public:
+    /// The function type for a task, called with the index of the task and the index of the worker thread executing it.
+    using Task = std::function<void(Index itask, Index ithread)>;
+
+    /// Construct a ThreadPool object with given number of worker threads.
+    /// @param nthreads The number of worker threads (if zero, the number of hardware threads is used)
+    explicit ThreadPool(Index nthreads = 0);
+
+    /// Construct a copy of a ThreadPool object [deleted].
+    ThreadPool(ThreadPool const&) = delete;
+
+    /// Destroy this ThreadPool object, joining its worker threads.
+    ~ThreadPool();
+
+    /// Assign a ThreadPool object to this [deleted].
+    auto operator=(ThreadPool const&) -> ThreadPool& = delete;
+
+    /// Return the number of worker threads in the pool.
+    auto size() const -> Index;
+
+    /// Execute tasks `0, 1, ..., ntasks - 1` on the worker threads and wait until all are finished.
+    /// Tasks are handed out dynamically, one at a time, to the next idle worker thread. If a task
+    /// throws, the remaining tasks are not started and the first exception is rethrown here.
+    /// @param ntasks The number of tasks to be executed
+    /// @param task The function executing each task
+    auto run(Index ntasks, Task const& task) -> void;
+
+private:
+    /// The main loop of each worker thread.
+    auto work(Index ithread) -> void;
+
+    /// The worker threads in the pool.
+    Vec<std::thread> workers;
+
+    /// The mutex guarding the state of the current job.
+    std::mutex mutex;
+
+    /// The condition variable used to notify workers of a new job or the end of the pool.
+    std::condition_variable wakeup;
+
+    /// The condition variable used to notify the caller of @ref run that all workers are done.
+    std::condition_variable finished;
+
+    /// The function executing each task of the current job.
+    Task const* job = nullptr;
+
+    /// The number of tasks in the current job.
+    Index ntasks = 0;
+
+    /// The index of the next task to be handed out in the current job.
+    Index inext = 0;
+
+    /// The number of worker threads still busy with the current job.
+    Index nbusy = 0;
+
+    /// The counter of jobs used by workers to detect a new job.
+    Index generation = 0;
+
+    /// The first exception thrown by a task in the current job.
+    std::exception_ptr error;
+
+    /// The flag indicating the pool is being destroyed.
+    bool stopping = false;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,68 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <atomic>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ThreadPool", "[ThreadPool]")
+{
+    ThreadPool pool(4);
+
+    CHECK( pool.size() == 4 );
+
+    // Every task is executed exactly once, by a valid worker thread
+    Vec<Index> count(1000, 0);
+    std::atomic<Index> badthreads = 0;
+
+    pool.run(count.size(), [&](Index itask, Index ithread)
+    {
+        count[itask] += 1;
+        if(ithread >= pool.size())
+            ++badthreads;
+    });
+
+    CHECK( std::all_of(count.begin(), count.end(), [](Index c) { return c == 1; }) );
+    CHECK( badthreads == 0 );
+
+    // The pool can be reused for further jobs
+    std::atomic<Index> sum = 0;
+    pool.run(101, [&](Index itask, Index ithread) { sum += itask; });
+    CHECK( sum == 5050 );
+
+    // Empty jobs return immediately
+    pool.run(0, [&](Index itask, Index ithread) { sum += 1; });
+    CHECK( sum == 5050 );
+
+    // Exceptions thrown by a task are rethrown to the caller
+    CHECK_THROWS( pool.run(10, [&](Index itask, Index ithread) { errorif(itask == 7, "Task failed."); }) );
+
+    // The pool is still usable after a failed job
+    sum = 0;
+    pool.run(10, [&](Index itask, Index ithread) { sum += 1; });
+    CHECK( sum == 10 );
+
+    // A default pool uses all hardware threads (at least one)
+    CHECK( ThreadPool().size() >= 1 );
+}
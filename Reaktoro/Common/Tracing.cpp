@@ -0,0 +1,447 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Tracing.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The flag indicating whether tracing is enabled.
+std::atomic<bool> enabled = false;
+
+/// The maximum number of scope calls recorded per thread for export in Chrome trace format.
+std::atomic<Index> eventcapacity = 100000;
+
+/// The aggregated timing of a traced scope in the tree of scopes of a thread.
+struct Node
+{
+    Chars name = "";     ///< The name of the scope.
+    Index parent = 0;    ///< The index of the node of the enclosing scope.
+    Indices children;    ///< The indices of the nodes of the scopes directly enclosed by this one.
+    Index calls = 0;     ///< The number of calls of the scope.
+    double total = 0.0;  ///< The total time spent in the scope (in s).
+    double min = std::numeric_limits<double>::infinity(); ///< The shortest time spent in a single call of the scope (in s).
+    double max = 0.0;    ///< The longest time spent in a single call of the scope (in s).
+};
+
+/// A call of a traced scope, recorded for export in Chrome trace format.
+struct Event
+{
+    Chars name;      ///< The name of the scope.
+    double begin;    ///< The time at which the scope was entered since the tracing epoch (in s).
+    double duration; ///< The time spent in the scope (in s).
+};
+
+/// The instrumentation data of a thread.
+struct ThreadData
+{
+    std::mutex mutex;               ///< The mutex guarding this data while it is read by a report from another thread.
+    Index tid = 0;                  ///< The sequential identifier of the thread.
+    Index generation = 0;           ///< The number of resets of this data.
+    Time epoch;                     ///< The time point from which the times of recorded calls are measured.
+    Vec<Node> nodes = { Node{} };   ///< The tree of traced scopes of the thread (with a root node not corresponding to any scope).
+    Index current = 0;              ///< The index of the node of the innermost scope currently entered in the thread.
+    Vec<Event> events;              ///< The recorded calls of the traced scopes.
+    Map<Chars, double> counters;    ///< The counters of the thread, by address of their names.
+};
+
+/// The registry of the instrumentation data of all threads that have used tracing.
+struct Registry
+{
+    std::mutex mutex;               ///< The mutex guarding the registry.
+    Vec<SharedPtr<ThreadData>> threads; ///< The instrumentation data of each thread (kept after the thread ends).
+    Time epoch = time();            ///< The time point from which the times of recorded calls are measured.
+};
+
+auto registry() -> Registry&
+{
+    static Registry obj;
+    return obj;
+}
+
+auto threadData() -> ThreadData&
+{
+    thread_local SharedPtr<ThreadData> data = []
+    {
+        auto& reg = registry();
+        auto res = std::make_shared<ThreadData>();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        res->tid = reg.threads.size();
+        res->epoch = reg.epoch;
+        reg.threads.push_back(res);
+        return res;
+    }();
+    return *data;
+}
+
+/// Return the index of the child node of `inode` with given name, creating it if needed.
+auto findOrCreateChild(Vec<Node>& nodes, Index inode, Chars name) -> Index
+{
+    for(auto ichild : nodes[inode].children)
+        if(nodes[ichild].name == name || std::strcmp(nodes[ichild].name, name) == 0)
+            return ichild;
+    const auto ichild = nodes.size();
+    Node child;
+    child.name = name;
+    child.parent = inode;
+    nodes.push_back(child);
+    nodes[inode].children.push_back(ichild);
+    return ichild;
+}
+
+/// The aggregated timing of a traced scope in the tree of scopes merged from all threads.
+struct MergedNode
+{
+    String name;
+    Indices children;
+    Index calls = 0;
+    double total = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = 0.0;
+};
+
+/// Merge the subtree of a thread rooted at `inode` into the merged subtree rooted at `imerged`.
+auto merge(Vec<MergedNode>& merged, Index imerged, Vec<Node> const& nodes, Index inode) -> void
+{
+    for(auto ichild : nodes[inode].children)
+    {
+        auto const& child = nodes[ichild];
+        auto const& mchildren = merged[imerged].children;
+        auto it = std::find_if(mchildren.begin(), mchildren.end(), [&](Index i) { return merged[i].name == child.name; });
+        Index jchild = 0;
+        if(it != mchildren.end())
+            jchild = *it;
+        else
+        {
+            jchild = merged.size();
+            merged.push_back(MergedNode{ child.name });
+            merged[imerged].children.push_back(jchild);
+        }
+        auto& mchild = merged[jchild];
+        mchild.calls += child.calls;
+        mchild.total += child.total;
+        mchild.min = std::min(mchild.min, child.min);
+        mchild.max = std::max(mchild.max, child.max);
+        merge(merged, jchild, nodes, ichild);
+    }
+}
+
+/// Append the timings of the merged subtree rooted at `inode` to `timers` in depth-first order.
+auto flatten(Vec<MergedNode> const& merged, Index inode, String const& path, Index depth, Vec<TracingTimer>& timers) -> void
+{
+    for(auto ichild : merged[inode].children)
+    {
+        auto const& child = merged[ichild];
+        TracingTimer timer;
+        timer.path = path.empty() ? child.name : path + "/" + child.name;
+        timer.depth = depth;
+        timer.calls = child.calls;
+        timer.total = child.total;
+        timer.min = child.calls ? child.min : 0.0;
+        timer.max = child.max;
+        timers.push_back(timer);
+        flatten(merged, ichild, timer.path, depth + 1, timers);
+    }
+}
+
+/// Return a string in JSON format (quoted and escaped).
+auto quoted(String const& str) -> String
+{
+    String res = "\"";
+    for(auto c : str)
+    {
+        switch(c)
+        {
+        case '"': res += "\\\""; break;
+        case '\\': res += "\\\\"; break;
+        case '\n': res += "\\n"; break;
+        case '\t': res += "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+            {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                res += buffer;
+            }
+            else res += c;
+        }
+    }
+    return res + "\"";
+}
+
+/// Return a number in JSON format.
+auto number(double value) -> String
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    return buffer;
+}
+
+/// Save a string in a file.
+auto save(String const& filename, String const& contents) -> void
+{
+    std::ofstream file(filename, std::ios::binary);
+    errorif(!file.is_open(), "Could not open file `", filename, "` for writing the tracing results.");
+    file << contents;
+}
+
+} // namespace
+
+auto TracingReport::timer(String const& path) const -> TracingTimer
+{
+    for(auto const& entry : timers)
+        if(entry.path == path)
+            return entry;
+    return {};
+}
+
+auto TracingReport::counter(String const& name) const -> double
+{
+    for(auto const& [key, value] : counters)
+        if(key == name)
+            return value;
+    return 0.0;
+}
+
+auto TracingReport::json() const -> String
+{
+    String res = "{\n  \"timers\": [";
+    for(Index i = 0; i < timers.size(); ++i)
+    {
+        auto const& t = timers[i];
+        res += i == 0 ? "\n" : ",\n";
+        res += "    { \"path\": " + quoted(t.path);
+        res += ", \"depth\": " + std::to_string(t.depth);
+        res += ", \"calls\": " + std::to_string(t.calls);
+        res += ", \"total\": " + number(t.total);
+        res += ", \"min\": " + number(t.min);
+        res += ", \"max\": " + number(t.max) + " }";
+    }
+    res += timers.empty() ? "],\n" : "\n  ],\n";
+    res += "  \"counters\": {";
+    for(Index i = 0; i < counters.size(); ++i)
+    {
+        res += i == 0 ? "\n" : ",\n";
+        res += "    " + quoted(counters[i].first) + ": " + number(counters[i].second);
+    }
+    res += counters.empty() ? "}\n" : "\n  }\n";
+    return res + "}\n";
+}
+
+auto Tracing::isEnabled() -> bool
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+auto Tracing::enable() -> void
+{
+    enabled = true;
+}
+
+auto Tracing::disable() -> void
+{
+    enabled = false;
+}
+
+auto Tracing::reset() -> void
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.epoch = time();
+    for(auto const& data : reg.threads)
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        data->generation += 1;
+        data->epoch = reg.epoch;
+        data->nodes = { Node{} };
+        data->current = 0;
+        data->events.clear();
+        data->counters.clear();
+    }
+}
+
+auto Tracing::setEventCapacity(Index capacity) -> void
+{
+    eventcapacity = capacity;
+}
+
+auto Tracing::count(Chars name, double value) -> void
+{
+#ifndef REAKTORO_DISABLE_PROFILING
+    if(!isEnabled())
+        return;
+    auto& data = threadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.counters[name] += value;
+#endif
+}
+
+auto Tracing::report() -> TracingReport
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    Vec<MergedNode> merged(1);
+    Map<String, double> counters;
+
+    for(auto const& data : reg.threads)
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        merge(merged, 0, data->nodes, 0);
+        for(auto const& [name, value] : data->counters)
+            counters[name] += value;
+    }
+
+    TracingReport res;
+    flatten(merged, 0, "", 0, res.timers);
+    res.counters.assign(counters.begin(), counters.end());
+    std::sort(res.counters.begin(), res.counters.end());
+    return res;
+}
+
+auto Tracing::json() -> String
+{
+    return report().json();
+}
+
+auto Tracing::chromeTrace() -> String
+{
+    const auto counters = report().counters;
+
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    String res = "{\n  \"displayTimeUnit\": \"ms\",\n  \"traceEvents\": [";
+
+    auto first = true;
+    auto separator = [&]() -> Chars { auto sep = first ? "\n" : ",\n"; first = false; return sep; };
+
+    double end = 0.0;
+
+    for(auto const& data : reg.threads)
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        const auto tid = std::to_string(data->tid);
+        for(auto const& e : data->events)
+        {
+            res += separator();
+            res += "    { \"name\": " + quoted(e.name) + ", \"ph\": \"X\", \"pid\": 0, \"tid\": " + tid;
+            res += ", \"ts\": " + number(e.begin * 1e6) + ", \"dur\": " + number(e.duration * 1e6) + " }";
+            end = std::max(end, e.begin + e.duration);
+        }
+    }
+
+    for(auto const& [name, value] : counters)
+    {
+        res += separator();
+        res += "    { \"name\": " + quoted(name) + ", \"ph\": \"C\", \"pid\": 0, \"tid\": 0";
+        res += ", \"ts\": " + number(end * 1e6) + ", \"args\": { \"value\": " + number(value) + " } }";
+    }
+
+    res += first ? "]\n" : "\n  ]\n";
+    return res + "}\n";
+}
+
+auto Tracing::saveJson(String const& filename) -> void
+{
+    save(filename, json());
+}
+
+auto Tracing::saveChromeTrace(String const& filename) -> void
+{
+    save(filename, chromeTrace());
+}
+
+#ifndef REAKTORO_DISABLE_PROFILING
+
+TracingScope::TracingScope(Chars name, bool timed)
+: name(name), timed(timed)
+{
+    if(Tracing::isEnabled())
+    {
+        auto& data = threadData();
+        std::lock_guard<std::mutex> lock(data.mutex);
+        parent = data.current;
+        node = findOrCreateChild(data.nodes, parent, name);
+        data.current = node;
+        generation = data.generation;
+        recording = true;
+        this->timed = true;
+    }
+
+    if(this->timed)
+        start = time();
+}
+
+TracingScope::~TracingScope()
+{
+    stop();
+}
+
+auto TracingScope::elapsed() const -> double
+{
+    return timed ? Reaktoro::elapsed(start) : 0.0;
+}
+
+auto TracingScope::stop() -> double
+{
+    if(stopped)
+        return 0.0;
+
+    stopped = true;
+
+    const auto duration = elapsed();
+
+    if(!recording)
+        return duration;
+
+    auto& data = threadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    // Skip recording if the data of the thread has been reset since entering the scope
+    if(data.generation != generation)
+        return duration;
+
+    auto& entry = data.nodes[node];
+    entry.calls += 1;
+    entry.total += duration;
+    entry.min = std::min(entry.min, duration);
+    entry.max = std::max(entry.max, duration);
+
+    data.current = parent;
+
+    if(data.events.size() < eventcapacity.load(std::memory_order_relaxed))
+        data.events.push_back({ name, Reaktoro::elapsed(start, data.epoch), duration });
+
+    return duration;
+}
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace Reaktoro
@@ -0,0 +1,176 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The aggregated timing of a traced scope over all its calls in all threads.
+struct TracingTimer
+{
+    /// The path of the scope, with the names of its enclosing scopes separated by `/` (e.g., `EquilibriumSolver::solve/ChemicalProps::update`).
+    String path;
+
+    /// The nesting depth of the scope (zero for scopes not enclosed by other traced scopes).
+    Index depth = 0;
+
+    /// The number of calls of the scope.
+    Index calls = 0;
+
+    /// The total time spent in the scope (in s).
+    double total = 0.0;
+
+    /// The shortest time spent in a single call of the scope (in s).
+    double min = 0.0;
+
+    /// The longest time spent in a single call of the scope (in s).
+    double max = 0.0;
+};
+
+/// The aggregated results of the instrumentation of Reaktoro since tracing was last enabled or reset.
+struct TracingReport
+{
+    /// The timings of the traced scopes, in depth-first order of their nesting.
+    Vec<TracingTimer> timers;
+
+    /// The values of the counters (e.g., `Optima::iterations`), in alphabetical order of their names.
+    Pairs<String, double> counters;
+
+    /// Return the timing of the traced scope with given path or an empty one if there is no such scope.
+    auto timer(String const& path) const -> TracingTimer;
+
+    /// Return the value of the counter with given name or zero if there is no such counter.
+    auto counter(String const& name) const -> double;
+
+    /// Return this report in JSON format.
+    auto json() const -> String;
+};
+
+/// Used to enable and collect the instrumentation of Reaktoro with nested scoped timers and counters.
+/// Tracing is disabled by default, in which case the instrumentation points
+/// amount to checking a flag. It is thread-aware: each thread records into
+/// its own buffer, and these are aggregated when a report is produced. All
+/// instrumentation is compiled out if `REAKTORO_DISABLE_PROFILING` is defined.
+class Tracing
+{
+public:
+    /// Return true if tracing is currently enabled.
+    static auto isEnabled() -> bool;
+
+    /// Enable tracing.
+    static auto enable() -> void;
+
+    /// Disable tracing (the data collected so far is kept).
+    static auto disable() -> void;
+
+    /// Discard all data collected so far.
+    static auto reset() -> void;
+
+    /// Set the maximum number of scope calls recorded per thread for export in Chrome trace format (default is 100000).
+    static auto setEventCapacity(Index capacity) -> void;
+
+    /// Add a value to a counter if tracing is enabled.
+    /// @param name The name of the counter, which must be a string with static storage duration (e.g., a string literal).
+    /// @param value The value to be added to the counter.
+    static auto count(Chars name, double value = 1.0) -> void;
+
+    /// Return the aggregated timings and counters collected in all threads.
+    static auto report() -> TracingReport;
+
+    /// Return the aggregated timings and counters collected in all threads in JSON format.
+    static auto json() -> String;
+
+    /// Return the recorded scope calls and the counters in Chrome trace format (for chrome://tracing or Perfetto).
+    static auto chromeTrace() -> String;
+
+    /// Save the aggregated timings and counters in a JSON file.
+    static auto saveJson(String const& filename) -> void;
+
+    /// Save the recorded scope calls and the counters in a JSON file in Chrome trace format.
+    static auto saveChromeTrace(String const& filename) -> void;
+
+    /// Deleted default constructor.
+    Tracing() = delete;
+};
+
+/// Used to trace the execution of a scope, from its construction until its destruction or a call to @ref stop.
+class TracingScope
+{
+public:
+    /// Construct a TracingScope object entering a traced scope.
+    /// @param name The name of the scope, which must be a string with static storage duration (e.g., a string literal).
+    /// @param timed Whether the elapsed time should be measured even if tracing is disabled (e.g., for reporting it in a result object).
+    explicit TracingScope(Chars name, bool timed = false);
+
+    /// Destroy this TracingScope object leaving the traced scope if not yet stopped.
+    ~TracingScope();
+
+    /// Deleted copy constructor.
+    TracingScope(TracingScope const&) = delete;
+
+    /// Deleted copy assignment operator.
+    auto operator=(TracingScope const&) -> TracingScope& = delete;
+
+    /// Return the time elapsed since entering the scope (in s), or zero if the scope is not timed.
+    auto elapsed() const -> double;
+
+    /// Leave the traced scope and return the time spent in it (in s), or zero if the scope is not timed.
+    auto stop() -> double;
+
+private:
+    Chars name;             ///< The name of the scope.
+    Time start;             ///< The time point at which the scope was entered.
+    bool timed = false;     ///< Whether `start` has been set.
+    bool recording = false; ///< Whether this scope is being recorded (tracing was enabled on entering it).
+    bool stopped = false;   ///< Whether this scope has been left already.
+    Index node = 0;         ///< The index of the node of this scope in the tree of scopes of the current thread.
+    Index parent = 0;       ///< The index of the node of the enclosing scope in the tree of scopes of the current thread.
+    Index generation = 0;   ///< The number of resets of the thread data when the scope was entered.
+};
+
+#ifdef REAKTORO_DISABLE_PROFILING
+
+inline TracingScope::TracingScope(Chars name, bool timed) : name(name) {}
+inline TracingScope::~TracingScope() {}
+inline auto TracingScope::elapsed() const -> double { return 0.0; }
+inline auto TracingScope::stop() -> double { return 0.0; }
+
+/// Macro to trace the execution of the enclosing scope under a given name (compiled out).
+#define RKT_TRACE_SCOPE(name)
+
+/// Macro to add a value to a named counter (compiled out).
+#define RKT_TRACE_COUNT(name, value)
+
+#else
+
+/// Auxiliary macros to create unique variable names in RKT_TRACE_SCOPE.
+#define RKT_TRACE_CONCAT_IMPL(a, b) a##b
+#define RKT_TRACE_CONCAT(a, b) RKT_TRACE_CONCAT_IMPL(a, b)
+
+/// Macro to trace the execution of the enclosing scope under a given name.
+#define RKT_TRACE_SCOPE(name) Reaktoro::TracingScope RKT_TRACE_CONCAT(__rkt_trace_scope_, __LINE__)(name)
+
+/// Macro to add a value to a named counter.
+#define RKT_TRACE_COUNT(name, value) Reaktoro::Tracing::count(name, value)
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace Reaktoro
@@ -0,0 +1,58 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Tracing.hpp>
+using namespace Reaktoro;
+
+void exportTracing(py::module& m)
+{
+    py::class_<TracingTimer>(m, "TracingTimer")
+        .def(py::init<>())
+        .def_readwrite("path", &TracingTimer::path, "The path of the scope, with the names of its enclosing scopes separated by `/`.")
+        .def_readwrite("depth", &TracingTimer::depth, "The nesting depth of the scope.")
+        .def_readwrite("calls", &TracingTimer::calls, "The number of calls of the scope.")
+        .def_readwrite("total", &TracingTimer::total, "The total time spent in the scope (in s).")
+        .def_readwrite("min", &TracingTimer::min, "The shortest time spent in a single call of the scope (in s).")
+        .def_readwrite("max", &TracingTimer::max, "The longest time spent in a single call of the scope (in s).")
+        ;
+
+    py::class_<TracingReport>(m, "TracingReport")
+        .def(py::init<>())
+        .def_readwrite("timers", &TracingReport::timers, "The timings of the traced scopes, in depth-first order of their nesting.")
+        .def_readwrite("counters", &TracingReport::counters, "The values of the counters, in alphabetical order of their names.")
+        .def("timer", &TracingReport::timer, "Return the timing of the traced scope with given path or an empty one if there is no such scope.")
+        .def("counter", &TracingReport::counter, "Return the value of the counter with given name or zero if there is no such counter.")
+        .def("json", &TracingReport::json, "Return this report in JSON format.")
+        ;
+
+    py::class_<Tracing>(m, "Tracing")
+        .def_static("isEnabled", &Tracing::isEnabled, "Return true if tracing is currently enabled.")
+        .def_static("enable", &Tracing::enable, "Enable tracing.")
+        .def_static("disable", &Tracing::disable, "Disable tracing (the data collected so far is kept).")
+        .def_static("reset", &Tracing::reset, "Discard all data collected so far.")
+        .def_static("setEventCapacity", &Tracing::setEventCapacity, "Set the maximum number of scope calls recorded per thread for export in Chrome trace format.")
+        .def_static("report", &Tracing::report, "Return the aggregated timings and counters collected in all threads.")
+        .def_static("json", &Tracing::json, "Return the aggregated timings and counters collected in all threads in JSON format.")
+        .def_static("chromeTrace", &Tracing::chromeTrace, "Return the recorded scope calls and the counters in Chrome trace format.")
+        .def_static("saveJson", &Tracing::saveJson, "Save the aggregated timings and counters in a JSON file.")
+        .def_static("saveChromeTrace", &Tracing::saveChromeTrace, "Save the recorded scope calls and the counters in a JSON file in Chrome trace format.")
+        ;
+}
@@ -0,0 +1,145 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+auto traced(Index n) -> void
+{
+    RKT_TRACE_SCOPE("outer");
+    for(Index i = 0; i < n; ++i)
+    {
+        RKT_TRACE_SCOPE("inner");
+        RKT_TRACE_COUNT("iterations", 1);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Testing Tracing", "[Tracing]")
+{
+    Tracing::reset();
+
+    CHECK_FALSE( Tracing::isEnabled() );
+
+    // Nothing is recorded while tracing is disabled
+    traced(5);
+
+    CHECK( Tracing::report().timers.empty() );
+    CHECK( Tracing::report().counters.empty() );
+
+    Tracing::enable();
+
+    CHECK( Tracing::isEnabled() );
+
+#ifndef REAKTORO_DISABLE_PROFILING
+    SECTION("Checking nested scopes and counters are aggregated")
+    {
+        traced(3);
+        traced(4);
+
+        auto const report = Tracing::report();
+
+        REQUIRE( report.timers.size() == 2 );
+
+        CHECK( report.timers[0].path == "outer" );
+        CHECK( report.timers[0].depth == 0 );
+        CHECK( report.timers[0].calls == 2 );
+
+        CHECK( report.timers[1].path == "outer/inner" );
+        CHECK( report.timers[1].depth == 1 );
+        CHECK( report.timers[1].calls == 7 );
+
+        CHECK( report.timers[0].total >= report.timers[1].total );
+        CHECK( report.timers[0].min <= report.timers[0].max );
+
+        CHECK( report.counter("iterations") == 7 );
+        CHECK( report.counter("unknown") == 0 );
+        CHECK( report.timer("outer/inner").calls == 7 );
+        CHECK( report.timer("unknown").calls == 0 );
+    }
+
+    SECTION("Checking scopes stopped before their destruction")
+    {
+        {
+            TracingScope scope("scope");
+            const auto duration = scope.stop();
+            CHECK( duration >= 0.0 );
+            CHECK( scope.stop() == 0.0 ); // stopping twice has no effect
+            RKT_TRACE_SCOPE("sibling"); // entered after scope has been left
+        }
+
+        auto const report = Tracing::report();
+
+        REQUIRE( report.timers.size() == 2 );
+        CHECK( report.timers[0].path == "scope" );
+        CHECK( report.timers[0].calls == 1 );
+        CHECK( report.timers[1].path == "sibling" );
+    }
+
+    SECTION("Checking data collected in several threads is aggregated")
+    {
+        ThreadPool pool(4);
+
+        pool.run(100, [&](Index itask, Index ithread) { traced(2); });
+
+        auto const report = Tracing::report();
+
+        CHECK( report.timer("outer").calls == 100 );
+        CHECK( report.timer("outer/inner").calls == 200 );
+        CHECK( report.counter("iterations") == 200 );
+    }
+
+    SECTION("Checking export in JSON and Chrome trace formats")
+    {
+        traced(2);
+
+        auto const json = Tracing::json();
+
+        CHECK( json.find("\"path\": \"outer/inner\"") != String::npos );
+        CHECK( json.find("\"iterations\": 2") != String::npos );
+
+        auto const trace = Tracing::chromeTrace();
+
+        CHECK( trace.find("\"traceEvents\"") != String::npos );
+        CHECK( trace.find("\"name\": \"inner\", \"ph\": \"X\"") != String::npos );
+        CHECK( trace.find("\"name\": \"iterations\", \"ph\": \"C\"") != String::npos );
+    }
+
+    SECTION("Checking the elapsed time of timed scopes is measured even with tracing disabled")
+    {
+        Tracing::disable();
+
+        TracingScope scope("timed", true);
+
+        CHECK( scope.stop() >= 0.0 );
+        CHECK( Tracing::report().timers.empty() );
+    }
+#endif
+
+    Tracing::disable();
+    Tracing::reset();
+
+    CHECK( Tracing::report().timers.empty() );
+}
@@ -21,7 +21,9 @@
 #include <Reaktoro/Core/ActivityProps.hpp>
 #include <Reaktoro/Core/AggregateState.hpp>
 #include <Reaktoro/Core/ChemicalFormula.hpp>
+#include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsBatch.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -51,6 +53,7 @@
 #include <Reaktoro/Core/SpeciesThermoProps.hpp>
 #include <Reaktoro/Core/StandardThermoModel.hpp>
 #include <Reaktoro/Core/StandardThermoProps.hpp>
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
 #include <Reaktoro/Core/StandardVolumeModel.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 #include <Reaktoro/Core/Surface.hpp>
@@ -22,7 +22,9 @@ void exportActivityModel(py::module& m);
 void exportActivityProps(py::module& m);
 void exportAggregateState(py::module& m);
 void exportChemicalFormula(py::module& m);
+void exportChemicalOutput(py::module& m);
 void exportChemicalProps(py::module& m);
+void exportChemicalPropsBatch(py::module& m);
 void exportChemicalPropsPhase(py::module& m);
 void exportChemicalState(py::module& m);
 void exportChemicalSystem(py::module& m);
@@ -51,6 +53,7 @@ void exportSpeciesList(py::module& m);
 void exportSpeciesThermoProps(py::module& m);
 void exportStandardThermoModel(py::module& m);
 void exportStandardThermoProps(py::module& m);
+void exportStandardThermoPropsCache(py::module& m);
 void exportStateOfMatter(py::module& m);
 void exportSurface(py::module& m);
 void exportSurfaceAreaModel(py::module& m);
@@ -94,6 +97,7 @@ void exportCore(py::module& m)
     exportSpeciesThermoProps(m);
     exportStandardThermoProps(m);
     exportStandardThermoModel(m);
+    exportStandardThermoPropsCache(m);
     exportStateOfMatter(m);
     exportSurface(m);
     exportSurfaceAreaModel(m);
@@ -106,4 +110,6 @@ void exportCore(py::module& m)
     exportChemicalState(m);
     exportChemicalPropsPhase(m);
     exportChemicalProps(m);
+    exportChemicalPropsBatch(m);
+    exportChemicalOutput(m);
 }
@@ -1,325 +1,404 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2024 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #include "ChemicalOutput.hpp"
-
-// // C++ includes
-// #include <fstream>
-// #include <iomanip>
-// #include <iostream>
-// #include <cmath>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/Exception.hpp>
-// #include <Reaktoro/Common/StringList.hpp>
-// #include <Reaktoro/Common/StringUtils.hpp>
-// #include <Reaktoro/Common/Units.hpp>
-// #include <Reaktoro/Core/ChemicalQuantity.hpp>
-// #include <Reaktoro/Core/ChemicalState.hpp>
-// #include <Reaktoro/Core/ChemicalSystem.hpp>
-// #include <Reaktoro/Core/ReactionSystem.hpp>
-
-// namespace Reaktoro {
-
-// struct ChemicalOutput::Impl
-// {
-//     /// The chemical system instance
-//     ChemicalSystem system;
-
-//     /// The reaction system instance
-//     ReactionSystem reactions;
-
-//     /// The chemical quantity instance
-//     ChemicalQuantity quantity;
-
-//     /// The flag that indicates if output should be done at the terminal.
-//     bool terminal = false;
-
-//     /// The name of the output file.
-//     std::string filename;
-
-//     /// The base name of the output file.
-//     std::string basename;
-
-//     /// The extension name of the output file.
-//     std::string extension;
-
-//     /// The suffix word of the output file name.
-//     std::string suffix;
-
-//     /// The names of the quantities to be output.
-//     std::vector<std::string> data;
-
-//     /// The names of the quantities to appear as column header in the output.
-//     std::vector<std::string> headings;
-
-//     /// The floating-point precision in the output.
-//     int precision = 6;
-
-//     /// The flag that indicates if scientific format should be used.
-//     bool scientific = false;
-
-//     /// The output stream of the data file.
-//     std::ofstream datafile;
-
-//     /// The iteration number for every update call
-//     Index iteration = 0;
-
-//     /// The extra attachments to the output file.
-//     std::vector<std::string> attachments;
-
-//     /// The index of the active column
-//     Index icolumn = 0;
-
-//     /// The spacings between the columns
-//     std::vector<int> spacings;
-
-//     Impl()
-//     : quantity(system)
-//     {}
-
-//     Impl(const ChemicalSystem& system)
-//     : system(system), quantity(system)
-//     {}
-
-//     Impl(const ReactionSystem& reactions)
-//     : system(reactions.system()), reactions(reactions), quantity(reactions)
-//     {}
-
-//     ~Impl()
-//     {
-//         close();
-//     }
-
-//     auto spacing(std::string word) const -> std::size_t
-//     {
-//         return word.size() + std::max(5, 25 - static_cast<int>(word.size()));
-//     }
-
-//     auto open() -> void
-//     {
-//         // Ensure the output file is closed
-//         close();
-
-//         // Ensure output is done either to a file and/or terminal
-//         Assert(!filename.empty() || terminal,
-//             "Cannot open the ChemicalOutput instance for output.",
-//             "The instance has not been configured to output to the terminal or file.");
-
-//         // Make sure header is not empty
-//         if(headings.empty())
-//             headings = data;
-
-//         // Open the data file
-//         if(!filename.empty())
-//             datafile.open(filename, std::ofstream::out | std::ofstream::trunc);
-
-//         // Check if scientific format should be used
-//         if(scientific)
-//             datafile << std::scientific;
-
-//         // Set the floating-point precision in the output.
-//         datafile << std::setprecision(precision);
-
-//         // Determine the spacings between the columns
-//         spacings.clear();
-//         for(auto word : headings)
-//             spacings.push_back(spacing(word));
-
-//         // Output the header of the data file
-//         icolumn = 0;
-//         for(auto word : headings)
-//         {
-//             auto space = spacings[icolumn];
-//             if(datafile.is_open()) datafile << std::left << std::setw(space) << word;
-//             if(terminal)
-//             {
-//                 std::ios::fmtflags flags(std::cout.flags());
-//                 if(scientific) std::cout << std::scientific;
-//                 std::cout << std::setprecision(precision);
-//                 std::cout << std::left << std::setw(space) << word;
-//                 std::cout.flags(flags);
-//             }
-//             ++icolumn;
-//         }
-//     }
-
-//     auto close() -> void
-//     {
-//         datafile.close();
-//     }
-
-//     auto update(const ChemicalState& state, double t) -> void
-//     {
-//         // Output values on a new line
-//         if(datafile.is_open()) datafile << std::endl;
-//         if(terminal) std::cout << std::endl;
-
-//         // Output the current chemical state to the data file.
-//         quantity.update(state, t);
-
-//         // For each quantity, ouput its value on each column
-//         icolumn = 0;
-//         for(auto word : data)
-//         {
-//             auto space = spacings[icolumn];
-//             auto val = (word == "i") ? iteration : quantity.value(word);
-//             if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
-//             if(terminal) std::cout << std::left << std::setw(space) << val;
-//             ++icolumn;
-//         }
-
-//         // Update the iteration number
-//         ++iteration;
-//     }
-
-//     template<typename ValueType>
-//     auto attach(ValueType value) -> void
-//     {
-//         auto space = spacings[icolumn];
-//         if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
-//         if(terminal) std::cout << std::left << std::setw(space) << value;
-//         ++icolumn;
-//     }
-// };
-
-// ChemicalOutput::ChemicalOutput()
-// : pimpl(new Impl())
-// {}
-
-// ChemicalOutput::ChemicalOutput(const ChemicalSystem& system)
-// : pimpl(new Impl(system))
-// {}
-
-// ChemicalOutput::ChemicalOutput(const ReactionSystem& reactions)
-// : pimpl(new Impl(reactions))
-// {}
-
-// ChemicalOutput::~ChemicalOutput()
-// {}
-
-// auto ChemicalOutput::filename(std::string filename) -> void
-// {
-//     pimpl->filename = filename;
-//     pimpl->basename = filename.substr(0, filename.rfind('.'));
-//     pimpl->extension = filename.substr(filename.rfind('.'));
-// }
-
-// auto ChemicalOutput::filename() const -> std::string
-// {
-//     return pimpl->filename;
-// }
-
-// auto ChemicalOutput::suffix(std::string word) -> void
-// {
-//     pimpl->suffix = word;
-//     pimpl->filename = pimpl->basename + pimpl->suffix + pimpl->extension;
-// }
-
-// auto ChemicalOutput::suffix() const -> std::string
-// {
-//     return pimpl->suffix;
-// }
-
-// auto ChemicalOutput::basename() const -> std::string
-// {
-//     return pimpl->basename;
-// }
-
-// auto ChemicalOutput::extension() const -> std::string
-// {
-//     return pimpl->extension;
-// }
-
-// auto ChemicalOutput::add(std::string quantity) -> void
-// {
-//     add(quantity, quantity);
-// }
-
-// auto ChemicalOutput::add(std::string quantity, std::string label) -> void
-// {
-//     pimpl->headings.insert(pimpl->headings.end() - pimpl->attachments.size(), label);
-//     pimpl->data.push_back(quantity);
-// }
-
-// auto ChemicalOutput::attachments(std::vector<std::string> titles) -> void
-// {
-//     pimpl->headings.insert(pimpl->headings.end(), titles.begin(), titles.end());
-//     pimpl->attachments.insert(pimpl->attachments.end(), titles.begin(), titles.end());
-// }
-
-// auto ChemicalOutput::attach(int value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::attach(double value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::attach(std::string value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::precision(int val) -> void
-// {
-//     pimpl->precision = std::abs(val);
-// }
-
-// auto ChemicalOutput::scientific(bool enable) -> void
-// {
-//     pimpl->scientific = enable;
-// }
-
-// auto ChemicalOutput::terminal(bool enabled) -> void
-// {
-//     pimpl->terminal = enabled;
-// }
-
-// auto ChemicalOutput::quantities() const -> std::vector<std::string>
-// {
-//     return pimpl->data;
-// }
-
-// auto ChemicalOutput::headings() const -> std::vector<std::string>
-// {
-//     return pimpl->headings;
-// }
-
-// auto ChemicalOutput::open() -> void
-// {
-//     pimpl->open();
-// }
-
-// auto ChemicalOutput::update(const ChemicalState& state, double t) -> void
-// {
-//     pimpl->update(state, t);
-// }
-
-// auto ChemicalOutput::close() -> void
-// {
-//     pimpl->close();
-// }
-
-// ChemicalOutput::operator bool() const
-// {
-//     return pimpl->terminal || pimpl->filename.size();
-// }
-
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalOutput.hpp"
+
+// C++ includes
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// The identifier at the start of a binary output file.
+constexpr char filemagic[8] = {'R', 'K', 'T', 'C', 'O', 'L', 'S', '\0'};
+
+/// The version of the binary output file format.
+constexpr std::uint64_t fileversion = 1;
+
+} // namespace detail
+
+struct ChemicalOutput::Impl
+{
+    /// The options of the output.
+    ChemicalOutputOptions options;
+
+    /// The labels of the recorded columns.
+    Strings labels;
+
+    /// The functions evaluating the quantity of each column.
+    Vec<Quantity> quantities;
+
+    /// The rows recorded in memory that have not been handed to the writer thread yet.
+    Table table;
+
+    /// The columns in `table`, in the same order as `labels`.
+    Vec<TableColumn*> columns;
+
+    /// The total number of rows recorded since the output file was opened.
+    Index nrows = 0;
+
+    /// The output file.
+    std::ofstream file;
+
+    /// The background thread writing the blocks of rows to the output file.
+    std::thread writer;
+
+    /// The mutex guarding `pending`, `stopping` and `error`.
+    std::mutex mutex;
+
+    /// The condition variable used to notify the writer thread of a new block or the end of the output.
+    std::condition_variable wakeup;
+
+    /// The blocks of rows waiting to be written by the writer thread.
+    Deque<Table> pending;
+
+    /// The flag indicating the writer thread should return once all pending blocks are written.
+    bool stopping = false;
+
+    /// The exception thrown in the writer thread, if any, rethrown in the next call to flush or close.
+    std::exception_ptr error;
+
+    Impl()
+    {}
+
+    Impl(ChemicalOutputOptions const& options)
+    : options(options)
+    {}
+
+    ~Impl()
+    {
+        try { close(); } catch(...) {} // errors while writing the last rows cannot be reported in a destructor
+    }
+
+    auto setOptions(ChemicalOutputOptions const& opts) -> void
+    {
+        errorif(nrows > 0, "Cannot change the options of a ChemicalOutput object after rows have been recorded. Call ChemicalOutput::close first.");
+        errorif(opts.blocksize == 0, "Expecting a positive block size in ChemicalOutputOptions.");
+        options = opts;
+    }
+
+    auto add(String const& label, Quantity const& quantity) -> void
+    {
+        errorif(nrows > 0, "Cannot add the column `", label, "` to a ChemicalOutput object after rows have been recorded. Call ChemicalOutput::close first.");
+        errorif(!quantity, "Cannot add the column `", label, "` to a ChemicalOutput object with an uninitialized quantity function.");
+        errorif(contains(labels, label), "Cannot add the column `", label, "` to a ChemicalOutput object because there is already a column with this label.");
+        labels.push_back(label);
+        quantities.push_back(quantity);
+        columns.clear();
+    }
+
+    /// Create the columns of a new table of recorded rows.
+    auto resetTable() -> void
+    {
+        table = Table();
+        columns.clear();
+        for(auto const& label : labels)
+            columns.push_back(&table.column(label));
+    }
+
+    auto update(ChemicalProps const& props) -> void
+    {
+        errorif(labels.empty(), "Cannot record a row in a ChemicalOutput object without columns. Use ChemicalOutput::add first.");
+
+        if(nrows == 0 && options.filename.size())
+            open();
+
+        if(columns.size() != labels.size())
+            resetTable();
+
+        for(auto i = 0; i < quantities.size(); ++i)
+            columns[i]->appendFloat(double(quantities[i](props)));
+
+        ++nrows;
+
+        if(options.filename.size() && table.rows() >= options.blocksize)
+            flush();
+    }
+
+    /// Open the output file, write its header and start the writer thread.
+    auto open() -> void
+    {
+        file.open(options.filename, options.format == ChemicalOutputFormat::Binary ? std::ios::binary : std::ios::out);
+        errorif(!file, "Could not open file `", options.filename, "` for writing the output of chemical properties.");
+
+        if(options.format == ChemicalOutputFormat::Binary)
+        {
+            auto write = [&](auto const& value) { file.write(reinterpret_cast<char const*>(&value), sizeof(value)); };
+            file.write(detail::filemagic, sizeof(detail::filemagic));
+            write(detail::fileversion);
+            write(std::uint64_t(labels.size()));
+            for(auto const& label : labels)
+            {
+                write(std::uint64_t(label.size()));
+                file.write(label.data(), label.size());
+            }
+        }
+        else
+        {
+            for(auto i = 0; i < labels.size(); ++i)
+                file << (i == 0 ? "" : options.delimiter) << labels[i];
+            file << '\n';
+        }
+
+        stopping = false;
+        error = nullptr;
+        writer = std::thread([this] { work(); });
+    }
+
+    /// The main loop of the writer thread.
+    auto work() -> void
+    {
+        while(true)
+        {
+            Table block;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [&] { return !pending.empty() || stopping; });
+                if(pending.empty())
+                    return;
+                block = std::move(pending.front());
+                pending.pop_front();
+            }
+            try { write(block); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error)
+                    error = std::current_exception();
+            }
+        }
+    }
+
+    /// Write a block of rows to the output file.
+    auto write(Table const& block) -> void
+    {
+        Vec<Deque<double> const*> values;
+        for(auto const& label : labels)
+            values.push_back(&block.column(label).floats());
+
+        const auto rows = block.rows();
+
+        if(options.format == ChemicalOutputFormat::Binary)
+        {
+            const std::uint64_t numrows = rows;
+            file.write(reinterpret_cast<char const*>(&numrows), sizeof(numrows));
+            Vec<double> buffer(rows);
+            for(auto const* column : values)
+            {
+                std::copy(column->begin(), column->end(), buffer.begin());
+                file.write(reinterpret_cast<char const*>(buffer.data()), rows * sizeof(double));
+            }
+        }
+        else
+        {
+            const auto fmt = options.scientific ? "%.*e" : "%.*g";
+            char number[64];
+            String buffer;
+            for(auto i = 0; i < rows; ++i)
+            {
+                for(auto j = 0; j < values.size(); ++j)
+                {
+                    const auto length = std::snprintf(number, sizeof(number), fmt, options.precision, (*values[j])[i]);
+                    if(j > 0) buffer += options.delimiter;
+                    buffer.append(number, length);
+                }
+                buffer += '\n';
+            }
+            file.write(buffer.data(), buffer.size());
+        }
+
+        errorif(!file, "Could not write the output of chemical properties to file `", options.filename, "`.");
+    }
+
+    /// Rethrow the exception thrown in the writer thread, if any.
+    auto rethrow() -> void
+    {
+        std::exception_ptr err;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::swap(err, error);
+        }
+        if(err)
+            std::rethrow_exception(err);
+    }
+
+    auto flush() -> void
+    {
+        if(options.filename.empty() || !writer.joinable())
+            return;
+
+        rethrow();
+
+        if(table.rows() == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(std::move(table));
+        }
+        wakeup.notify_one();
+
+        resetTable();
+    }
+
+    auto close() -> void
+    {
+        if(writer.joinable())
+        {
+            flush();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wakeup.notify_one();
+
+            writer.join();
+            file.close();
+        }
+
+        nrows = 0;
+        resetTable();
+
+        rethrow();
+    }
+};
+
+ChemicalOutput::ChemicalOutput()
+: pimpl(new Impl())
+{}
+
+ChemicalOutput::ChemicalOutput(ChemicalOutputOptions const& options)
+: pimpl(new Impl())
+{
+    pimpl->setOptions(options);
+}
+
+ChemicalOutput::~ChemicalOutput()
+{}
+
+auto ChemicalOutput::setOptions(ChemicalOutputOptions const& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto ChemicalOutput::options() const -> ChemicalOutputOptions const&
+{
+    return pimpl->options;
+}
+
+auto ChemicalOutput::add(String const& label, Quantity const& quantity) -> void
+{
+    pimpl->add(label, quantity);
+}
+
+auto ChemicalOutput::labels() const -> Strings const&
+{
+    return pimpl->labels;
+}
+
+auto ChemicalOutput::update(ChemicalProps const& props) -> void
+{
+    pimpl->update(props);
+}
+
+auto ChemicalOutput::flush() -> void
+{
+    pimpl->flush();
+}
+
+auto ChemicalOutput::close() -> void
+{
+    pimpl->close();
+}
+
+auto ChemicalOutput::table() const -> Table const&
+{
+    return pimpl->table;
+}
+
+auto ChemicalOutput::rows() const -> Index
+{
+    return pimpl->nrows;
+}
+
+auto ChemicalOutput::loadBinary(String const& filename) -> Table
+{
+    std::ifstream file(filename, std::ios::binary);
+    errorif(!file, "Could not open file `", filename, "` for reading the output of chemical properties.");
+
+    auto read = [&](auto& value)
+    {
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        errorif(!file, "Could not read the output of chemical properties in file `", filename, "` because it is truncated or corrupted.");
+    };
+
+    char magic[sizeof(detail::filemagic)];
+    file.read(magic, sizeof(magic));
+    errorif(!file || std::memcmp(magic, detail::filemagic, sizeof(magic)) != 0, "The file `", filename, "` was not written by ChemicalOutput in binary format.");
+
+    std::uint64_t version = 0;
+    read(version);
+    errorif(version != detail::fileversion, "Could not read the output of chemical properties in file `", filename, "` with format version ", version, " because version ", detail::fileversion, " is expected.");
+
+    std::uint64_t numcols = 0;
+    read(numcols);
+
+    Table table;
+    Vec<TableColumn*> columns;
+    Strings labels(numcols);
+    for(auto& label : labels)
+    {
+        std::uint64_t length = 0;
+        read(length);
+        label.resize(length);
+        file.read(label.data(), length);
+        errorif(!file, "Could not read the output of chemical properties in file `", filename, "` because it is truncated or corrupted.");
+    }
+    for(auto const& label : labels)
+        columns.push_back(&table.column(label));
+
+    Vec<double> buffer;
+    std::uint64_t numrows = 0;
+    while(file.read(reinterpret_cast<char*>(&numrows), sizeof(numrows)))
+    {
+        buffer.resize(numrows);
+        for(auto* column : columns)
+        {
+            file.read(reinterpret_cast<char*>(buffer.data()), numrows * sizeof(double));
+            errorif(!file, "Could not read the output of chemical properties in file `", filename, "` because it is truncated or corrupted.");
+            for(auto const value : buffer)
+                column->appendFloat(value);
+        }
+    }
+
+    return table;
+}
+
+} // namespace Reaktoro
@@ -1,122 +1,135 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2024 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+
+/// The file formats supported by ChemicalOutput.
+enum class ChemicalOutputFormat
+{
+    Csv,    ///< The output is written as delimiter-separated text, with a header line with the column labels.
+    Binary, ///< The output is written in a binary columnar format that can be read back with ChemicalOutput::loadBinary.
+};
+
+/// The options for the output of chemical properties with ChemicalOutput.
+struct ChemicalOutputOptions
+{
+    /// The path to the output file (if empty, all rows are kept in memory and nothing is written).
+    String filename;
+
+    /// The format of the output file.
+    ChemicalOutputFormat format = ChemicalOutputFormat::Csv;
+
+    /// The number of rows recorded in memory before they are handed to the background writer thread.
+    Index blocksize = 100000;
+
+    /// The symbol used to separate column values in a row of the CSV output.
+    String delimiter = ",";
+
+    /// The precision used when writing floating-point values in the CSV output.
+    int precision = 6;
+
+    /// The boolean flag indicating if floating-point values should be written in scientific notation in the CSV output.
+    bool scientific = false;
+};
+
+/// Used to record selected chemical properties of a sequence of chemical states.
+/// Each call to @ref update appends a row to an in-memory columnar Table, with one
+/// column per quantity added with @ref add. Once @ref ChemicalOutputOptions::blocksize
+/// rows have been recorded, they are handed to a background thread that writes them
+/// to the output file, so that the caller does not wait for formatting and disk I/O.
+/// Quantities of aqueous solutions can be recorded with the memoized AqueousProps::compute, e.g.:
+/// ~~~{.cpp}
+/// output.add("pH", [](ChemicalProps const& props) { return AqueousProps::compute(props).pH(); });
+/// ~~~
+/// @note The methods of a ChemicalOutput object must be called from a single thread.
+class ChemicalOutput
+{
+public:
+    /// The function type for the evaluation of a quantity to be recorded.
+    using Quantity = Fn<real(ChemicalProps const& props)>;
+
+    /// Construct a default ChemicalOutput object.
+    ChemicalOutput();
+
+    /// Construct a ChemicalOutput object with given options.
+    explicit ChemicalOutput(ChemicalOutputOptions const& options);
+
+    /// Construct a copy of a ChemicalOutput object [deleted].
+    ChemicalOutput(ChemicalOutput const&) = delete;
+
+    /// Destroy this ChemicalOutput object, after writing its pending rows to the output file.
+    ~ChemicalOutput();
+
+    /// Assign a ChemicalOutput object to this [deleted].
+    auto operator=(ChemicalOutput const&) -> ChemicalOutput& = delete;
+
+    /// Set the options of this ChemicalOutput object.
+    /// @warning An exception is thrown if rows have already been recorded.
+    auto setOptions(ChemicalOutputOptions const& options) -> void;
+
+    /// Return the options of this ChemicalOutput object.
+    auto options() const -> ChemicalOutputOptions const&;
+
+    /// Add a quantity to be recorded in a new column.
+    /// @param label The label of the column
+    /// @param quantity The function that evaluates the quantity from the chemical properties
+    /// @warning An exception is thrown if rows have already been recorded.
+    auto add(String const& label, Quantity const& quantity) -> void;
+
+    /// Return the labels of the recorded columns.
+    auto labels() const -> Strings const&;
+
+    /// Record a new row with the quantities evaluated from given chemical properties.
+    auto update(ChemicalProps const& props) -> void;
+
+    /// Hand the rows recorded in memory to the background writer thread without waiting for them to be written.
+    /// This method does nothing if no output file has been specified.
+    auto flush() -> void;
+
+    /// Write all pending rows to the output file and close it.
+    /// A subsequent call to @ref update starts a new output file, overwriting the previous one.
+    /// If no output file has been specified, the rows recorded in memory are discarded instead.
+    /// In both cases, columns can be added and options changed again after this call.
+    auto close() -> void;
 
-// #pragma once
+    /// Return the rows recorded in memory that have not been handed to the writer thread yet.
+    /// If no output file has been specified, this contains all recorded rows.
+    auto table() const -> Table const&;
 
-// // C++ includes
-// #include <memory>
-// #include <vector>
-// #include <sstream>
-// #include <string>
+    /// Return the total number of rows recorded since the output file was opened.
+    auto rows() const -> Index;
 
-// namespace Reaktoro {
+    /// Return a Table object with the contents of a file written with ChemicalOutputFormat::Binary.
+    static auto loadBinary(String const& filename) -> Table;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
 
-// // Forward declarations
-// class ChemicalState;
-// class ChemicalSystem;
-// class ReactionSystem;
-// class StringList;
-
-// /// A type used to output sequence of chemical states to a file or terminal.
-// class ChemicalOutput
-// {
-// public:
-//     /// Construct a default ChemicalOutput instance.
-//     ChemicalOutput();
-
-//     /// Construct a ChemicalOutput instance with given ChemicalSystem instance.
-//     explicit ChemicalOutput(const ChemicalSystem& system);
-
-//     /// Construct a ChemicalOutput instance with given ReactionSystem instance.
-//     explicit ChemicalOutput(const ReactionSystem& reactions);
-
-//     /// Destroy this ChemicalOutput instance.
-//     virtual ~ChemicalOutput();
-
-//     /// Set the name of the output file.
-//     auto filename(std::string filename) -> void;
-
-//     /// Return the name of the output file.
-//     auto filename() const -> std::string;
-
-//     /// Set a sufix word to the output file name.
-//     auto suffix(std::string name) -> void;
-
-//     /// Return the suffix word of the output file name.
-//     auto suffix() const -> std::string;
-
-//     /// Return the base name of output file name.
-//     auto basename() const -> std::string;
-
-//     /// Return the extension name of output file name.
-//     auto extension() const -> std::string;
-
-//     /// Add a quantity to be output.
-//     /// @param quantity The quantity name.
-//     auto add(std::string quantity) -> void;
-
-//     /// Add a quantity to be output.
-//     /// @param quantity The quantity name.
-//     /// @param label The label to be used in the headings.
-//     auto add(std::string quantity, std::string label) -> void;
-
-//     /// Set the titles of extra columns in the output file.
-//     auto attachments(std::vector<std::string> titles) -> void;
-
-//     /// Attach value to extra column data in the output file.
-//     auto attach(int value) -> void;
-
-//     /// Attach extra column data in the output file.
-//     auto attach(double value) -> void;
-
-//     /// Attach extra column data in the output file.
-//     auto attach(std::string value) -> void;
-
-//     /// Set the floating-point precision in the output.
-//     auto precision(int val) -> void;
-
-//     /// Enable or disable output in scientific format.
-//     auto scientific(bool enable) -> void;
-
-//     /// Enable or disable the output to the terminal.
-//     auto terminal(bool enabled) -> void;
-
-//     /// Return the name of the quantities in the output file.
-//     auto quantities() const -> std::vector<std::string>;
-
-//     /// Return the headings of the output file.
-//     auto headings() const -> std::vector<std::string>;
-
-//     /// Open the output file.
-//     auto open() -> void;
-
-//     /// Update the output with a new chemical state and its tag.
-//     auto update(const ChemicalState& state, double t) -> void;
-
-//     /// Close the output file.
-//     auto close() -> void;
-
-//     /// Convert this ChemicalOutput instance to bool.
-//     operator bool() const;
-
-// private:
-//     struct Impl;
-
-//     std::shared_ptr<Impl> pimpl;
-// };
-
-// } // namespace Reaktoro
+} // namespace Reaktoro
@@ -0,0 +1,57 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalOutput.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+using namespace Reaktoro;
+
+void exportChemicalOutput(py::module& m)
+{
+    py::enum_<ChemicalOutputFormat>(m, "ChemicalOutputFormat")
+        .value("Csv", ChemicalOutputFormat::Csv)
+        .value("Binary", ChemicalOutputFormat::Binary)
+        ;
+
+    py::class_<ChemicalOutputOptions>(m, "ChemicalOutputOptions")
+        .def(py::init<>())
+        .def_readwrite("filename", &ChemicalOutputOptions::filename, "The path to the output file (if empty, all rows are kept in memory and nothing is written).")
+        .def_readwrite("format", &ChemicalOutputOptions::format, "The format of the output file.")
+        .def_readwrite("blocksize", &ChemicalOutputOptions::blocksize, "The number of rows recorded in memory before they are handed to the background writer thread.")
+        .def_readwrite("delimiter", &ChemicalOutputOptions::delimiter, "The symbol used to separate column values in a row of the CSV output.")
+        .def_readwrite("precision", &ChemicalOutputOptions::precision, "The precision used when writing floating-point values in the CSV output.")
+        .def_readwrite("scientific", &ChemicalOutputOptions::scientific, "The boolean flag indicating if floating-point values should be written in scientific notation in the CSV output.")
+        ;
+
+    py::class_<ChemicalOutput>(m, "ChemicalOutput")
+        .def(py::init<>())
+        .def(py::init<ChemicalOutputOptions const&>())
+        .def("setOptions", &ChemicalOutput::setOptions, "Set the options of this ChemicalOutput object.")
+        .def("options", &ChemicalOutput::options, return_internal_ref, "Return the options of this ChemicalOutput object.")
+        .def("add", &ChemicalOutput::add, "Add a quantity to be recorded in a new column.")
+        .def("labels", &ChemicalOutput::labels, return_internal_ref, "Return the labels of the recorded columns.")
+        .def("update", &ChemicalOutput::update, "Record a new row with the quantities evaluated from given chemical properties.")
+        .def("flush", &ChemicalOutput::flush, "Hand the rows recorded in memory to the background writer thread without waiting for them to be written.")
+        .def("close", &ChemicalOutput::close, "Write all pending rows to the output file and close it.")
+        .def("table", &ChemicalOutput::table, return_internal_ref, "Return the rows recorded in memory that have not been handed to the writer thread yet.")
+        .def("rows", &ChemicalOutput::rows, "Return the total number of rows recorded since the output file was opened.")
+        .def_static("loadBinary", &ChemicalOutput::loadBinary, "Return a Table object with the contents of a file written with ChemicalOutputFormat.Binary.")
+        ;
+}
@@ -0,0 +1,157 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalOutput.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
+
+TEST_CASE("Testing ChemicalOutput class", "[ChemicalOutput]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    ChemicalState state(system);
+    state.setTemperature(300.0);
+    state.setPressure(1.0e5);
+    state.setSpeciesAmount("H2O(aq)", 55.0, "mol");
+
+    ChemicalProps props(system);
+
+    auto configure = [&](ChemicalOutput& output)
+    {
+        output.add("T", [](ChemicalProps const& props) { return props.temperature(); });
+        output.add("P", [](ChemicalProps const& props) { return props.pressure(); });
+        output.add("n(H2O)", [](ChemicalProps const& props) { return props.speciesAmount("H2O(aq)"); });
+    };
+
+    const auto numrows = 25;
+
+    auto record = [&](ChemicalOutput& output)
+    {
+        for(auto i = 0; i < numrows; ++i)
+        {
+            state.setTemperature(300.0 + i);
+            props.update(state);
+            output.update(props);
+        }
+    };
+
+    SECTION("Checking the recording of rows in memory")
+    {
+        ChemicalOutput output;
+        configure(output);
+
+        CHECK( output.labels() == Strings{"T", "P", "n(H2O)"} );
+        CHECK_THROWS( output.add("T", [](ChemicalProps const& props) { return props.temperature(); }) );
+
+        record(output);
+
+        CHECK( output.rows() == numrows );
+        CHECK( output.table().rows() == numrows );
+        CHECK( output.table().cols() == 3 );
+        CHECK( output.table()["T"][0] == 300.0 );
+        CHECK( output.table()["T"][numrows - 1] == 300.0 + numrows - 1 );
+        CHECK( output.table()["n(H2O)"][0] == Approx(55.0) );
+
+        CHECK_THROWS( output.add("V", [](ChemicalProps const& props) { return props.volume(); }) );
+
+        output.close();
+
+        CHECK( output.rows() == 0 );
+        CHECK( output.table().rows() == 0 );
+
+        CHECK_NOTHROW( output.add("V", [](ChemicalProps const& props) { return props.volume(); }) );
+
+        record(output);
+
+        CHECK( output.rows() == numrows );
+        CHECK( output.table().rows() == numrows );
+        CHECK( output.table().cols() == 4 );
+        CHECK( output.table()["T"][0] == 300.0 );
+        CHECK( output.table()["V"][numrows - 1] == Approx(props.volume()) );
+    }
+
+    SECTION("Checking the output of rows in CSV format")
+    {
+        ChemicalOutputOptions options;
+        options.filename = "chemical-output.csv";
+        options.blocksize = 10;
+
+        ChemicalOutput output(options);
+        configure(output);
+
+        record(output);
+
+        CHECK( output.table().rows() == numrows % options.blocksize );
+
+        output.close();
+
+        std::ifstream file(options.filename);
+        String line;
+        Strings lines;
+        while(std::getline(file, line))
+            lines.push_back(line);
+        file.close();
+
+        std::remove(options.filename.c_str());
+
+        REQUIRE( lines.size() == numrows + 1 );
+        CHECK( lines[0] == "T,P,n(H2O)" );
+        CHECK( lines[1] == "300,100000,55" );
+        CHECK( lines[numrows] == "324,100000,55" );
+    }
+
+    SECTION("Checking the output of rows in binary format")
+    {
+        ChemicalOutputOptions options;
+        options.filename = "chemical-output.bin";
+        options.format = ChemicalOutputFormat::Binary;
+        options.blocksize = 7;
+
+        ChemicalOutput output(options);
+        configure(output);
+
+        record(output);
+
+        output.close();
+
+        const auto table = ChemicalOutput::loadBinary(options.filename);
+
+        std::remove(options.filename.c_str());
+
+        REQUIRE( table.rows() == numrows );
+        REQUIRE( table.cols() == 3 );
+
+        for(auto i = 0; i < numrows; ++i)
+        {
+            CHECK( table["T"][i] == 300.0 + i );
+            CHECK( table["P"][i] == 1.0e5 );
+            CHECK( table["n(H2O)"][i] == Approx(55.0) );
+        }
+    }
+}
@@ -27,6 +27,8 @@ using namespace tabulate;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
@@ -83,6 +85,8 @@ auto ChemicalProps::update(ChemicalState const& state) -> void
 
 auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
+    RKT_TRACE_COUNT("ChemicalProps::evaluations", 1);
+
     mstateid += 1;
 
     assert(T0 >= 0.0);
@@ -92,12 +96,14 @@ auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -
     T = T0;
     P = P0;
 
+    updateStandardThermoProps();
+
     auto offset = 0;
     for(auto const& [i, phase] : enumerate(msystem.phases()))
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).update(T, P, np, m_extra);
+        phasePropsRef(i)._update<false, false>(T, P, np, m_extra);
         offset += size;
     }
 }
@@ -133,16 +139,42 @@ auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef
     T = T0;
     P = P0;
 
+    updateStandardThermoProps();
+
     auto offset = 0;
     for(auto const& [i, phase] : enumerate(msystem.phases()))
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).updateIdeal(T, P, np, m_extra);
+        phasePropsRef(i)._update<true, false>(T, P, np, m_extra);
         offset += size;
     }
 }
 
+auto ChemicalProps::updateStandardThermoProps() -> void
+{
+    auto& cache = msystem.standardThermoPropsCache();
+
+    if(cache.get(T, P, G0, H0, V0, VT0, VP0, Cp0))
+        return;
+
+    const auto start = time();
+
+    StandardThermoProps aux;
+    for(auto const& [i, species] : enumerate(msystem.species()))
+    {
+        aux = species.standardThermoProps(T, P);
+        G0[i]  = aux.G0;
+        H0[i]  = aux.H0;
+        V0[i]  = aux.V0;
+        VT0[i] = aux.VT0;
+        VP0[i] = aux.VP0;
+        Cp0[i] = aux.Cp0;
+    }
+
+    cache.set(T, P, G0, H0, V0, VT0, VP0, Cp0, elapsed(start));
+}
+
 auto ChemicalProps::serialize(ArrayStream<real>& stream) const -> void
 {
     stream.from(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
@@ -568,6 +568,9 @@ private:
     /// Return a mutable view to the chemical properties of a phase with given index.
     /// @param phase The name or index of the phase in the system.
     auto phasePropsRef(StringOrIndex phase) -> ChemicalPropsPhaseRef;
+
+    /// Update the standard thermodynamic properties of the species at the current temperature and pressure, using the cache of the system.
+    auto updateStandardThermoProps() -> void;
 };
 
 /// Output a ChemicalProps object to an output stream.
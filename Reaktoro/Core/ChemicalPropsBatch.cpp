@@ -0,0 +1,361 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalPropsBatch.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+
+namespace Reaktoro {
+
+ChemicalPropsBatch::ChemicalPropsBatch()
+{}
+
+ChemicalPropsBatch::ChemicalPropsBatch(ChemicalSystem const& system)
+: msystem(system)
+{
+    resize(0);
+}
+
+auto ChemicalPropsBatch::resize(Index numcells) -> void
+{
+    const auto N = msystem.species().size();
+    const auto K = msystem.phases().size();
+
+    T.resize(numcells);
+    P.resize(numcells);
+    n.resize(numcells, N);
+    nsum.resize(numcells, K);
+    msum.resize(numcells, K);
+    x.resize(numcells, N);
+    G0.resize(numcells, N);
+    H0.resize(numcells, N);
+    V0.resize(numcells, N);
+    VT0.resize(numcells, N);
+    VP0.resize(numcells, N);
+    Cp0.resize(numcells, N);
+    Vx.resize(numcells, K);
+    VxT.resize(numcells, K);
+    VxP.resize(numcells, K);
+    Vxi.resize(numcells, N);
+    Gx.resize(numcells, K);
+    Hx.resize(numcells, K);
+    Cpx.resize(numcells, K);
+    ln_g.resize(numcells, N);
+    ln_a.resize(numcells, N);
+    u.resize(numcells, N);
+}
+
+auto ChemicalPropsBatch::update(Vec<ChemicalState> const& states) -> void
+{
+    const auto numcells = states.size();
+    const auto N = msystem.species().size();
+
+    ArrayXd Tcells(numcells);
+    ArrayXd Pcells(numcells);
+    ArrayXXd ncells(numcells, N);
+
+    for(auto i = 0; i < numcells; ++i)
+    {
+        Tcells[i] = states[i].temperature().val();
+        Pcells[i] = states[i].pressure().val();
+        ncells.row(i) = states[i].speciesAmounts().cast<double>().transpose();
+    }
+
+    update(Tcells, Pcells, ncells);
+}
+
+auto ChemicalPropsBatch::update(ArrayXdConstRef T0, ArrayXdConstRef P0, ArrayXXdConstRef n0) -> void
+{
+    const auto numcells = T0.size();
+
+    errorif(P0.size() != numcells, "Expecting as many pressures as temperatures (", numcells, ") in ChemicalPropsBatch::update but got ", P0.size(), ".");
+    errorif(n0.rows() != numcells, "Expecting as many rows of species amounts as temperatures (", numcells, ") in ChemicalPropsBatch::update but got ", n0.rows(), ".");
+    errorif(n0.cols() != msystem.species().size(), "Expecting species amounts with ", msystem.species().size(), " columns in ChemicalPropsBatch::update but got ", n0.cols(), ".");
+
+    assert((T0 >= 0.0).all());
+    assert((P0 >= 0.0).all());
+    assert((n0 >= 0.0).all());
+
+    resize(numcells);
+
+    T = T0;
+    P = P0;
+    n = n0;
+
+    // Compute the amounts, masses and mole fractions of the phases in all cells at once
+    auto offset = 0;
+    for(auto k = 0; k < msystem.phases().size(); ++k)
+    {
+        auto const& phase = msystem.phase(k);
+        const auto size = phase.species().size();
+
+        const auto np = n.middleCols(offset, size);
+        auto xp = x.middleCols(offset, size);
+
+        nsum.col(k) = np.rowwise().sum();
+        msum.col(k) = (np.matrix() * phase.speciesMolarMasses().matrix()).array();
+
+        xp = np.colwise() / nsum.col(k);
+
+        // Set the mole fractions in the cells where the phase does not exist
+        for(auto i = 0; i < numcells; ++i)
+            if(nsum(i, k) == 0.0)
+                xp.row(i).fill(size == 1 ? 1.0 : 0.0);
+
+        // Ensure there are no zero mole fractions
+        errorif((xp == 0.0).any(), "Could not compute the chemical properties of phase ",
+            phase.name(), " because it has one or more species with zero amounts in one or more cells.");
+
+        offset += size;
+    }
+
+    const auto icells = updateStandardThermoProps();
+
+    updateActivityProps(icells);
+
+    // Compute the chemical potentials of the species in all cells at once
+    const auto R = universalGasConstant;
+    u = G0 + ln_a.colwise() * (R*T);
+}
+
+auto ChemicalPropsBatch::updateStandardThermoProps() -> Indices
+{
+    const auto numcells = T.size();
+
+    // Sort the cells by temperature and pressure so that cells with same temperature and pressure are consecutive
+    Indices icells(numcells);
+    std::iota(icells.begin(), icells.end(), 0);
+    std::sort(icells.begin(), icells.end(), [&](Index a, Index b)
+    {
+        return T[a] < T[b] || (T[a] == T[b] && P[a] < P[b]);
+    });
+
+    auto const& species = msystem.species();
+    const auto N = species.size();
+
+    mnumpairs = 0;
+
+    StandardThermoProps aux;
+    for(Index begin = 0; begin < numcells;)
+    {
+        const auto i = icells[begin];
+
+        // Find the end of the sequence of cells with same temperature and pressure as cell i
+        auto end = begin + 1;
+        while(end < numcells && T[icells[end]] == T[i] && P[icells[end]] == P[i])
+            ++end;
+
+        // Compute the standard thermodynamic properties of the species only once for all these cells
+        for(auto j = 0; j < N; ++j)
+        {
+            aux = species[j].standardThermoProps(T[i], P[i]);
+            for(auto k = begin; k < end; ++k)
+            {
+                const auto icell = icells[k];
+                G0(icell, j)  = aux.G0.val();
+                H0(icell, j)  = aux.H0.val();
+                V0(icell, j)  = aux.V0.val();
+                VT0(icell, j) = aux.VT0.val();
+                VP0(icell, j) = aux.VP0.val();
+                Cp0(icell, j) = aux.Cp0.val();
+            }
+        }
+
+        ++mnumpairs;
+        begin = end;
+    }
+
+    return icells;
+}
+
+auto ChemicalPropsBatch::updateActivityProps(Indices const& icells) -> void
+{
+    auto const& phases = msystem.phases();
+    const auto K = phases.size();
+
+    // The offsets of the species of each phase
+    Indices offsets(K, 0);
+    for(auto k = 1; k < K; ++k)
+        offsets[k] = offsets[k - 1] + phases[k - 1].species().size();
+
+    // The buffers of the arguments and activity properties of each phase, allocated once and reused for all cells
+    Vec<ArrayXr> xp(K);
+    Vec<ActivityProps> aprops(K);
+    for(auto k = 0; k < K; ++k)
+    {
+        xp[k].resize(phases[k].species().size());
+        aprops[k] = ActivityProps::create(phases[k].species().size());
+    }
+
+    real Tcell, Pcell;
+
+    for(auto icell : icells)
+    {
+        Tcell = T[icell];
+        Pcell = P[icell];
+
+        for(auto k = 0; k < K; ++k)
+        {
+            const auto offset = offsets[k];
+            const auto size = phases[k].species().size();
+
+            auto& ap = aprops[k];
+
+            ActivityPropsRef aref{ ap.Vx, ap.VxT, ap.VxP, ap.Vxi, ap.Gx, ap.Hx, ap.Cpx, ap.ln_g, ap.ln_a, ap.som, m_extra };
+
+            xp[k] = x.row(icell).segment(offset, size).transpose();
+
+            ActivityModelArgs args{ Tcell, Pcell, xp[k] };
+
+            const ActivityModel& activity_model = phases[k].activityModel(); // IMPORTANT: Use `const ActivityModel&` here instead of `ActivityModel`, otherwise a new model is constructed without cache, and so memoization will not take effect.
+
+            if(nsum(icell, k) == 0.0) aref = 0.0;
+            else activity_model(aref, args);
+
+            Vx(icell, k)  = ap.Vx.val();
+            VxT(icell, k) = ap.VxT.val();
+            VxP(icell, k) = ap.VxP.val();
+            Gx(icell, k)  = ap.Gx.val();
+            Hx(icell, k)  = ap.Hx.val();
+            Cpx(icell, k) = ap.Cpx.val();
+
+            Vxi.row(icell).segment(offset, size)  = ap.Vxi.cast<double>().transpose();
+            ln_g.row(icell).segment(offset, size) = ap.ln_g.cast<double>().transpose();
+            ln_a.row(icell).segment(offset, size) = ap.ln_a.cast<double>().transpose();
+        }
+    }
+}
+
+auto ChemicalPropsBatch::system() const -> ChemicalSystem const&
+{
+    return msystem;
+}
+
+auto ChemicalPropsBatch::numCells() const -> Index
+{
+    return T.size();
+}
+
+auto ChemicalPropsBatch::props(Index icell) const -> ChemicalProps
+{
+    errorif(icell >= numCells(), "Expecting a cell index smaller than ", numCells(), " in ChemicalPropsBatch::props but got ", icell, ".");
+
+    const auto K = msystem.phases().size();
+
+    const auto row = [&](ArrayXXd const& a) -> ArrayXd { return a.row(icell).transpose(); };
+
+    const ArrayXd Ts = ArrayXd::Constant(K, T[icell]);
+    const ArrayXd Ps = ArrayXd::Constant(K, P[icell]);
+
+    const ArrayStream<double> stream(T[icell], P[icell], row(n), Ts, Ps, row(nsum), row(msum), row(x), row(G0), row(H0), row(V0), row(VT0), row(VP0), row(Cp0),
+        row(Vx), row(VxT), row(VxP), row(Vxi), row(Gx), row(Hx), row(Cpx), row(ln_g), row(ln_a), row(u));
+
+    ChemicalProps props(msystem);
+    props.update(stream.data());
+    return props;
+}
+
+auto ChemicalPropsBatch::temperatures() const -> ArrayXdConstRef
+{
+    return T;
+}
+
+auto ChemicalPropsBatch::pressures() const -> ArrayXdConstRef
+{
+    return P;
+}
+
+auto ChemicalPropsBatch::speciesAmounts() const -> ArrayXXdConstRef
+{
+    return n;
+}
+
+auto ChemicalPropsBatch::speciesMoleFractions() const -> ArrayXXdConstRef
+{
+    return x;
+}
+
+auto ChemicalPropsBatch::speciesActivityCoefficientsLn() const -> ArrayXXdConstRef
+{
+    return ln_g;
+}
+
+auto ChemicalPropsBatch::speciesActivitiesLn() const -> ArrayXXdConstRef
+{
+    return ln_a;
+}
+
+auto ChemicalPropsBatch::speciesChemicalPotentials() const -> ArrayXXdConstRef
+{
+    return u;
+}
+
+auto ChemicalPropsBatch::speciesStandardVolumes() const -> ArrayXXdConstRef
+{
+    return V0;
+}
+
+auto ChemicalPropsBatch::speciesStandardVolumesT() const -> ArrayXXdConstRef
+{
+    return VT0;
+}
+
+auto ChemicalPropsBatch::speciesStandardVolumesP() const -> ArrayXXdConstRef
+{
+    return VP0;
+}
+
+auto ChemicalPropsBatch::speciesStandardGibbsEnergies() const -> ArrayXXdConstRef
+{
+    return G0;
+}
+
+auto ChemicalPropsBatch::speciesStandardEnthalpies() const -> ArrayXXdConstRef
+{
+    return H0;
+}
+
+auto ChemicalPropsBatch::speciesStandardHeatCapacitiesConstP() const -> ArrayXXdConstRef
+{
+    return Cp0;
+}
+
+auto ChemicalPropsBatch::phaseAmounts() const -> ArrayXXdConstRef
+{
+    return nsum;
+}
+
+auto ChemicalPropsBatch::phaseMasses() const -> ArrayXXdConstRef
+{
+    return msum;
+}
+
+auto ChemicalPropsBatch::numTemperaturePressurePairs() const -> Index
+{
+    return mnumpairs;
+}
+
+} // namespace Reaktoro
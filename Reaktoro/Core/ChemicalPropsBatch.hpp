@@ -0,0 +1,206 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+
+/// The class that computes chemical properties of a chemical system in many cells at once.
+/// The properties are stored in structure-of-arrays layout, with one row per cell and one
+/// column per species (or phase), so that each property of a species is contiguous
+/// across cells. The standard thermodynamic properties of the species are evaluated once
+/// for each distinct pair of temperature and pressure among the cells (e.g., only once in
+/// isothermal and isobaric simulations), and the properties derived from them (mole
+/// fractions, phase amounts and masses, chemical potentials) are computed in vectorized
+/// operations over all cells. The activity models of the phases are evaluated cell by cell,
+/// with cells of same temperature and pressure visited in sequence to benefit from their
+/// memoized temperature-pressure dependent parameters.
+/// @note The properties are stored as double values, without derivatives with respect to
+/// temperature, pressure or species amounts. Use ChemicalProps when these are needed.
+class ChemicalPropsBatch
+{
+public:
+    /// Construct a default uninitialized ChemicalPropsBatch object.
+    ChemicalPropsBatch();
+
+    /// Construct an uninitialized ChemicalPropsBatch object with given chemical system.
+    explicit ChemicalPropsBatch(ChemicalSystem const& system);
+
+    /// Update the chemical properties of the system in each cell.
+    /// @param states The chemical states of the system in the cells
+    auto update(Vec<ChemicalState> const& states) -> void;
+
+    /// Update the chemical properties of the system in each cell.
+    /// @param T The temperatures in the cells (in K)
+    /// @param P The pressures in the cells (in Pa)
+    /// @param n The amounts of the species in the cells (in mol), with one row per cell
+    auto update(ArrayXdConstRef T, ArrayXdConstRef P, ArrayXXdConstRef n) -> void;
+
+    /// Return the chemical system associated with these chemical properties.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Return the number of cells.
+    auto numCells() const -> Index;
+
+    /// Return the chemical properties of the system in a cell.
+    auto props(Index icell) const -> ChemicalProps;
+
+    /// Return the temperatures in the cells (in K).
+    auto temperatures() const -> ArrayXdConstRef;
+
+    /// Return the pressures in the cells (in Pa).
+    auto pressures() const -> ArrayXdConstRef;
+
+    /// Return the amounts of the species in the cells (in mol).
+    auto speciesAmounts() const -> ArrayXXdConstRef;
+
+    /// Return the mole fractions of the species in the cells.
+    auto speciesMoleFractions() const -> ArrayXXdConstRef;
+
+    /// Return the ln activity coefficients of the species in the cells.
+    auto speciesActivityCoefficientsLn() const -> ArrayXXdConstRef;
+
+    /// Return the ln activities of the species in the cells.
+    auto speciesActivitiesLn() const -> ArrayXXdConstRef;
+
+    /// Return the chemical potentials of the species in the cells (in J/mol).
+    auto speciesChemicalPotentials() const -> ArrayXXdConstRef;
+
+    /// Return the standard partial molar volumes of the species in the cells (in m³/mol).
+    auto speciesStandardVolumes() const -> ArrayXXdConstRef;
+
+    /// Return the temperature derivatives of the standard partial molar volumes of the species in the cells (in m³/(mol·K)).
+    auto speciesStandardVolumesT() const -> ArrayXXdConstRef;
+
+    /// Return the pressure derivatives of the standard partial molar volumes of the species in the cells (in m³/(mol·Pa)).
+    auto speciesStandardVolumesP() const -> ArrayXXdConstRef;
+
+    /// Return the standard partial molar Gibbs energies of formation of the species in the cells (in J/mol).
+    auto speciesStandardGibbsEnergies() const -> ArrayXXdConstRef;
+
+    /// Return the standard partial molar enthalpies of formation of the species in the cells (in J/mol).
+    auto speciesStandardEnthalpies() const -> ArrayXXdConstRef;
+
+    /// Return the standard partial molar isobaric heat capacities of the species in the cells (in J/(mol·K)).
+    auto speciesStandardHeatCapacitiesConstP() const -> ArrayXXdConstRef;
+
+    /// Return the amounts of the phases in the cells (in mol).
+    auto phaseAmounts() const -> ArrayXXdConstRef;
+
+    /// Return the masses of the phases in the cells (in kg).
+    auto phaseMasses() const -> ArrayXXdConstRef;
+
+    /// Return the number of distinct pairs of temperature and pressure among the cells in the last update.
+    auto numTemperaturePressurePairs() const -> Index;
+
+private:
+    /// The chemical system associated with these chemical properties.
+    ChemicalSystem msystem;
+
+    /// The number of distinct pairs of temperature and pressure among the cells in the last update.
+    Index mnumpairs = 0;
+
+    /// The temperatures in the cells (in K).
+    ArrayXd T;
+
+    /// The pressures in the cells (in Pa).
+    ArrayXd P;
+
+    /// The amounts of each species in the cells (in mol).
+    ArrayXXd n;
+
+    /// The sum of species amounts in each phase in the cells (in mol).
+    ArrayXXd nsum;
+
+    /// The sum of species masses in each phase in the cells (in kg).
+    ArrayXXd msum;
+
+    /// The mole fractions of the species in the cells (in mol/mol).
+    ArrayXXd x;
+
+    /// The standard molar Gibbs energies of formation of the species in the cells (in J/mol)
+    ArrayXXd G0;
+
+    /// The standard molar enthalpies of formation of the species in the cells (in J/mol)
+    ArrayXXd H0;
+
+    /// The standard molar volumes of the species in the cells (in m³/mol)
+    ArrayXXd V0;
+
+    /// The temperature derivative of the standard molar volumes of the species in the cells (in m³/(mol·K)).
+    ArrayXXd VT0;
+
+    /// The pressure derivative of the standard molar volumes of the species in the cells (in m³/(mol·Pa)).
+    ArrayXXd VP0;
+
+    /// The standard molar isobaric heat capacities of the species in the cells (in J/(mol·K))
+    ArrayXXd Cp0;
+
+    /// The corrective molar volumes of the phases in the cells (in m³/mol).
+    ArrayXXd Vx;
+
+    /// The derivatives of the corrective molar volumes of the phases with respect to temperature in the cells (in m³/(mol·K)).
+    ArrayXXd VxT;
+
+    /// The derivatives of the corrective molar volumes of the phases with respect to pressure in the cells (in m³/(mol·Pa)).
+    ArrayXXd VxP;
+
+    /// The derivatives of the corrective molar volumes of the phases with respect to species mole fractions in the cells (in m³/mol).
+    ArrayXXd Vxi;
+
+    /// The corrective molar Gibbs energies of the phases in the cells (in J/mol).
+    ArrayXXd Gx;
+
+    /// The corrective molar enthalpies of the phases in the cells (in J/mol).
+    ArrayXXd Hx;
+
+    /// The corrective molar isobaric heat capacities of the phases in the cells (in J/(mol·K)).
+    ArrayXXd Cpx;
+
+    /// The activity coefficients (natural log) of the species in the cells.
+    ArrayXXd ln_g;
+
+    /// The activities (natural log) of the species in the cells.
+    ArrayXXd ln_a;
+
+    /// The chemical potentials of the species in the cells (in J/mol).
+    ArrayXXd u;
+
+    /// The extra data produced by the activity models of the phases.
+    Map<String, Any> m_extra;
+
+    /// Resize the property arrays for a given number of cells.
+    auto resize(Index numcells) -> void;
+
+    /// Update the standard thermodynamic properties of the species in the cells.
+    /// @return The indices of the cells sorted by temperature and pressure.
+    auto updateStandardThermoProps() -> Indices;
+
+    /// Update the activity properties of the phases in the cells, visited in given order.
+    auto updateActivityProps(Indices const& icells) -> void;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,54 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsBatch.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+using namespace Reaktoro;
+
+void exportChemicalPropsBatch(py::module& m)
+{
+    py::class_<ChemicalPropsBatch>(m, "ChemicalPropsBatch")
+        .def(py::init<>())
+        .def(py::init<ChemicalSystem const&>())
+        .def("update", py::overload_cast<Vec<ChemicalState> const&>(&ChemicalPropsBatch::update), "Update the chemical properties of the system in each cell.")
+        .def("update", py::overload_cast<ArrayXdConstRef, ArrayXdConstRef, ArrayXXdConstRef>(&ChemicalPropsBatch::update), "Update the chemical properties of the system in each cell.")
+        .def("system", &ChemicalPropsBatch::system, return_internal_ref, "Return the chemical system associated with these chemical properties.")
+        .def("numCells", &ChemicalPropsBatch::numCells, "Return the number of cells.")
+        .def("props", &ChemicalPropsBatch::props, "Return the chemical properties of the system in a cell.")
+        .def("temperatures", &ChemicalPropsBatch::temperatures, return_internal_ref, "Return the temperatures in the cells (in K).")
+        .def("pressures", &ChemicalPropsBatch::pressures, return_internal_ref, "Return the pressures in the cells (in Pa).")
+        .def("speciesAmounts", &ChemicalPropsBatch::speciesAmounts, return_internal_ref, "Return the amounts of the species in the cells (in mol).")
+        .def("speciesMoleFractions", &ChemicalPropsBatch::speciesMoleFractions, return_internal_ref, "Return the mole fractions of the species in the cells.")
+        .def("speciesActivityCoefficientsLn", &ChemicalPropsBatch::speciesActivityCoefficientsLn, return_internal_ref, "Return the ln activity coefficients of the species in the cells.")
+        .def("speciesActivitiesLn", &ChemicalPropsBatch::speciesActivitiesLn, return_internal_ref, "Return the ln activities of the species in the cells.")
+        .def("speciesChemicalPotentials", &ChemicalPropsBatch::speciesChemicalPotentials, return_internal_ref, "Return the chemical potentials of the species in the cells (in J/mol).")
+        .def("speciesStandardVolumes", &ChemicalPropsBatch::speciesStandardVolumes, return_internal_ref, "Return the standard partial molar volumes of the species in the cells (in m³/mol).")
+        .def("speciesStandardVolumesT", &ChemicalPropsBatch::speciesStandardVolumesT, return_internal_ref, "Return the temperature derivatives of the standard partial molar volumes of the species in the cells (in m³/(mol·K)).")
+        .def("speciesStandardVolumesP", &ChemicalPropsBatch::speciesStandardVolumesP, return_internal_ref, "Return the pressure derivatives of the standard partial molar volumes of the species in the cells (in m³/(mol·Pa)).")
+        .def("speciesStandardGibbsEnergies", &ChemicalPropsBatch::speciesStandardGibbsEnergies, return_internal_ref, "Return the standard partial molar Gibbs energies of formation of the species in the cells (in J/mol).")
+        .def("speciesStandardEnthalpies", &ChemicalPropsBatch::speciesStandardEnthalpies, return_internal_ref, "Return the standard partial molar enthalpies of formation of the species in the cells (in J/mol).")
+        .def("speciesStandardHeatCapacitiesConstP", &ChemicalPropsBatch::speciesStandardHeatCapacitiesConstP, return_internal_ref, "Return the standard partial molar isobaric heat capacities of the species in the cells (in J/(mol·K)).")
+        .def("phaseAmounts", &ChemicalPropsBatch::phaseAmounts, return_internal_ref, "Return the amounts of the phases in the cells (in mol).")
+        .def("phaseMasses", &ChemicalPropsBatch::phaseMasses, return_internal_ref, "Return the masses of the phases in the cells (in kg).")
+        .def("numTemperaturePressurePairs", &ChemicalPropsBatch::numTemperaturePressurePairs, "Return the number of distinct pairs of temperature and pressure among the cells in the last update.")
+        ;
+}
@@ -0,0 +1,210 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalPropsBatch.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ChemicalPropsBatch class", "[ChemicalPropsBatch]")
+{
+    Index numcalls = 0; // the number of evaluations of the standard thermodynamic models
+
+    StandardThermoModel standard_thermo_model_gas = [&](real T, real P)
+    {
+        ++numcalls;
+        StandardThermoProps props;
+        props.G0  = 0.1 * T*P;
+        props.H0  = 0.2 * T*P;
+        props.V0  = 0.3 * T*P;
+        props.VT0 = 0.4 * T*P;
+        props.VP0 = 0.5 * T*P;
+        props.Cp0 = 0.6 * T*P;
+        return props;
+    };
+
+    StandardThermoModel standard_thermo_model_solid = [&](real T, real P)
+    {
+        ++numcalls;
+        StandardThermoProps props;
+        props.G0  = 1.1 * T*P;
+        props.H0  = 1.2 * T*P;
+        props.V0  = 1.3 * T*P;
+        props.VT0 = 1.4 * T*P;
+        props.VP0 = 1.5 * T*P;
+        props.Cp0 = 1.6 * T*P;
+        return props;
+    };
+
+    ActivityModel activity_model_gas = [](ActivityPropsRef props, ActivityModelArgs args)
+    {
+        const auto [T, P, x] = args;
+        props.Vx  = 1.0 * T*P;
+        props.VxT = 2.0 * T*P;
+        props.VxP = 3.0 * T*P;
+        props.Gx  = 4.0 * T*P;
+        props.Hx  = 5.0 * T*P;
+        props.Cpx = 6.0 * T*P;
+        props.Vxi = 7.0 * x;
+        props.ln_g = 8.0 * x * T;
+        props.ln_a = 9.0 * x * P;
+        props.som = StateOfMatter::Gas;
+    };
+
+    ActivityModel activity_model_solid = [](ActivityPropsRef props, ActivityModelArgs args)
+    {
+        const auto [T, P, x] = args;
+        props.Vx  = 1.1 * T*P;
+        props.VxT = 2.1 * T*P;
+        props.VxP = 3.1 * T*P;
+        props.Gx  = 4.1 * T*P;
+        props.Hx  = 5.1 * T*P;
+        props.Cpx = 6.1 * T*P;
+        props.Vxi = 7.1 * x;
+        props.ln_g = 8.1 * x * T;
+        props.ln_a = 9.1 * x * P;
+        props.som = StateOfMatter::Solid;
+    };
+
+    Database db;
+
+    db.addSpecies( Species("H2O(g)").withStandardThermoModel(standard_thermo_model_gas) );
+    db.addSpecies( Species("CO2(g)").withStandardThermoModel(standard_thermo_model_gas) );
+    db.addSpecies( Species("CaCO3(s)").withStandardThermoModel(standard_thermo_model_solid) );
+
+    Vec<Phase> phases
+    {
+        Phase()
+            .withName("SomeGas")
+            .withActivityModel(activity_model_gas)
+            .withIdealActivityModel(activity_model_gas)
+            .withStateOfMatter(StateOfMatter::Gas)
+            .withSpecies({
+                db.species().get("H2O(g)"),
+                db.species().get("CO2(g)")}),
+
+        Phase()
+            .withName("SomeSolid")
+            .withActivityModel(activity_model_solid)
+            .withIdealActivityModel(activity_model_solid)
+            .withStateOfMatter(StateOfMatter::Solid)
+            .withSpecies({
+                db.species().get("CaCO3(s)") })
+    };
+
+    ChemicalSystem system(db, phases);
+
+    ChemicalPropsBatch batch(system);
+
+    const ArrayXd T = ArrayXd{{ 300.0, 350.0, 300.0, 350.0, 300.0 }};
+    const ArrayXd P = ArrayXd{{ 1.0e5, 2.0e5, 1.0e5, 2.0e5, 3.0e5 }};
+
+    ArrayXXd n(5, 3);
+    n << 4.0, 6.0, 5.0,
+         1.0, 2.0, 3.0,
+         7.0, 1.0, 0.5,
+         2.0, 2.0, 0.0,
+         3.0, 9.0, 1.0;
+
+    const auto checkCells = [&]()
+    {
+        ChemicalProps props(system);
+
+        for(auto i = 0; i < batch.numCells(); ++i)
+        {
+            props.update(T[i], P[i], n.row(i).transpose().cast<real>());
+
+            const auto cellprops = batch.props(i);
+
+            CHECK( batch.temperatures()[i] == T[i] );
+            CHECK( batch.pressures()[i] == P[i] );
+
+            CHECK( batch.speciesAmounts().row(i).transpose().isApprox(props.speciesAmounts().cast<double>()) );
+            CHECK( batch.speciesMoleFractions().row(i).transpose().isApprox(props.speciesMoleFractions().cast<double>()) );
+            CHECK( batch.speciesActivityCoefficientsLn().row(i).transpose().isApprox(props.speciesActivityCoefficientsLn().cast<double>()) );
+            CHECK( batch.speciesActivitiesLn().row(i).transpose().isApprox(props.speciesActivitiesLn().cast<double>()) );
+            CHECK( batch.speciesChemicalPotentials().row(i).transpose().isApprox(props.speciesChemicalPotentials().cast<double>()) );
+            CHECK( batch.speciesStandardVolumes().row(i).transpose().isApprox(props.speciesStandardVolumes().cast<double>()) );
+            CHECK( batch.speciesStandardGibbsEnergies().row(i).transpose().isApprox(props.speciesStandardGibbsEnergies().cast<double>()) );
+            CHECK( batch.speciesStandardHeatCapacitiesConstP().row(i).transpose().isApprox(props.speciesStandardHeatCapacitiesConstP().cast<double>()) );
+            CHECK( batch.phaseAmounts()(i, 0) == Approx(n(i, 0) + n(i, 1)) );
+            CHECK( batch.phaseAmounts()(i, 1) == Approx(n(i, 2)) );
+
+            CHECK( cellprops.temperature() == T[i] );
+            CHECK( cellprops.pressure() == P[i] );
+            CHECK( cellprops.speciesChemicalPotentials().isApprox(props.speciesChemicalPotentials()) );
+            CHECK( cellprops.volume() == Approx(props.volume()) );
+            CHECK( cellprops.gibbsEnergy() == Approx(props.gibbsEnergy()) );
+            CHECK( cellprops.phaseProps(0).mass() == Approx(props.phaseProps(0).mass()) );
+        }
+    };
+
+    SECTION("Testing when species in the cells have non-zero amounts")
+    {
+        n(3, 2) = 4.0;
+
+        numcalls = 0;
+
+        batch.update(T, P, n);
+
+        CHECK( batch.numCells() == 5 );
+        CHECK( batch.numTemperaturePressurePairs() == 3 );
+
+        // The standard thermodynamic properties of the species are evaluated once per distinct temperature and pressure
+        CHECK( numcalls == 3 * system.species().size() );
+
+        checkCells();
+    }
+
+    SECTION("Testing when a phase does not exist in a cell")
+    {
+        batch.update(T, P, n);
+
+        CHECK( batch.phaseAmounts()(3, 1) == 0.0 );
+        CHECK( batch.speciesMoleFractions()(3, 2) == 1.0 );
+
+        checkCells();
+    }
+
+    SECTION("Testing when the cells are given as chemical states")
+    {
+        n(3, 2) = 4.0;
+
+        Vec<ChemicalState> states(5, ChemicalState(system));
+        for(auto i = 0; i < 5; ++i)
+        {
+            states[i].temperature(T[i]);
+            states[i].pressure(P[i]);
+            states[i].setSpeciesAmounts(ArrayXd(n.row(i).transpose()));
+        }
+
+        batch.update(states);
+
+        checkCells();
+    }
+
+    SECTION("Testing when a species has zero amount in a cell")
+    {
+        n(2, 1) = 0.0;
+
+        CHECK_THROWS( batch.update(T, P, n) );
+    }
+}
@@ -26,6 +26,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class ChemicalProps;
+
 /// The base type for primary chemical property data of a phase from which others are computed.
 template<template<typename> typename TypeOp>
 struct ChemicalPropsPhaseBaseData
@@ -643,6 +646,9 @@ public:
     template<template<typename> typename OtherTypeOp>
     friend class ChemicalPropsPhaseBase;
 
+    // Ensure ChemicalProps can update the phase with standard thermodynamic properties computed (or cached) for the whole system.
+    friend class ChemicalProps;
+
 private:
     /// The phase associated with these primary chemical properties.
     Phase mphase;
@@ -657,7 +663,9 @@ private:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra data mapped to activity mode
-    template<bool use_ideal_activity_model>
+    /// @tparam use_ideal_activity_model Whether the ideal activity model of the phase is used
+    /// @tparam update_standard_thermo_props Whether the standard thermodynamic properties of the species are computed (false if already set in the phase data)
+    template<bool use_ideal_activity_model, bool update_standard_thermo_props = true>
     auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
     {
         mdata.T = T;
@@ -703,16 +711,19 @@ private:
         assert(   Vxi.size() == N );
 
         // Compute the standard thermodynamic properties of the species in the phase.
-        StandardThermoProps aux;
-        for(auto i = 0; i < N; ++i)
+        if constexpr(update_standard_thermo_props)
         {
-            aux = species[i].standardThermoProps(T, P);
-            G0[i]  = aux.G0;
-            H0[i]  = aux.H0;
-            V0[i]  = aux.V0;
-            VT0[i] = aux.VT0;
-            VP0[i] = aux.VP0;
-            Cp0[i] = aux.Cp0;
+            StandardThermoProps aux;
+            for(auto i = 0; i < N; ++i)
+            {
+                aux = species[i].standardThermoProps(T, P);
+                G0[i]  = aux.G0;
+                H0[i]  = aux.H0;
+                V0[i]  = aux.V0;
+                VT0[i] = aux.VT0;
+                VP0[i] = aux.VP0;
+                Cp0[i] = aux.Cp0;
+            }
         }
 
         // Compute the amount of the phase
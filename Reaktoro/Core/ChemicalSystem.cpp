@@ -75,6 +75,9 @@ struct ChemicalSystem::Impl
     /// The stoichiometric matrix of the reactions in the system with respect to its species.
     MatrixXd stoichiometric_matrix;
 
+    /// The cache of the standard thermodynamic properties of the species in the system.
+    StandardThermoPropsCache standard_thermo_props_cache;
+
     /// Construct a default ChemicalSystem::Impl object.
     Impl()
     {}
@@ -256,6 +259,11 @@ auto ChemicalSystem::stoichiometricMatrix() const -> MatrixXdConstRef
     return pimpl->stoichiometric_matrix;
 }
 
+auto ChemicalSystem::standardThermoPropsCache() const -> StandardThermoPropsCache&
+{
+    return pimpl->standard_thermo_props_cache;
+}
+
 auto operator<<(std::ostream& out, ChemicalSystem const& system) -> std::ostream&
 {
     // auto const& phases = system.phases();
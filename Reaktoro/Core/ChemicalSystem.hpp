@@ -33,6 +33,7 @@
 #include <Reaktoro/Core/Reactions.hpp>
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
 #include <Reaktoro/Core/Surface.hpp>
 #include <Reaktoro/Core/SurfaceList.hpp>
 #include <Reaktoro/Core/Surfaces.hpp>
@@ -155,6 +156,11 @@ public:
     /// is given by the coefficient of the *i*th species in the *j*th reaction.
     auto stoichiometricMatrix() const -> MatrixXdConstRef;
 
+    /// Return the cache of the standard thermodynamic properties of the species in the system.
+    /// The cache is shared by all copies of this ChemicalSystem object and used whenever their
+    /// chemical properties are updated (see StandardThermoPropsCache).
+    auto standardThermoPropsCache() const -> StandardThermoPropsCache&;
+
 private:
     struct Impl;
 
@@ -18,6 +18,8 @@
 #include "Data.hpp"
 
 // C++ includes
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 
 // Third-party includes
@@ -29,6 +31,7 @@ using json = nlohmann::json;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/MappedFile.hpp>
 
 namespace Reaktoro {
 namespace {
@@ -249,6 +252,133 @@ auto convertDataToJson(Data const& data) -> json
     return convertDataTo<json>(data);
 }
 
+// ==========================================================================================
+// METHODS TO CONVERT DATA TO AND FROM BINARY
+// ==========================================================================================
+
+/// The identifier at the start of a binary Data file.
+constexpr char binarymagic[8] = {'R', 'K', 'T', 'D', 'A', 'T', 'A', '\0'};
+
+/// The version of the binary Data format.
+constexpr std::uint64_t binaryversion = 1;
+
+/// The tags identifying the type of each node in the binary Data format.
+enum class BinaryTag : std::uint8_t { Null, Boolean, Integer, Float, String, List, Dict };
+
+/// Used to append the binary representation of values to a string.
+struct BinaryWriter
+{
+    String& out;
+
+    template<typename T>
+    auto write(T const& value) -> void
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        out.append(bytes, sizeof(T));
+    }
+
+    auto write(String const& str) -> void
+    {
+        write(static_cast<std::uint32_t>(str.size()));
+        out.append(str);
+    }
+};
+
+/// Used to read the binary representation of values from a range of bytes.
+struct BinaryReader
+{
+    Chars pos;
+    Chars end;
+
+    auto check(Index size) const -> void
+    {
+        errorif(size > static_cast<Index>(end - pos), "Could not decode binary Data because its contents are truncated or corrupted.");
+    }
+
+    template<typename T>
+    auto read() -> T
+    {
+        check(sizeof(T));
+        T value;
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    auto readString() -> String
+    {
+        const auto size = read<std::uint32_t>();
+        check(size);
+        String str(pos, size);
+        pos += size;
+        return str;
+    }
+};
+
+auto convertDataToBinary(Data const& data, BinaryWriter& writer) -> void
+{
+    if(data.isNull()) writer.write(BinaryTag::Null);
+    else if(data.isBoolean()) { writer.write(BinaryTag::Boolean); writer.write(static_cast<std::uint8_t>(data.asBoolean())); }
+    else if(data.isInteger()) { writer.write(BinaryTag::Integer); writer.write(static_cast<std::int32_t>(data.asInteger())); }
+    else if(data.isFloat()) { writer.write(BinaryTag::Float); writer.write(data.asFloat()); }
+    else if(data.isString()) { writer.write(BinaryTag::String); writer.write(data.asString()); }
+    else if(data.isList())
+    {
+        writer.write(BinaryTag::List);
+        writer.write(static_cast<std::uint32_t>(data.asList().size()));
+        for(auto const& value : data.asList())
+            convertDataToBinary(value, writer);
+    }
+    else if(data.isDict())
+    {
+        writer.write(BinaryTag::Dict);
+        writer.write(static_cast<std::uint32_t>(data.asDict().size()));
+        for(auto const& [key, value] : data.asDict())
+        {
+            writer.write(key);
+            convertDataToBinary(value, writer);
+        }
+    }
+    else errorif(true, "Could not convert this Data object to binary as the Data object is not in a valid state.");
+}
+
+auto convertBinaryToData(BinaryReader& reader) -> Data
+{
+    const auto tag = reader.read<BinaryTag>();
+    switch(tag)
+    {
+        case BinaryTag::Null: return {};
+        case BinaryTag::Boolean: return reader.read<std::uint8_t>() != 0;
+        case BinaryTag::Integer: return static_cast<int>(reader.read<std::int32_t>());
+        case BinaryTag::Float: return reader.read<double>();
+        case BinaryTag::String: return reader.readString();
+        case BinaryTag::List:
+        {
+            const auto size = reader.read<std::uint32_t>();
+            Data result = Vec<Data>();
+            for(auto i = 0u; i < size; ++i)
+                result.add(convertBinaryToData(reader));
+            return result;
+        }
+        case BinaryTag::Dict:
+        {
+            const auto size = reader.read<std::uint32_t>();
+            Data result = Dict<String, Data>();
+            for(auto i = 0u; i < size; ++i)
+            {
+                auto key = reader.readString();
+                result.add(key, convertBinaryToData(reader));
+            }
+            return result;
+        }
+    }
+
+    errorif(true, "Could not decode binary Data because it contains an unknown node type (", static_cast<int>(tag), ").");
+
+    return {};
+}
+
 // ==========================================================================================
 // CLASS TO ENSURE A COMMON LOCALE IS KEPT WHEN DEALING WITH YAML AND JSON
 // ==========================================================================================
@@ -367,6 +497,36 @@ auto Data::loadJson(String const& path) -> Data
     return convertJsonToData(doc);
 }
 
+auto Data::parseBinary(Chars bytes, Index size) -> Data
+{
+    errorif(!isBinary(bytes, size), "Could not decode binary Data because it does not start with the expected identifier.");
+    BinaryReader reader{bytes + sizeof(binarymagic), bytes + size};
+    const auto version = reader.read<std::uint64_t>();
+    errorif(version != binaryversion, "Could not decode binary Data with version ", version, " because version ", binaryversion, " is expected.");
+    return convertBinaryToData(reader);
+}
+
+auto Data::loadBinary(String const& path) -> Data
+{
+    MappedFile file(path);
+    errorif(!file.isOpen(), "Could not open binary file `", path, "`.");
+    errorif(!isBinary(file.data(), file.size()), "The file `", path, "` is not a binary Data file created with Data::saveBinary.");
+    return parseBinary(file.data(), file.size());
+}
+
+auto Data::isBinaryFile(String const& path) -> bool
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(binarymagic)] = {};
+    file.read(magic, sizeof(magic));
+    return file && std::memcmp(magic, binarymagic, sizeof(magic)) == 0;
+}
+
+auto Data::isBinary(Chars bytes, Index size) -> bool
+{
+    return size >= sizeof(binarymagic) && std::memcmp(bytes, binarymagic, sizeof(binarymagic)) == 0;
+}
+
 auto Data::asString() const -> String const&
 {
     errorif(!isString(), "Cannot convert this Data object to a String.");
@@ -616,6 +776,23 @@ auto Data::saveJson(String const& filepath) const -> void
     file.close();
 }
 
+auto Data::dumpBinary() const -> String
+{
+    String out(binarymagic, sizeof(binarymagic));
+    BinaryWriter writer{out};
+    writer.write(binaryversion);
+    convertDataToBinary(*this, writer);
+    return out;
+}
+
+auto Data::saveBinary(String const& filepath) const -> void
+{
+    std::ofstream file(filepath, std::ios::binary);
+    errorif(!file, "Could not open file `", filepath, "` for writing.");
+    const auto bytes = dumpBinary();
+    file.write(bytes.data(), bytes.size());
+}
+
 auto Data::repr() const -> String
 {
     return dumpYaml();
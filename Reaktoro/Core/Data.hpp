@@ -69,6 +69,19 @@ public:
     /// Return a Data object by parsing a JSON formatted file at a given path.
     static auto loadJson(String const& path) -> Data;
 
+    /// Return a Data object by decoding its binary representation created with Data::dumpBinary.
+    static auto parseBinary(Chars bytes, Index size) -> Data;
+
+    /// Return a Data object by decoding a binary file created with Data::saveBinary.
+    /// The file is memory-mapped and decoded from the mapping, which is much faster than parsing YAML or JSON files.
+    static auto loadBinary(String const& path) -> Data;
+
+    /// Return true if the file at a given path is a binary file created with Data::saveBinary.
+    static auto isBinaryFile(String const& path) -> bool;
+
+    /// Return true if given bytes start with the identifier of the binary representation created with Data::dumpBinary.
+    static auto isBinary(Chars bytes, Index size) -> bool;
+
     /// Return this Data object as a boolean value.
     auto asBoolean() const -> bool;
 
@@ -196,6 +209,13 @@ public:
     /// Save the state of this Data object into a JSON formatted file.
     auto saveJson(String const& filepath) const -> void;
 
+    /// Return a compact binary representation of this Data object.
+    /// Numbers are stored in the byte order of the machine, so the binary representation is not portable across platforms with different endianness.
+    auto dumpBinary() const -> String;
+
+    /// Save the state of this Data object into a binary file (see Data::dumpBinary).
+    auto saveBinary(String const& filepath) const -> void;
+
     /// Return a YAML formatted string representing the state of this Data object.
     auto repr() const -> String;
 
@@ -52,6 +52,10 @@ void exportData(py::module& m)
         .def_static("load", &Data::load, "Return a Data object by parsing either an YAML or JSON formatted file at a given path.")
         .def_static("loadYaml", &Data::loadYaml, "Return a Data object by parsing an YAML formatted file at a given path.")
         .def_static("loadJson", &Data::loadJson, "Return a Data object by parsing a JSON formatted file at a given path.")
+        .def_static("parseBinary", [](py::bytes const& bytes) { String str = bytes; return Data::parseBinary(str.data(), str.size()); }, "Return a Data object by decoding its binary representation created with Data.dumpBinary.")
+        .def_static("loadBinary", &Data::loadBinary, "Return a Data object by decoding a binary file created with Data.saveBinary.")
+        .def_static("isBinaryFile", &Data::isBinaryFile, "Return true if the file at a given path is a binary file created with Data.saveBinary.")
+        .def_static("isBinary", [](py::bytes const& bytes) { String str = bytes; return Data::isBinary(str.data(), str.size()); }, "Return true if given bytes start with the identifier of the binary representation created with Data.dumpBinary.")
         .def("asBoolean", &Data::asBoolean, "Return this Data object as a boolean value.")
         .def("asString", &Data::asString, return_internal_ref, "Return this Data object as a string.")
         .def("asInteger", &Data::asInteger, "Return this Data object as an integer number.")
@@ -86,6 +90,8 @@ void exportData(py::module& m)
         .def("save", &Data::save, "Save the state of this Data object into a YAML formatted file.")
         .def("saveYaml", &Data::saveYaml, "Save the state of this Data object into a YAML formatted file.")
         .def("saveJson", &Data::saveJson, "Save the state of this Data object into a JSON formatted file.")
+        .def("dumpBinary", [](Data const& self) { return py::bytes(self.dumpBinary()); }, "Return a compact binary representation of this Data object.")
+        .def("saveBinary", &Data::saveBinary, "Save the state of this Data object into a binary file.")
         .def("repr", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
         .def("__str__", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
         .def("__repr__", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
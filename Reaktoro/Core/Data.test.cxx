@@ -705,6 +705,35 @@ TEST_CASE("Testing Data class", "[Data]")
         // CHECK( data.dumpJson() == nlohmann::json::parse(json_testing_string).dump(2) ); // indent=2
     }
 
+    SECTION("Checking binary encoding and decoding of Data objects")
+    {
+        const Data data1 = Data::parseYaml(yaml_testing_string);
+        const auto bytes = data1.dumpBinary();
+
+        const Data data2 = Data::parseBinary(bytes.data(), bytes.size());
+
+        CHECK( data2.dumpYaml() == data1.dumpYaml() );
+        CHECK( data2["Extra"]["AnInteger"].isInteger() );
+        CHECK( data2["Extra"]["SomeBoolean"].isBoolean() );
+        CHECK( data2["Species"][0]["StandardThermoModel"]["HollandPowell"]["Gf"].asFloat() == -4937500.0 );
+
+        data1.saveBinary("temporary.bin");
+
+        CHECK( Data::isBinaryFile("temporary.bin") );
+        CHECK( Data::loadBinary("temporary.bin").dumpYaml() == data1.dumpYaml() );
+
+        std::remove("temporary.bin");
+
+        CHECK_THROWS( Data::loadBinary("temporary.bin") );
+
+        CHECK( Data::isBinary(bytes.data(), bytes.size()) );
+        CHECK_FALSE( Data::isBinary(bytes.data(), 4) );
+        CHECK_FALSE( Data::isBinary(yaml_testing_string, 16) );
+
+        CHECK_THROWS( Data::parseBinary(bytes.data(), bytes.size() - 1) );
+        CHECK_THROWS( Data::parseBinary(yaml_testing_string, 16) );
+    }
+
     SECTION("Checking encoding/decoding of custom types to/from Data objects")
     {
         const auto str = R"#(
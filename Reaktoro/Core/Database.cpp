@@ -18,15 +18,20 @@
 #include "Database.hpp"
 
 // C++ includes
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/MappedFile.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
+#include <Reaktoro/Serialization/Core.hpp>
 
 namespace Reaktoro {
 
@@ -65,10 +70,17 @@ auto createDatabaseFromStringJSON(Source& text)
     return Database(dbparser);
 }
 
-auto createDataFromJsonOrYaml(String const& path) -> Data
+/// The identifier at the beginning of a binary database file created with Database::saveBinary.
+const char databasemagic[8] = {'R', 'K', 'T', 'D', 'B', 'A', 'S', 'E'};
+
+/// The version of the layout of binary database files created with Database::saveBinary.
+const std::uint64_t databaseversion = 1;
+
+/// Open and map into memory the local database file at a given path.
+auto openDatabaseFile(String const& path) -> SharedPtr<const MappedFile>
 {
-    std::ifstream file(path);
-    errorif(!file.is_open(),
+    auto file = std::make_shared<const MappedFile>(path);
+    errorif(!file->isOpen(),
         "Could not open file `", path, "`. Ensure the given file path "
         "is relative to the directory where your application is RUNNING "
         "(not necessarily where the executable is located!). Alternatively, "
@@ -76,11 +88,87 @@ auto createDataFromJsonOrYaml(String const& path) -> Data
         "in Windows, `C:\\User\\username\\mydata\\mydatabase.yaml`, "
         "in Linux and macOS, `/home/username/mydata/mydatabase.yaml`). "
         "File formats accepted are JSON and YAML and expected file extensions are .json, .yaml, or .yml.");
+    return file;
+}
+
+/// Return true if a mapped file starts with the identifier of binary database files created with Database::saveBinary.
+auto isDatabaseBinary(MappedFile const& file) -> bool
+{
+    return file.size() >= sizeof(databasemagic) && std::memcmp(file.data(), databasemagic, sizeof(databasemagic)) == 0;
+}
+
+/// Return true if a mapped file is in one of the binary formats accepted by Database::fromBinaryFile.
+auto isBinaryDatabaseFile(MappedFile const& file) -> bool
+{
+    return isDatabaseBinary(file) || Data::isBinary(file.data(), file.size());
+}
+
+/// Return the unsigned integer at a given byte offset of a mapped binary database file.
+auto readDatabaseUInt(MappedFile const& file, String const& path, Index offset) -> std::uint64_t
+{
+    std::uint64_t value = 0;
+    errorif(offset > file.size() || file.size() - offset < sizeof(value), "Could not read binary database file `", path, "` because it is truncated.");
+    std::memcpy(&value, file.data() + offset, sizeof(value));
+    return value;
+}
+
+/// Create a DatabaseParser object for a mapped binary database file created with Database::saveBinary.
+/// Only the species metadata is decoded here. The parameters of the standard thermodynamic models stay
+/// in the mapped file until first needed, which the returned DatabaseParser object keeps alive.
+auto createDatabaseParserFromBinary(SharedPtr<const MappedFile> const& file, String const& path, ElementList const& elements) -> DatabaseParser
+{
+    Index offset = sizeof(databasemagic);
+
+    const auto version = readDatabaseUInt(*file, path, offset);
+    errorif(version != databaseversion, "Could not read binary database file `", path, "` with version ", version, " because version ", databaseversion, " is expected.");
+    offset += sizeof(std::uint64_t);
+
+    const auto metadatasize = readDatabaseUInt(*file, path, offset);
+    offset += sizeof(std::uint64_t);
+    errorif(metadatasize > file->size() - offset, "Could not read binary database file `", path, "` because it is truncated.");
+    const auto metadatabegin = offset;
+    offset += metadatasize;
+
+    const auto numblobs = readDatabaseUInt(*file, path, offset);
+    offset += sizeof(std::uint64_t);
+    errorif(numblobs >= (file->size() - offset) / sizeof(std::uint64_t), "Could not read binary database file `", path, "` because it is truncated.");
+
+    Vec<std::uint64_t> blobsoffsets(numblobs + 1);
+    for(Index i = 0; i <= numblobs; ++i)
+        blobsoffsets[i] = readDatabaseUInt(*file, path, offset + i * sizeof(std::uint64_t));
+    offset += (numblobs + 1) * sizeof(std::uint64_t);
+
+    const auto blobsbegin = offset;
+    for(Index i = 0; i < numblobs; ++i)
+        errorif(blobsoffsets[i] > blobsoffsets[i + 1], "Could not read binary database file `", path, "` because its model parameters are not stored in sequence.");
+    errorif(blobsoffsets.front() != 0 || blobsoffsets.back() > file->size() - blobsbegin, "Could not read binary database file `", path, "` because it is truncated.");
+
+    const auto doc = Data::parseBinary(file->data() + metadatabegin, metadatasize);
+
+    auto modelparams = [file, path, blobsbegin, blobsoffsets = std::move(blobsoffsets)](Index i) -> Data
+    {
+        errorif(i + 1 >= blobsoffsets.size(), "Could not find the parameters with index ", i, " of a standard thermodynamic model in binary database file `", path, "`.");
+        return Data::parseBinary(file->data() + blobsbegin + blobsoffsets[i], blobsoffsets[i + 1] - blobsoffsets[i]);
+    };
+
+    return DatabaseParser(doc, elements, modelparams);
+}
+
+/// Create a DatabaseParser object for a mapped local database file in any of the accepted formats.
+auto createDatabaseParserFromFile(SharedPtr<const MappedFile> const& file, String const& path, ElementList const& elements) -> DatabaseParser
+{
+    if(isDatabaseBinary(*file))
+        return createDatabaseParserFromBinary(file, path, elements);
+
+    if(Data::isBinary(file->data(), file->size()))
+        return DatabaseParser(Data::parseBinary(file->data(), file->size()), elements);
+
     auto isJson = endswith(path, ".json");
     auto isYaml = endswith(path, ".yaml") || endswith(path, ".yml");
-    errorifnot(isJson || isYaml, "The file `", path, "` must be a JSON or YAML file terminating with .json, .yaml, or .yml.");
-    auto doc = isJson ? Data::parseJson(file) : Data::parseYaml(file);
-    return doc;
+    errorifnot(isJson || isYaml, "The file `", path, "` must be a JSON or YAML file terminating with .json, .yaml, or .yml, or a binary file created with Database::saveBinary.");
+    const String contents(file->data(), file->size());
+    auto doc = isJson ? Data::parseJson(contents) : Data::parseYaml(contents);
+    return DatabaseParser(doc, elements);
 }
 
 struct Database::Impl
@@ -257,8 +345,8 @@ auto Database::extendWithFile(String const& path) -> void
 {
     // Prvide current element objects in this database which can be reused to
     // create the Species objects in the extended database.
-    auto doc = createDataFromJsonOrYaml(path);
-    DatabaseParser dbparser(doc, pimpl->elements);
+    auto file = openDatabaseFile(path);
+    DatabaseParser dbparser = createDatabaseParserFromFile(file, path, pimpl->elements);
     Database dbx(dbparser);
     extendWithDatabase(dbx);
 }
@@ -303,15 +391,38 @@ auto Database::attachedData() const -> Any const&
 
 auto Database::fromFile(String const& path) -> Database
 {
-    auto doc = createDataFromJsonOrYaml(path);
-    DatabaseParser dbparser(doc);
+    auto file = openDatabaseFile(path);
+    DatabaseParser dbparser = createDatabaseParserFromFile(file, path, {});
     return Database(dbparser);
 }
 
 auto Database::fromEmbeddedFile(String const& path) -> Database
 {
+    static std::mutex mutex;
+    static Map<String, Database> cache;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto const it = cache.find(path);
+        if(it != cache.end())
+            return it->second;
+    }
+
     const String contents = Embedded::get("databases/reaktoro/" + path);
-    return createDatabaseFromContents(contents);
+    Database db = endswith(path, ".json") ? createDatabaseFromStringJSON(contents) : createDatabaseFromContents(contents);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    cache.emplace(path, db);
+    return db;
+}
+
+auto Database::fromBinaryFile(String const& path) -> Database
+{
+    auto file = openDatabaseFile(path);
+    errorif(!isBinaryDatabaseFile(*file), "Could not read file `", path, "` as a binary database file. "
+        "Ensure it was created with Database::saveBinary.");
+    DatabaseParser dbparser = createDatabaseParserFromFile(file, path, {});
+    return Database(dbparser);
 }
 
 auto Database::fromContents(String const& text) -> Database
@@ -335,6 +446,56 @@ auto Database::fromStream(std::istream& stream) -> Database
     return createDatabaseFromContents(stream);
 }
 
+auto Database::saveBinary(String const& path) const -> void
+{
+    Data doc = *this;
+
+    // Move the parameters of the standard thermodynamic models out of the species metadata into
+    // separate blobs, replacing them by their indices, so these can be decoded only when first needed.
+    Strings blobs;
+    auto moveToBlob = [&](Data& params)
+    {
+        blobs.push_back(params.dumpBinary());
+        params = blobs.size() - 1;
+    };
+
+    Strings names;
+    if(doc.exists("Species"))
+        for(auto const& [name, attributes] : doc["Species"].asDict())
+            names.push_back(name);
+
+    for(auto const& name : names)
+    {
+        auto& attributes = doc["Species"][name];
+        if(attributes.exists("StandardThermoModel"))
+            moveToBlob(attributes["StandardThermoModel"]);
+        if(attributes.exists("FormationReaction") && attributes["FormationReaction"].exists("ReactionStandardThermoModel"))
+            moveToBlob(attributes["FormationReaction"]["ReactionStandardThermoModel"]);
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    errorif(!file, "Could not open file `", path, "` for writing.");
+
+    auto writeUInt = [&](std::uint64_t value) { file.write(reinterpret_cast<Chars>(&value), sizeof(value)); };
+
+    const auto metadata = doc.dumpBinary();
+
+    file.write(databasemagic, sizeof(databasemagic));
+    writeUInt(databaseversion);
+    writeUInt(metadata.size());
+    file.write(metadata.data(), metadata.size());
+    writeUInt(blobs.size());
+
+    std::uint64_t offset = 0;
+    writeUInt(offset);
+    for(auto const& blob : blobs)
+        writeUInt(offset += blob.size());
+    for(auto const& blob : blobs)
+        file.write(blob.data(), blob.size());
+
+    errorif(!file, "Could not write file `", path, "`.");
+}
+
 auto Database::local(String const& path) -> Database
 {
     return fromFile(path);
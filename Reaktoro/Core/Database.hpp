@@ -33,14 +33,24 @@ class Database
 public:
     /// Return a Database object constructed with a given local file.
     /// @warning An exception is thrown if `path` does not point to a valid local database file.
+    /// @note Binary database files created with Database::saveBinary are also accepted.
     /// @param path The path, including file name, to the local database file.
     static auto fromFile(String const& path) -> Database;
 
     /// Return a Database object constructed with a given embedded file.
+    /// The embedded file is parsed only once per process; subsequent calls return a copy of the parsed database.
     /// @warning An exception is thrown if `path` does not point to a valid embedded database file.
     /// @param path The path, including file name, to the embedded database file.
     static auto fromEmbeddedFile(String const& path) -> Database;
 
+    /// Return a Database object constructed with a binary file created with Database::saveBinary.
+    /// The file is opened and memory-mapped once. Only the species metadata is decoded here, while the
+    /// parameters of their standard thermodynamic models are decoded from the mapping when first needed.
+    /// Binary files of Data objects of databases (see Data::saveBinary) are also accepted and decoded at once.
+    /// @warning An exception is thrown if `path` does not point to a valid binary database file.
+    /// @param path The path, including file name, to the binary database file.
+    static auto fromBinaryFile(String const& path) -> Database;
+
     /// Return a Database object constructed with given database text contents.
     /// @param text The text content of the database as a string.
     static auto fromContents(String const& text) -> Database;
@@ -135,6 +145,13 @@ public:
     /// Return the attached data to this database whose type is known at runtime only.
     auto attachedData() const -> Any const&;
 
+    /// Save the elements and species of this database into a binary file that can be loaded with Database::fromBinaryFile.
+    /// The parameters of the standard thermodynamic models are stored apart from the species metadata so they can be decoded on demand.
+    /// @note The attached data and the standard volume models of the formation reactions are not saved.
+    /// @warning An exception is thrown if a species has a standard thermodynamic model without parameters (e.g., one created from a lambda function).
+    /// @param path The path, including file name, to the binary database file.
+    auto saveBinary(String const& path) const -> void;
+
 private:
     struct Impl;
 
@@ -55,8 +55,10 @@ void exportDatabase(py::module& m)
         .def("species", py::overload_cast<const String&>(&Database::species, py::const_), return_internal_ref)
         .def("reaction", &Database::reaction)
         .def("attachedData", &Database::attachedData)
+        .def("saveBinary", &Database::saveBinary)
         .def_static("fromFile", &Database::fromFile)
         .def_static("fromEmbeddedFile", &Database::fromEmbeddedFile)
+        .def_static("fromBinaryFile", &Database::fromBinaryFile)
         .def_static("fromContents", &Database::fromContents)
         .def_static("fromStringYAML", &Database::fromStringYAML)
         .def_static("fromStringJSON", &Database::fromStringJSON)
@@ -20,9 +20,12 @@
 
 // C++ includes
 #include <fstream>
+#include <iterator>
 
 // Reaktoro includes
+#include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Database.hpp>
+#include <Reaktoro/Serialization/Core.hpp>
 using namespace Reaktoro;
 
 namespace test {
@@ -368,3 +371,89 @@ TEST_CASE("Testing Database object creation using Database::fromContents using J
     CHECK(db.species()[0].name() == "Akermanite");
     CHECK(db.species()[0].formula() == "Ca2MgSi2O7");
 }
+
+TEST_CASE("Testing Database object creation using binary database files", "[Database]")
+{
+    String contents = R"#(
+        Species:
+          Akermanite:
+            Formula: Ca2MgSi2O7
+            Elements: 2:Ca 1:Mg 2:Si 7:O
+            AggregateState: Solid
+            StandardThermoModel:
+              MaierKelley:
+                Gf: -3679250.6
+                Hf: -3876463.4
+                Sr: 209.32552
+                Vr: 9.281e-05
+                a: 251.41656
+                b: 0.0476976
+                c: -4769760.0
+                Tmax: 1700.0
+          Akermanite(s):
+            Formula: Ca2MgSi2O7
+            Elements: 2:Ca 1:Mg 2:Si 7:O
+            AggregateState: Solid
+            FormationReaction:
+              Reactants: 1:Akermanite
+              ReactionStandardThermoModel:
+                ConstLgK:
+                  lgKr: 1.5
+        )#";
+
+    Database db = Database::fromStringYAML(contents);
+
+    db.saveBinary("temporary.rktdb");
+
+    Database dbbin = GENERATE(
+        Database::fromBinaryFile("temporary.rktdb"),
+        Database::fromFile("temporary.rktdb")
+    );
+
+    Database dbext;
+    dbext.extendWithFile("temporary.rktdb");
+
+    // The model parameters decoded on demand from the binary file can be saved again
+    dbbin.saveBinary("temporary-resaved.rktdb");
+    Database dbresaved = Database::fromBinaryFile("temporary-resaved.rktdb");
+
+    // A binary file of the Data object of a database is also accepted, but decoded at once
+    Data(db).saveBinary("temporary-data.rktdb");
+    Database dbdata = GENERATE(
+        Database::fromBinaryFile("temporary-data.rktdb"),
+        Database::fromFile("temporary-data.rktdb")
+    );
+
+    // A truncated binary database file is rejected
+    std::ifstream original("temporary.rktdb", std::ios::binary);
+    const String bytes((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    std::ofstream("temporary-truncated.rktdb", std::ios::binary).write(bytes.data(), bytes.size() - 4);
+
+    CHECK_THROWS( Database::fromBinaryFile("temporary-truncated.rktdb") );
+
+    std::remove("temporary.rktdb");
+    std::remove("temporary-resaved.rktdb");
+    std::remove("temporary-data.rktdb");
+    std::remove("temporary-truncated.rktdb");
+
+    REQUIRE( dbbin.species().size() == 2 );
+    REQUIRE( dbbin.elements().size() == db.elements().size() );
+    REQUIRE( dbext.species().size() == 2 );
+    REQUIRE( dbresaved.species().size() == 2 );
+    REQUIRE( dbdata.species().size() == 2 );
+
+    for(auto const& species : db.species())
+    {
+        for(auto const& other : { dbbin.species(species.name()), dbext.species(species.name()), dbresaved.species(species.name()), dbdata.species(species.name()) })
+        {
+            CHECK( other.formula() == species.formula() );
+            CHECK( other.elements().repr() == species.elements().repr() );
+            CHECK( other.aggregateState() == species.aggregateState() );
+            CHECK( other.standardThermoModel().params().dumpYaml() == species.standardThermoModel().params().dumpYaml() );
+            CHECK( other.standardThermoProps(350.0, 10.0e5).G0 == species.standardThermoProps(350.0, 10.0e5).G0 );
+            CHECK( other.standardThermoProps(400.0, 20.0e5).H0 == species.standardThermoProps(400.0, 20.0e5).H0 );
+        }
+    }
+
+    CHECK_THROWS( Database::fromBinaryFile("inexistent.rktdb") );
+}
@@ -17,12 +17,44 @@
 
 #include "ElementList.hpp"
 
+// C++ includes
+#include <atomic>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The number of elements up to which lookups use a linear search instead of hash tables.
+const auto max_size_linear_search = 16;
+
+} // namespace
+
+struct ElementList::Lookup
+{
+    /// The index of the first element with each symbol.
+    Map<String, Index> symbols;
+
+    /// The index of the first element with each name.
+    Map<String, Index> names;
+
+    /// Register an element with given index in the hash tables, unless elements with same attributes come before it.
+    auto add(Element const& element, Index i) -> void
+    {
+        symbols.emplace(element.symbol(), i);
+        names.emplace(element.name(), i);
+    }
+
+    /// Return the index of the element with given key in a hash table or the number of elements if not found.
+    static auto find(Map<String, Index> const& table, String const& key, Index notfound) -> Index
+    {
+        const auto it = table.find(key);
+        return it != table.end() ? it->second : notfound;
+    }
+};
 
 ElementList::ElementList()
 {}
@@ -38,6 +70,11 @@ ElementList::ElementList(const Vec<Element>& elements)
 auto ElementList::append(const Element& element) -> void
 {
     m_elements.push_back(element);
+
+    // Extend the hash tables if not shared with copies of this list, so that interleaved appends and lookups stay cheap
+    if(m_lookup && m_lookup.use_count() == 1)
+        m_lookup->add(m_elements.back(), m_elements.size() - 1);
+    else m_lookup.reset();
 }
 
 auto ElementList::data() const -> const Vec<Element>&
@@ -67,12 +104,16 @@ auto ElementList::find(const String& symbol) const -> Index
 
 auto ElementList::findWithSymbol(const String& symbol) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.symbol() == symbol));
+    if(size() <= max_size_linear_search)
+        return indexfn(m_elements, RKT_LAMBDA(e, e.symbol() == symbol));
+    return Lookup::find(lookup().symbols, symbol, size());
 }
 
 auto ElementList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.name() == name));
+    if(size() <= max_size_linear_search)
+        return indexfn(m_elements, RKT_LAMBDA(e, e.name() == name));
+    return Lookup::find(lookup().names, name, size());
 }
 
 auto ElementList::index(const String& symbol) const -> Index
@@ -141,6 +182,7 @@ auto ElementList::withoutTags(const StringList& tags) const -> ElementList
 
 ElementList::operator Vec<Element>&()
 {
+    m_lookup.reset(); // the elements may be changed via the returned reference
     return m_elements;
 }
 
@@ -149,6 +191,22 @@ ElementList::operator Vec<Element>const&() const
     return m_elements;
 }
 
+auto ElementList::lookup() const -> Lookup const&
+{
+    // Built by the first thread that needs the hash tables and then shared with the others (see SpeciesList::lookup)
+    auto current = std::atomic_load(&m_lookup);
+    if(current)
+        return *current;
+
+    auto created = std::make_shared<Lookup>();
+    for(auto i = 0; i < m_elements.size(); ++i)
+        created->add(m_elements[i], i);
+
+    if(std::atomic_compare_exchange_strong(&m_lookup, &current, created))
+        return *created;
+    return *current;
+}
+
 auto operator+(const ElementList& a, const ElementList& b) -> ElementList
 {
     return concatenate(a, b);
@@ -106,6 +106,15 @@ private:
     /// The elements stored in the list.
     Vec<Element> m_elements;
 
+    /// The hash tables used to find elements by symbol and name (built on first lookup in a long list).
+    struct Lookup;
+
+    /// The hash tables of the elements in the list (shared among copies and reset whenever the list may change).
+    mutable SharedPtr<Lookup> m_lookup;
+
+    /// Return the hash tables of the elements in the list, building them if needed.
+    auto lookup() const -> Lookup const&;
+
 public:
     /// Construct an ElementList object with given begin and end iterators.
     template<typename InputIterator>
@@ -114,21 +123,15 @@ public:
     /// Return begin const iterator of this ElementList instance (for STL compatibility reasons).
     auto begin() const { return m_elements.begin(); }
 
-    /// Return begin iterator of this ElementList instance (for STL compatibility reasons).
-    auto begin() { return m_elements.begin(); }
-
     /// Return end const iterator of this ElementList instance (for STL compatibility reasons).
     auto end() const { return m_elements.end(); }
 
-    /// Return end iterator of this ElementList instance (for STL compatibility reasons).
-    auto end() { return m_elements.end(); }
-
     /// Append a new Element at the back of the container (for STL compatibility reasons).
     auto push_back(const Element& elements) -> void { append(elements); }
 
     /// Insert a container of Element objects into this ElementList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_elements.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_lookup.reset(); m_elements.insert(pos, begin, end); }
 
     /// The type of the value stored in a ElementList (for STL compatibility reasons).
     using value_type = Element;
@@ -267,4 +267,21 @@ TEST_CASE("Testing ElementList", "[ElementList]")
     //-------------------------------------------------------------------------
     for(auto [i, element] : enumerate(elements))
         REQUIRE( element.name() == elements[i].name() );
+
+    //-------------------------------------------------------------------------
+    // TESTING LOOKUPS IN LONG LISTS (WITH HASH TABLES INSTEAD OF LINEAR SEARCH)
+    //-------------------------------------------------------------------------
+    ElementList longlist;
+    for(auto i = 0; i < 40; ++i)
+        longlist.append(Element().withSymbol("E" + std::to_string(i)).withName("Element" + std::to_string(i)));
+
+    REQUIRE( longlist.findWithSymbol("E0")        == 0  );
+    REQUIRE( longlist.findWithSymbol("E39")       == 39 );
+    REQUIRE( longlist.findWithName("Element17")   == 17 );
+    REQUIRE( longlist.findWithSymbol("Xy")        == longlist.size() );
+
+    longlist.append(Element().withSymbol("E0").withName("Duplicate")); // the first element with a symbol is found
+
+    REQUIRE( longlist.findWithSymbol("E0")        == 0  );
+    REQUIRE( longlist.findWithName("Duplicate")   == 40 );
 }
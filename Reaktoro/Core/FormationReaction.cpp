@@ -57,11 +57,6 @@ struct FormationReaction::Impl
 
         const auto num_reactants = reactants.size();
 
-        // Collect parameters from both rxn_thermo_model and std_volume_model.
-        Data params;
-        params.add(rxn_thermo_model.params());
-        params.add(std_volume_model.params());
-
         Vec<StandardThermoProps> reactants_props(num_reactants);
 
         auto calcfn = [=](real T, real P) mutable -> StandardThermoProps
@@ -106,7 +101,22 @@ struct FormationReaction::Impl
             return props;
         };
 
-        return StandardThermoModel(calcfn, params);
+        auto evalfn = [calcfn](StandardThermoProps& props, real T, real P) mutable
+        {
+            props = calcfn(T, P);
+        };
+
+        // Collect parameters from both rxn_thermo_model and std_volume_model only when requested,
+        // since these may be decoded on demand (e.g., from a database in binary format).
+        auto paramsfn = [rxn_thermo_model = rxn_thermo_model, std_volume_model = std_volume_model]()
+        {
+            Data params;
+            params.add(rxn_thermo_model.params());
+            params.add(std_volume_model.params());
+            return params;
+        };
+
+        return StandardThermoModel::WithLazyParams(evalfn, paramsfn);
     }
 };
 
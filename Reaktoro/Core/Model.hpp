@@ -17,6 +17,9 @@
 
 #pragma once
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Memoization.hpp>
@@ -159,9 +162,25 @@ public:
     /// Return the model parameters of this Model function object.
     auto params() const -> const Data&
     {
+        if(m_lazyparams)
+        {
+            std::call_once(m_lazyparams->flag, [&]() { m_lazyparams->params = m_lazyparams->paramsfn(); });
+            return m_lazyparams->params;
+        }
         return m_params;
     }
 
+    /// Return a Model function object whose parameters are only produced when first requested (e.g., decoded on demand from a file).
+    /// @param evalfn The function that evaluates the model.
+    /// @param paramsfn The function that produces the parameters of the underlying model function.
+    static auto WithLazyParams(const ModelEvaluator<ResultRef, Args...>& evalfn, const Fn<Data()>& paramsfn) -> Model
+    {
+        Model model(evalfn);
+        model.m_lazyparams = std::make_shared<LazyParams>();
+        model.m_lazyparams->paramsfn = paramsfn;
+        return model;
+    }
+
     /// Return a constant Model function object.
     /// @param param The parameter with the constant value always returned by the Model function object.
     static auto Constant(String const& name, real const& value) -> Model
@@ -181,6 +200,17 @@ private:
 
     /// The parameters of the underlying model function.
     Data m_params;
+
+    /// The parameters of a model function produced only when first requested (see @ref WithLazyParams).
+    struct LazyParams
+    {
+        std::once_flag flag;
+        Fn<Data()> paramsfn;
+        Data params;
+    };
+
+    /// The parameters produced on demand, if any, shared among copies of this Model function object.
+    SharedPtr<LazyParams> m_lazyparams;
 };
 
 /// Return a reaction thermodynamic model resulting from chaining other models.
@@ -110,4 +110,34 @@ TEST_CASE("Testing Model class", "[Model]")
 
         CHECK( model(x, y) == Approx(3.0) );
     }
+
+    SECTION("Using Model::WithLazyParams")
+    {
+        auto numcalls = 0;
+
+        auto evalfn = [=](real& res, real x, real y)
+        {
+            res = K*x*y;
+        };
+
+        auto paramsfn = [&]()
+        {
+            ++numcalls;
+            Data params;
+            params["K"] = K;
+            return params;
+        };
+
+        auto model = Model<real(real, real)>::WithLazyParams(evalfn, paramsfn);
+        auto copy = model;
+
+        CHECK( model.initialized() );
+        CHECK( model(3.0, 7.0) == Approx(K*21.0) );
+        CHECK( numcalls == 0 );
+
+        CHECK( model.params()["K"].asFloat() == K );
+        CHECK( copy.params()["K"].asFloat() == K );
+        CHECK( model.withMemoization().params()["K"].asFloat() == K );
+        CHECK( numcalls == 1 );
+    }
 }
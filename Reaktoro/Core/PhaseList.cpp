@@ -17,6 +17,9 @@
 
 #include "PhaseList.hpp"
 
+// C++ includes
+#include <atomic>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
@@ -24,6 +27,36 @@
 #include <Reaktoro/Common/StringList.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The number of phases up to which lookups by phase name use a linear search instead of hash tables.
+const auto max_size_linear_search = 16;
+
+} // namespace
+
+struct PhaseList::Lookup
+{
+    /// The index of the first phase with each name.
+    Map<String, Index> names;
+
+    /// The index of the first phase containing a species with each name.
+    Map<String, Index> species;
+
+    /// Register a phase with given index in the hash tables, unless phases with same attributes come before it.
+    auto add(Phase const& phase, Index i) -> void
+    {
+        names.emplace(phase.name(), i);
+        for(auto const& s : phase.species())
+            species.emplace(s.name(), i);
+    }
+
+    /// Return the index of the phase with given key in a hash table or the number of phases if not found.
+    static auto find(Map<String, Index> const& table, String const& key, Index notfound) -> Index
+    {
+        const auto it = table.find(key);
+        return it != table.end() ? it->second : notfound;
+    }
+};
 
 PhaseList::PhaseList()
 {}
@@ -39,6 +72,11 @@ PhaseList::PhaseList(const Vec<Phase>& phases)
 auto PhaseList::append(const Phase& phase) -> void
 {
     m_phases.push_back(phase);
+
+    // Extend the hash tables if not shared with copies of this list, so that interleaved appends and lookups stay cheap
+    if(m_lookup && m_lookup.use_count() == 1)
+        m_lookup->add(m_phases.back(), m_phases.size() - 1);
+    else m_lookup.reset();
 }
 
 auto PhaseList::data() const -> const Vec<Phase>&
@@ -64,7 +102,7 @@ auto PhaseList::species() const -> SpeciesList
     Vec<Species> species;
     species.reserve(num_species);
     for(const auto& phase : m_phases)
-        species = concatenate(species, phase.species().data());
+        species.insert(species.end(), phase.species().begin(), phase.species().end());
     return species;
 }
 
@@ -75,6 +113,7 @@ auto PhaseList::operator[](Index i) const -> const Phase&
 
 auto PhaseList::operator[](Index i) -> Phase&
 {
+    m_lookup.reset(); // the phase may be changed via the returned reference
     return m_phases[i];
 }
 
@@ -85,7 +124,9 @@ auto PhaseList::find(const String& name) const -> Index
 
 auto PhaseList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_phases, RKT_LAMBDA(p, p.name() == name));
+    if(size() <= max_size_linear_search)
+        return indexfn(m_phases, RKT_LAMBDA(p, p.name() == name));
+    return Lookup::find(lookup().names, name, size());
 }
 
 auto PhaseList::findWithSpecies(Index index) const -> Index
@@ -101,7 +142,7 @@ auto PhaseList::findWithSpecies(Index index) const -> Index
 
 auto PhaseList::findWithSpecies(const String& name) const -> Index
 {
-    return indexfn(m_phases, RKT_LAMBDA(p, containsfn(p.species(), RKT_LAMBDA(s, s.name() == name))));
+    return Lookup::find(lookup().species, name, size());
 }
 
 auto PhaseList::findWithAggregateState(AggregateState option) const -> Index
@@ -249,6 +290,7 @@ auto PhaseList::indicesSpeciesInPhases(const Indices& iphases) const -> Indices
 
 PhaseList::operator Vec<Phase>&()
 {
+    m_lookup.reset(); // the phases may be changed via the returned reference
     return m_phases;
 }
 
@@ -257,6 +299,22 @@ PhaseList::operator Vec<Phase>const&() const
     return m_phases;
 }
 
+auto PhaseList::lookup() const -> Lookup const&
+{
+    // Built by the first thread that needs the hash tables and then shared with the others (see SpeciesList::lookup)
+    auto current = std::atomic_load(&m_lookup);
+    if(current)
+        return *current;
+
+    auto created = std::make_shared<Lookup>();
+    for(auto i = 0; i < m_phases.size(); ++i)
+        created->add(m_phases[i], i);
+
+    if(std::atomic_compare_exchange_strong(&m_lookup, &current, created))
+        return *created;
+    return *current;
+}
+
 auto operator+(const PhaseList& a, const PhaseList& b) -> PhaseList
 {
     return concatenate(a, b);
@@ -137,6 +137,15 @@ private:
     /// The phases stored in the list.
     Vec<Phase> m_phases;
 
+    /// The hash tables used to find phases by name and by the names of their species (built on first lookup).
+    struct Lookup;
+
+    /// The hash tables of the phases in the list (shared among copies and reset whenever the list may change).
+    mutable SharedPtr<Lookup> m_lookup;
+
+    /// Return the hash tables of the phases in the list, building them if needed.
+    auto lookup() const -> Lookup const&;
+
 public:
     /// Construct an PhaseList object with given begin and end iterators.
     template<typename InputIterator>
@@ -145,21 +154,15 @@ public:
     /// Return begin const iterator of this PhaseList instance (for STL compatibility reasons).
     auto begin() const { return m_phases.begin(); }
 
-    /// Return begin iterator of this PhaseList instance (for STL compatibility reasons).
-    auto begin() { return m_phases.begin(); }
-
     /// Return end const iterator of this PhaseList instance (for STL compatibility reasons).
     auto end() const { return m_phases.end(); }
 
-    /// Return end iterator of this PhaseList instance (for STL compatibility reasons).
-    auto end() { return m_phases.end(); }
-
     /// Append a new Phase at the back of the container (for STL compatibility reasons).
     auto push_back(const Phase& species) -> void { append(species); }
 
     /// Insert a container of Phase objects into this PhaseList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_phases.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_lookup.reset(); m_phases.insert(pos, begin, end); }
 
     /// The type of the value stored in a PhaseList (for STL compatibility reasons).
     using value_type = Phase;
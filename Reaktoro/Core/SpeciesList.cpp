@@ -17,6 +17,10 @@
 
 #include "SpeciesList.hpp"
 
+// C++ includes
+#include <atomic>
+#include <cstring>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -25,6 +29,66 @@
 #include <Reaktoro/Core/ChemicalFormula.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The number of species up to which lookups use a linear search instead of hash tables.
+const auto max_size_linear_search = 16;
+
+/// Return a key that is the same for two chemical formulas if and only if they are equivalent.
+/// @see ChemicalFormula::equivalent
+auto formulaKey(ChemicalFormula const& formula) -> String
+{
+    auto elements = formula.elements();
+    std::sort(elements.begin(), elements.end());
+
+    String key;
+    const auto append = [&](double value)
+    {
+        value += 0.0; // ensure -0.0 and 0.0 produce the same key
+        char bytes[sizeof(double)];
+        std::memcpy(bytes, &value, sizeof(double));
+        key.append(bytes, sizeof(double));
+    };
+
+    for(auto const& [symbol, coeff] : elements)
+    {
+        key.append(symbol);
+        key.push_back('\0');
+        append(coeff);
+    }
+    append(formula.charge());
+
+    return key;
+}
+
+} // namespace
+
+struct SpeciesList::Lookup
+{
+    /// The index of the first species with each name.
+    Map<String, Index> names;
+
+    /// The index of the first species with each formula (identified by its key).
+    Map<String, Index> formulas;
+
+    /// The index of the first species with each substance name.
+    Map<String, Index> substances;
+
+    /// Register a species with given index in the hash tables, unless species with same attributes come before it.
+    auto add(Species const& species, Index i) -> void
+    {
+        names.emplace(species.name(), i);
+        formulas.emplace(formulaKey(species.formula()), i);
+        substances.emplace(species.substance(), i);
+    }
+
+    /// Return the index of the species with given key in a hash table or the number of species if not found.
+    static auto find(Map<String, Index> const& table, String const& key, Index notfound) -> Index
+    {
+        const auto it = table.find(key);
+        return it != table.end() ? it->second : notfound;
+    }
+};
 
 SpeciesList::SpeciesList()
 {}
@@ -44,6 +108,11 @@ SpeciesList::SpeciesList(const StringList& formulas)
 auto SpeciesList::append(const Species& species) -> void
 {
     m_species.push_back(species);
+
+    // Extend the hash tables if not shared with copies of this list, so that interleaved appends and lookups stay cheap
+    if(m_lookup && m_lookup.use_count() == 1)
+        m_lookup->add(m_species.back(), m_species.size() - 1);
+    else m_lookup.reset();
 }
 
 auto SpeciesList::data() const -> const Vec<Species>&
@@ -80,6 +149,7 @@ auto SpeciesList::operator[](Index i) const -> const Species&
 
 auto SpeciesList::operator[](Index i) -> Species&
 {
+    m_lookup.reset(); // the species may be changed via the returned reference
     return m_species[i];
 }
 
@@ -90,17 +160,23 @@ auto SpeciesList::find(const String& name) const -> Index
 
 auto SpeciesList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.name() == name));
+    if(size() <= max_size_linear_search)
+        return indexfn(m_species, RKT_LAMBDA(s, s.name() == name));
+    return Lookup::find(lookup().names, name, size());
 }
 
 auto SpeciesList::findWithFormula(const ChemicalFormula& formula) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, formula.equivalent(s.formula())));
+    if(size() <= max_size_linear_search)
+        return indexfn(m_species, RKT_LAMBDA(s, formula.equivalent(s.formula())));
+    return Lookup::find(lookup().formulas, formulaKey(formula), size());
 }
 
 auto SpeciesList::findWithSubstance(const String& substance) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.substance() == substance));
+    if(size() <= max_size_linear_search)
+        return indexfn(m_species, RKT_LAMBDA(s, s.substance() == substance));
+    return Lookup::find(lookup().substances, substance, size());
 }
 
 auto SpeciesList::index(const String& name) const -> Index
@@ -217,6 +293,7 @@ auto SpeciesList::withElementsOf(const StringList& formulas) const -> SpeciesLis
 
 SpeciesList::operator Vec<Species>&()
 {
+    m_lookup.reset(); // the species may be changed via the returned reference
     return m_species;
 }
 
@@ -225,6 +302,23 @@ SpeciesList::operator const Vec<Species>&() const
     return m_species;
 }
 
+auto SpeciesList::lookup() const -> Lookup const&
+{
+    // Lookups may happen concurrently on a list shared among threads (e.g., that of a ChemicalSystem),
+    // so the hash tables are built by the first thread that needs them and then shared with the others
+    auto current = std::atomic_load(&m_lookup);
+    if(current)
+        return *current;
+
+    auto created = std::make_shared<Lookup>();
+    for(auto i = 0; i < m_species.size(); ++i)
+        created->add(m_species[i], i);
+
+    if(std::atomic_compare_exchange_strong(&m_lookup, &current, created))
+        return *created; // the hash tables just built are now stored in m_lookup
+    return *current; // another thread stored its hash tables first, which are now in current
+}
+
 auto operator+(const SpeciesList& a, const SpeciesList& b) -> SpeciesList
 {
     return concatenate(a, b);
@@ -169,6 +169,15 @@ private:
     /// The species stored in the list.
     Vec<Species> m_species;
 
+    /// The hash tables used to find species by name, formula and substance (built on first lookup in a long list).
+    struct Lookup;
+
+    /// The hash tables of the species in the list (shared among copies and reset whenever the list may change).
+    mutable SharedPtr<Lookup> m_lookup;
+
+    /// Return the hash tables of the species in the list, building them if needed.
+    auto lookup() const -> Lookup const&;
+
 public:
     /// Construct an SpeciesList object with given begin and end iterators.
     template<typename InputIterator>
@@ -177,21 +186,15 @@ public:
     /// Return begin const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto begin() const { return m_species.begin(); }
 
-    /// Return begin iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto begin() { return m_species.begin(); }
-
     /// Return end const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto end() const { return m_species.end(); }
 
-    /// Return end iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto end() { return m_species.end(); }
-
     /// Append a new Species at the back of the container (for STL compatibility reasons).
     auto push_back(const Species& species) -> void { append(species); }
 
     /// Insert a container of Species objects into this SpeciesList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_species.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_lookup.reset(); m_species.insert(pos, begin, end); }
 
     /// The type of the value stored in a SpeciesList (for STL compatibility reasons).
     using value_type = Species;
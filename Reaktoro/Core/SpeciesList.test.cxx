@@ -511,4 +511,41 @@ TEST_CASE("Testing SpeciesList", "[SpeciesList]")
     //-------------------------------------------------------------------------
     for(auto [i, species] : enumerate(specieslist))
         REQUIRE( species.name() == specieslist[i].name() );
+
+    //-------------------------------------------------------------------------
+    // TESTING LOOKUPS IN LONG LISTS (WITH HASH TABLES INSTEAD OF LINEAR SEARCH)
+    //-------------------------------------------------------------------------
+    SpeciesList longlist = SpeciesList("H2O H+ OH- H2 O2 Na+ Cl- NaCl CO2 HCO3- CO3-2 CH4 Ca+2 Mg+2 K+ SO4-2 HSO4- CaCO3 MgCO3 KCl");
+
+    longlist.append(Species("H2O").withName("H2O(l)").withSubstance("Water"));
+    longlist.append(Species("CO3Ca").withName("Calcite"));
+
+    REQUIRE( longlist.size() == 22 );
+
+    CHECK( longlist.findWithName("KCl") == 19 );
+    CHECK( longlist.findWithName("Calcite") == 21 );
+    CHECK( longlist.findWithName("XYZ") == longlist.size() );
+
+    CHECK( longlist.findWithFormula("H2O") == 0 );             // the first species with an equivalent formula is returned
+    CHECK( longlist.findWithFormula("CO3Ca") == 17 );          // formulas are equivalent irrespective of the order of the elements
+    CHECK( longlist.findWithFormula("SO4--") == 15 );          // formulas are equivalent irrespective of the notation of the charge
+    CHECK( longlist.findWithFormula("HSO4-2") == longlist.size() );
+    CHECK( longlist.findWithFormula("CaMg(CO3)2") == longlist.size() );
+
+    CHECK( longlist.findWithSubstance("Water") == 20 );
+    CHECK( longlist.findWithSubstance("XYZ") == longlist.size() );
+
+    longlist.append(Species("CaMg(CO3)2").withName("Dolomite")); // appending after a lookup must not break further lookups
+
+    CHECK( longlist.findWithName("Dolomite") == 22 );
+    CHECK( longlist.findWithFormula("CaMg(CO3)2") == 22 );
+
+    const SpeciesList copied = longlist; // copies share the hash tables of the original list until one of them changes
+
+    longlist[0] = Species("H2O").withName("Water(aq)");
+
+    CHECK( longlist.findWithName("H2O") == longlist.size() );
+    CHECK( longlist.findWithName("Water(aq)") == 0 );
+    CHECK( copied.findWithName("H2O") == 0 );
+    CHECK( copied.findWithName("Water(aq)") == copied.size() );
 }
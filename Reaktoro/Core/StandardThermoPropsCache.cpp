@@ -0,0 +1,313 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoPropsCache.hpp"
+
+// C++ includes
+#include <atomic>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The key identifying cached standard thermodynamic properties, including the derivative seeds of temperature and pressure.
+struct StandardThermoPropsKey
+{
+    double T  = 0.0; ///< The value of temperature (in K)
+    double Tx = 0.0; ///< The derivative seed of temperature
+    double P  = 0.0; ///< The value of pressure (in Pa)
+    double Px = 0.0; ///< The derivative seed of pressure
+
+    auto operator==(StandardThermoPropsKey const& other) const -> bool
+    {
+        return T == other.T && Tx == other.Tx && P == other.P && Px == other.Px;
+    }
+};
+
+auto makeKey(real const& T, real const& P) -> StandardThermoPropsKey
+{
+    return { T[0], T[1], P[0], P[1] };
+}
+
+/// The cached standard thermodynamic properties of the species at a temperature and pressure.
+struct StandardThermoPropsEntry
+{
+    StandardThermoPropsKey key;
+    ArrayXr G0;
+    ArrayXr H0;
+    ArrayXr V0;
+    ArrayXr VT0;
+    ArrayXr VP0;
+    ArrayXr Cp0;
+};
+
+/// The cached entries and counters of a thread.
+struct StandardThermoPropsSlot
+{
+    /// The mutex guarding this slot, only contended when the cache is inspected or configured from another thread.
+    std::mutex mutex;
+
+    /// The cached entries.
+    Vec<StandardThermoPropsEntry> entries;
+
+    /// The index of the entry to be overwritten next once the cache is full.
+    Index next = 0;
+
+    /// The number of lookups answered from the cache.
+    Index hits = 0;
+
+    /// The number of lookups that required the evaluation of the standard thermodynamic models.
+    Index misses = 0;
+
+    /// The accumulated time spent evaluating the properties stored in the cache (in s).
+    double evaltime = 0.0;
+
+    /// The number of evaluations accounted in `evaltime`.
+    Index numevals = 0;
+
+    /// The estimated time saved by the cache (in s).
+    double saved = 0.0;
+
+    auto find(StandardThermoPropsKey const& key) const -> Index
+    {
+        for(Index i = 0; i < entries.size(); ++i)
+            if(entries[i].key == key)
+                return i;
+        return entries.size();
+    }
+
+    auto resize(Index capacity) -> void
+    {
+        if(entries.size() > capacity)
+            entries.resize(capacity);
+        next = 0;
+    }
+};
+
+} // namespace
+
+struct StandardThermoPropsCache::Impl
+{
+    /// The cached entries and counters of each thread indexed by its memoization slot index (allocated on first use).
+    /// Each thread only looks up and stores properties in its own slot, so that chemical properties updated concurrently
+    /// in several threads with the same chemical system do not contend for a lock.
+    Array<std::atomic<StandardThermoPropsSlot*>, detail::memoization_max_threads> slots;
+
+    /// The maximum number of cached entries in each slot.
+    std::atomic<Index> capacity = 8;
+
+    /// The flag indicating whether caching is enabled.
+    std::atomic<bool> enabled = true;
+
+    Impl()
+    {
+        for(auto& slot : slots)
+            slot.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~Impl()
+    {
+        for(auto& slot : slots)
+            delete slot.load(std::memory_order_relaxed);
+    }
+
+    /// Return the slot of the calling thread or `nullptr` if the thread has no slot (in which case nothing is cached for it).
+    auto slot() -> StandardThermoPropsSlot*
+    {
+        const auto i = detail::memoizationThreadSlot();
+        if(i >= detail::memoization_max_threads)
+            return nullptr;
+        // Only the thread currently owning slot index `i` ever writes slot `i`
+        auto ptr = slots[i].load(std::memory_order_acquire);
+        if(ptr == nullptr)
+        {
+            ptr = new StandardThermoPropsSlot();
+            slots[i].store(ptr, std::memory_order_release);
+        }
+        return ptr;
+    }
+
+    /// Apply a function to every allocated slot while holding its lock.
+    template<typename Function>
+    auto foreach(Function const& f) const -> void
+    {
+        for(auto const& slot : slots)
+        {
+            if(auto ptr = slot.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> lock(ptr->mutex);
+                f(*ptr);
+            }
+        }
+    }
+};
+
+StandardThermoPropsCache::StandardThermoPropsCache()
+: pimpl(new Impl())
+{}
+
+StandardThermoPropsCache::~StandardThermoPropsCache()
+{}
+
+auto StandardThermoPropsCache::get(real const& T, real const& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) -> bool
+{
+    if(!pimpl->enabled.load(std::memory_order_relaxed))
+        return false;
+
+    auto slot = pimpl->slot();
+
+    if(slot == nullptr)
+        return false;
+
+    std::lock_guard<std::mutex> lock(slot->mutex);
+
+    const auto i = slot->find(makeKey(T, P));
+
+    if(i == slot->entries.size())
+    {
+        ++slot->misses;
+        return false;
+    }
+
+    auto const& entry = slot->entries[i];
+
+    G0  = entry.G0;
+    H0  = entry.H0;
+    V0  = entry.V0;
+    VT0 = entry.VT0;
+    VP0 = entry.VP0;
+    Cp0 = entry.Cp0;
+
+    ++slot->hits;
+
+    if(slot->numevals)
+        slot->saved += slot->evaltime / slot->numevals;
+
+    return true;
+}
+
+auto StandardThermoPropsCache::set(real const& T, real const& P, ArrayXrConstRef G0, ArrayXrConstRef H0, ArrayXrConstRef V0, ArrayXrConstRef VT0, ArrayXrConstRef VP0, ArrayXrConstRef Cp0, double elapsed) -> void
+{
+    const auto capacity = pimpl->capacity.load(std::memory_order_relaxed);
+
+    if(!pimpl->enabled.load(std::memory_order_relaxed) || capacity == 0)
+        return;
+
+    auto slot = pimpl->slot();
+
+    if(slot == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(slot->mutex);
+
+    const auto key = makeKey(T, P);
+
+    if(slot->find(key) < slot->entries.size())
+        return;
+
+    slot->evaltime += elapsed;
+    slot->numevals += 1;
+
+    StandardThermoPropsEntry entry{ key, G0, H0, V0, VT0, VP0, Cp0 };
+
+    auto& entries = slot->entries;
+
+    if(entries.size() < capacity)
+    {
+        entries.push_back(std::move(entry));
+        return;
+    }
+
+    auto& next = slot->next;
+    next = next % capacity;
+    entries[next] = std::move(entry);
+    ++next;
+}
+
+auto StandardThermoPropsCache::enable() -> void
+{
+    pimpl->enabled = true;
+}
+
+auto StandardThermoPropsCache::disable() -> void
+{
+    pimpl->enabled = false;
+    pimpl->foreach([](auto& slot) { slot.resize(0); });
+}
+
+auto StandardThermoPropsCache::isEnabled() const -> bool
+{
+    return pimpl->enabled;
+}
+
+auto StandardThermoPropsCache::setCapacity(Index capacity) -> void
+{
+    pimpl->capacity = capacity;
+    pimpl->foreach([&](auto& slot) { slot.resize(capacity); });
+}
+
+auto StandardThermoPropsCache::capacity() const -> Index
+{
+    return pimpl->capacity;
+}
+
+auto StandardThermoPropsCache::size() const -> Index
+{
+    Index size = 0;
+    pimpl->foreach([&](auto const& slot) { size += slot.entries.size(); });
+    return size;
+}
+
+auto StandardThermoPropsCache::hits() const -> Index
+{
+    Index hits = 0;
+    pimpl->foreach([&](auto const& slot) { hits += slot.hits; });
+    return hits;
+}
+
+auto StandardThermoPropsCache::misses() const -> Index
+{
+    Index misses = 0;
+    pimpl->foreach([&](auto const& slot) { misses += slot.misses; });
+    return misses;
+}
+
+auto StandardThermoPropsCache::savedTime() const -> double
+{
+    double saved = 0.0;
+    pimpl->foreach([&](auto const& slot) { saved += slot.saved; });
+    return saved;
+}
+
+auto StandardThermoPropsCache::clear() -> void
+{
+    pimpl->foreach([](auto& slot)
+    {
+        slot.entries.clear();
+        slot.next = 0;
+        slot.hits = 0;
+        slot.misses = 0;
+        slot.evaltime = 0.0;
+        slot.numevals = 0;
+        slot.saved = 0.0;
+    });
+}
+
+} // namespace Reaktoro
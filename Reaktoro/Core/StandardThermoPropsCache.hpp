@@ -0,0 +1,109 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// A cache of the standard thermodynamic properties of the species in a chemical system keyed on temperature and pressure.
+/// Chemical properties are often updated many times at the same temperature and pressure with only the species amounts
+/// changing (e.g., during the iterations of a chemical equilibrium calculation or in isothermal reactive transport
+/// simulations). The standard thermodynamic properties of the species depend only on temperature and pressure, so their
+/// evaluation is skipped in these updates using this cache. The keys include the autodiff derivative seeds of temperature
+/// and pressure, so properties evaluated while differentiating with respect to temperature or pressure are never returned
+/// for an update at the same values with different seeds. Each thread has its own cache entries, so that threads updating
+/// chemical properties of the same chemical system do not wait on each other; the counters are summed over all threads.
+class StandardThermoPropsCache
+{
+public:
+    /// Construct a default StandardThermoPropsCache object.
+    StandardThermoPropsCache();
+
+    /// Construct a copy of a StandardThermoPropsCache object [deleted].
+    StandardThermoPropsCache(StandardThermoPropsCache const&) = delete;
+
+    /// Destroy this StandardThermoPropsCache object.
+    ~StandardThermoPropsCache();
+
+    /// Assign a StandardThermoPropsCache object to this [deleted].
+    auto operator=(StandardThermoPropsCache const&) -> StandardThermoPropsCache& = delete;
+
+    /// Copy the cached standard thermodynamic properties of the species at given temperature and pressure, if available.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param[out] G0 The standard molar Gibbs energies of formation of the species (in J/mol)
+    /// @param[out] H0 The standard molar enthalpies of formation of the species (in J/mol)
+    /// @param[out] V0 The standard molar volumes of the species (in m³/mol)
+    /// @param[out] VT0 The temperature derivatives of the standard molar volumes of the species (in m³/(mol·K))
+    /// @param[out] VP0 The pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa))
+    /// @param[out] Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+    /// @return True if the properties were found in the cache.
+    auto get(real const& T, real const& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) -> bool;
+
+    /// Store the standard thermodynamic properties of the species at given temperature and pressure.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param G0 The standard molar Gibbs energies of formation of the species (in J/mol)
+    /// @param H0 The standard molar enthalpies of formation of the species (in J/mol)
+    /// @param V0 The standard molar volumes of the species (in m³/mol)
+    /// @param VT0 The temperature derivatives of the standard molar volumes of the species (in m³/(mol·K))
+    /// @param VP0 The pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa))
+    /// @param Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+    /// @param elapsed The time spent evaluating these properties (in s), used to estimate the time saved by the cache
+    auto set(real const& T, real const& P, ArrayXrConstRef G0, ArrayXrConstRef H0, ArrayXrConstRef V0, ArrayXrConstRef VT0, ArrayXrConstRef VP0, ArrayXrConstRef Cp0, double elapsed) -> void;
+
+    /// Enable caching of standard thermodynamic properties (the default).
+    auto enable() -> void;
+
+    /// Disable caching of standard thermodynamic properties (every update evaluates the standard thermodynamic models).
+    auto disable() -> void;
+
+    /// Return true if caching of standard thermodynamic properties is enabled.
+    auto isEnabled() const -> bool;
+
+    /// Set the maximum number of temperature-pressure pairs kept in the cache of each thread (default 8).
+    auto setCapacity(Index capacity) -> void;
+
+    /// Return the maximum number of temperature-pressure pairs kept in the cache of each thread.
+    auto capacity() const -> Index;
+
+    /// Return the number of temperature-pressure pairs currently in the caches of all threads.
+    auto size() const -> Index;
+
+    /// Return the number of lookups answered from the cache.
+    auto hits() const -> Index;
+
+    /// Return the number of lookups that required the evaluation of the standard thermodynamic models.
+    auto misses() const -> Index;
+
+    /// Return an estimate of the time saved by the cache (in s), based on the average time of the evaluations it avoided.
+    auto savedTime() const -> double;
+
+    /// Remove all cached properties and reset the counters.
+    auto clear() -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,39 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
+using namespace Reaktoro;
+
+void exportStandardThermoPropsCache(py::module& m)
+{
+    py::class_<StandardThermoPropsCache>(m, "StandardThermoPropsCache")
+        .def("enable", &StandardThermoPropsCache::enable, "Enable caching of standard thermodynamic properties (the default).")
+        .def("disable", &StandardThermoPropsCache::disable, "Disable caching of standard thermodynamic properties.")
+        .def("isEnabled", &StandardThermoPropsCache::isEnabled, "Return true if caching of standard thermodynamic properties is enabled.")
+        .def("setCapacity", &StandardThermoPropsCache::setCapacity, "Set the maximum number of temperature-pressure pairs kept in the cache.")
+        .def("capacity", &StandardThermoPropsCache::capacity, "Return the maximum number of temperature-pressure pairs kept in the cache.")
+        .def("size", &StandardThermoPropsCache::size, "Return the number of temperature-pressure pairs currently in the cache.")
+        .def("hits", &StandardThermoPropsCache::hits, "Return the number of lookups answered from the cache.")
+        .def("misses", &StandardThermoPropsCache::misses, "Return the number of lookups that required the evaluation of the standard thermodynamic models.")
+        .def("savedTime", &StandardThermoPropsCache::savedTime, "Return an estimate of the time saved by the cache (in s).")
+        .def("clear", &StandardThermoPropsCache::clear, "Remove all cached properties and reset the counters.")
+        ;
+}
@@ -0,0 +1,171 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <atomic>
+#include <thread>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/StandardThermoPropsCache.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing StandardThermoPropsCache class", "[StandardThermoPropsCache]")
+{
+    std::atomic<Index> numcalls = 0; // the number of evaluations of the standard thermodynamic models (possibly in several threads)
+
+    StandardThermoModel standard_thermo_model = [&](real T, real P)
+    {
+        ++numcalls;
+        StandardThermoProps props;
+        props.G0  = 0.1 * T*P;
+        props.H0  = 0.2 * T*P;
+        props.V0  = 0.3 * T*P;
+        props.VT0 = 0.4 * T*P;
+        props.VP0 = 0.5 * T*P;
+        props.Cp0 = 0.6 * T*P;
+        return props;
+    };
+
+    ActivityModel activity_model = [](ActivityPropsRef props, ActivityModelArgs args)
+    {
+        const auto [T, P, x] = args;
+        props = 0.0;
+        props.ln_a = x.log();
+    };
+
+    Database db;
+
+    db.addSpecies( Species("H2O(g)").withStandardThermoModel(standard_thermo_model) );
+    db.addSpecies( Species("CO2(g)").withStandardThermoModel(standard_thermo_model) );
+
+    Vec<Phase> phases
+    {
+        Phase()
+            .withName("SomeGas")
+            .withActivityModel(activity_model)
+            .withIdealActivityModel(activity_model)
+            .withStateOfMatter(StateOfMatter::Gas)
+            .withSpecies({
+                db.species().get("H2O(g)"),
+                db.species().get("CO2(g)")})
+    };
+
+    ChemicalSystem system(db, phases);
+
+    auto& cache = system.standardThermoPropsCache();
+
+    ChemicalProps props(system);
+
+    real T = 300.0;
+    real P = 1.0e5;
+
+    CHECK( cache.isEnabled() );
+
+    props.update(T, P, ArrayXr{{ 1.0, 2.0 }});
+
+    CHECK( numcalls == 2 );
+    CHECK( cache.size() == 1 );
+    CHECK( cache.misses() == 1 );
+    CHECK( cache.hits() == 0 );
+
+    // Only species amounts change, so the standard thermodynamic models are not evaluated again
+    props.update(T, P, ArrayXr{{ 3.0, 4.0 }});
+    props.updateIdeal(T, P, ArrayXr{{ 5.0, 6.0 }});
+
+    CHECK( numcalls == 2 );
+    CHECK( cache.hits() == 2 );
+    CHECK( cache.savedTime() >= 0.0 );
+    CHECK( props.speciesStandardGibbsEnergies().isApprox(ArrayXr{{ 0.1*T*P, 0.1*T*P }}) );
+
+    // The cache is shared by all ChemicalProps objects of the system and its copies
+    const ChemicalSystem copy = system;
+    ChemicalProps other(copy);
+    other.update(T, P, ArrayXr{{ 1.0, 1.0 }});
+
+    CHECK( numcalls == 2 );
+    CHECK( cache.hits() == 3 );
+
+    // A different temperature requires new evaluations
+    props.update(T + 10.0, P, ArrayXr{{ 1.0, 2.0 }});
+
+    CHECK( numcalls == 4 );
+    CHECK( cache.size() == 2 );
+
+    // A seeded temperature is not served with properties computed without seeds
+    autodiff::seed(T);
+    props.update(T, P, ArrayXr{{ 1.0, 2.0 }});
+    autodiff::unseed(T);
+
+    CHECK( numcalls == 6 );
+    CHECK( grad(props.speciesStandardGibbsEnergies()).isApprox(ArrayXd{{ 0.1*P.val(), 0.1*P.val() }}) );
+
+    props.update(T, P, ArrayXr{{ 1.0, 2.0 }});
+
+    CHECK( numcalls == 6 );
+    CHECK( grad(props.speciesStandardGibbsEnergies()).isZero() );
+
+    // A limited capacity overwrites the oldest entries
+    cache.setCapacity(1);
+
+    CHECK( cache.size() == 1 );
+
+    // A disabled cache evaluates the standard thermodynamic models in every update
+    cache.disable();
+
+    props.update(T, P, ArrayXr{{ 1.0, 2.0 }});
+    props.update(T, P, ArrayXr{{ 1.0, 2.0 }});
+
+    CHECK( numcalls == 10 );
+    CHECK( cache.size() == 0 );
+
+    cache.enable();
+    cache.clear();
+
+    CHECK( cache.hits() == 0 );
+    CHECK( cache.misses() == 0 );
+    CHECK( cache.savedTime() == 0.0 );
+
+    // Threads updating chemical properties of the same system use their own cache entries
+    const auto numthreads = 4;
+
+    Vec<ArrayXr> G0s(numthreads);
+    Vec<std::thread> threads;
+    for(auto i = 0; i < numthreads; ++i)
+        threads.emplace_back([&, i]()
+        {
+            ChemicalProps local(system);
+            local.update(T, P, ArrayXr{{ 1.0, 2.0 }});
+            local.update(T, P, ArrayXr{{ 3.0, 4.0 }});
+            G0s[i] = local.speciesStandardGibbsEnergies();
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    // A thread may reuse the cache entries of a thread that has already finished
+    CHECK( cache.hits() + cache.misses() == 2 * numthreads );
+    CHECK( cache.misses() >= 1 );
+    CHECK( cache.misses() <= numthreads );
+    CHECK( cache.size() == cache.misses() );
+
+    for(auto const& G0 : G0s)
+        CHECK( G0.isApprox(ArrayXr{{ 0.1*T*P, 0.1*T*P }}) );
+}
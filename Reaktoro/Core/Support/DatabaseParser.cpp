@@ -17,6 +17,9 @@
 
 #include "DatabaseParser.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
@@ -26,6 +29,55 @@
 #include <Reaktoro/Serialization.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Used to create a model whose construction from its parameters is delayed until its first evaluation.
+template<typename ModelType>
+struct LazyModel;
+
+template<typename Result, typename... Args>
+struct LazyModel<Model<Result(Args...)>>
+{
+    using ModelType = Model<Result(Args...)>;
+    using ResultRef = typename ModelType::ResultRef;
+
+    /// Return a model whose parameters are only produced when first requested and which is only constructed from them when first evaluated.
+    static auto create(Fn<Data()> const& paramsfn) -> ModelType
+    {
+        struct Holder
+        {
+            std::once_flag paramsflag;
+            std::once_flag modelflag;
+            Fn<Data()> paramsfn;
+            Data params;
+            ModelType model;
+
+            auto getParams() -> Data const&
+            {
+                std::call_once(paramsflag, [&]() { params = paramsfn(); });
+                return params;
+            }
+
+            auto getModel() -> ModelType const&
+            {
+                std::call_once(modelflag, [&]() { model = getParams().template as<ModelType>(); });
+                return model;
+            }
+        };
+
+        auto holder = std::make_shared<Holder>();
+        holder->paramsfn = paramsfn;
+
+        ModelEvaluator<ResultRef, Args...> evalfn = [holder](ResultRef res, Args... args)
+        {
+            holder->getModel().apply(res, args...);
+        };
+
+        return ModelType::WithLazyParams(evalfn, [holder]() { return holder->getParams(); });
+    }
+};
+
+} // namespace
 
 struct DatabaseParser::Impl
 {
@@ -38,6 +90,9 @@ struct DatabaseParser::Impl
     ///< The database contents parsed from YAML or JSON into a Data object.
     Data doc;
 
+    ///< The function that decodes the parameters of a standard thermodynamic model with given index if these are stored apart from `doc`.
+    Fn<Data(Index)> modelparams;
+
     /// Construct a default DatabaseParser::Impl object.
     Impl()
     {}
@@ -48,8 +103,8 @@ struct DatabaseParser::Impl
     {}
 
     /// Construct a DatabaseParser::Impl object with given Data object.
-    Impl(const Data& doc, const ElementList& elements)
-    : doc(doc), element_list(elements)
+    Impl(const Data& doc, const ElementList& elements, const Fn<Data(Index)>& modelparams = {})
+    : doc(doc), element_list(elements), modelparams(modelparams)
     {
         errorif(!doc.isDict(), "Could not understand your YAML or JSON database file with content:\n", doc.repr(), "\n",
             "Repeating the error message here in case the above printed content is too long.\n",
@@ -212,7 +267,9 @@ struct DatabaseParser::Impl
     auto createStandardThermoModel(Data const& attributes) -> StandardThermoModel
     {
         if(attributes.exists("StandardThermoModel"))
-            return attributes.at("StandardThermoModel").as<StandardThermoModel>();
+            return modelparams ?
+                createLazyModel<StandardThermoModel>(attributes.at("StandardThermoModel")) :
+                attributes.at("StandardThermoModel").as<StandardThermoModel>();
         return {};
     }
 
@@ -252,7 +309,18 @@ struct DatabaseParser::Impl
     auto createReactionStandardThermoModel(Data const& data) -> ReactionStandardThermoModel
     {
         errorif(!data.exists("ReactionStandardThermoModel"), "Missing `ReactionStandardThermoModel` specification in:\n\n", data.repr());
-        return data["ReactionStandardThermoModel"].as<ReactionStandardThermoModel>();
+        return modelparams ?
+            createLazyModel<ReactionStandardThermoModel>(data["ReactionStandardThermoModel"]) :
+            data["ReactionStandardThermoModel"].as<ReactionStandardThermoModel>();
+    }
+
+    /// Create a model whose parameters are decoded on demand with given Data object holding their index.
+    template<typename ModelType>
+    auto createLazyModel(Data const& data) -> ModelType
+    {
+        errorif(!data.isInteger() || data.asInteger() < 0, "Expecting a non-negative integer as the index of the parameters of a standard thermodynamic model, but got:\n\n", data.repr());
+        const auto index = static_cast<Index>(data.asInteger());
+        return LazyModel<ModelType>::create([modelparams = modelparams, index]() { return modelparams(index); });
     }
 
     // auto createStandardVolumeModel(Data const& child) -> StandardVolumeModel
@@ -277,6 +345,10 @@ DatabaseParser::DatabaseParser(Data const& doc, const ElementList& elements)
 : pimpl(new Impl(doc, elements))
 {}
 
+DatabaseParser::DatabaseParser(Data const& doc, const ElementList& elements, const Fn<Data(Index)>& modelparams)
+: pimpl(new Impl(doc, elements, modelparams))
+{}
+
 DatabaseParser::~DatabaseParser()
 {}
 
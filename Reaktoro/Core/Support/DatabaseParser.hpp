@@ -44,6 +44,11 @@ public:
     /// Use this if there are Element objects that should be reused to create the Species objects.
     explicit DatabaseParser(const Data& node, const ElementList& elements);
 
+    /// Construct a DatabaseParser object with given Data and Element objects in which model parameters are stored apart.
+    /// The standard thermodynamic models of the species and their formation reactions are given in `node` as integer indices
+    /// whose parameters are decoded with `modelparams` only when first needed, which speeds up the creation of large databases.
+    explicit DatabaseParser(const Data& node, const ElementList& elements, const Fn<Data(Index)>& modelparams);
+
     /// Destroy this DatabaseParser object.
     ~DatabaseParser();
 
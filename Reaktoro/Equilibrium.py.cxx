@@ -20,6 +20,7 @@
 
 void exportEquilibriumConditions(py::module& m);
 void exportEquilibriumDims(py::module& m);
+void exportEquilibriumHotStart(py::module& m);
 void exportEquilibriumOptions(py::module& m);
 void exportEquilibriumRestrictions(py::module& m);
 void exportEquilibriumResult(py::module& m);
@@ -35,6 +36,7 @@ void exportEquilibrium(py::module& m)
 {
     exportEquilibriumConditions(m);
     exportEquilibriumDims(m);
+    exportEquilibriumHotStart(m);
     exportEquilibriumOptions(m);
     exportEquilibriumRestrictions(m);
     exportEquilibriumResult(m);
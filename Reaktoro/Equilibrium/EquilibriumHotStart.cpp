@@ -0,0 +1,72 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "EquilibriumHotStart.hpp"
+
+// Optima includes
+#include <Optima/State.hpp>
+
+namespace Reaktoro {
+
+struct EquilibriumHotStart::Impl
+{
+    /// The Optima::State object computed in the last equilibrium calculation.
+    Optima::State optstate;
+
+    /// The flag indicating whether `optstate` has been set by an equilibrium calculation.
+    bool initialized = false;
+};
+
+EquilibriumHotStart::EquilibriumHotStart()
+: pimpl(new Impl())
+{}
+
+EquilibriumHotStart::EquilibriumHotStart(EquilibriumHotStart const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+EquilibriumHotStart::~EquilibriumHotStart()
+{}
+
+auto EquilibriumHotStart::operator=(EquilibriumHotStart other) -> EquilibriumHotStart&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto EquilibriumHotStart::reset() -> void
+{
+    pimpl->initialized = false;
+}
+
+auto EquilibriumHotStart::empty() const -> bool
+{
+    return !pimpl->initialized;
+}
+
+auto EquilibriumHotStart::setOptimaState(Optima::State const& state) -> void
+{
+    pimpl->optstate = state;
+    pimpl->initialized = true;
+}
+
+auto EquilibriumHotStart::optimaState() const -> Optima::State const&
+{
+    return pimpl->optstate;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,71 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+// Forward declarations (Optima)
+namespace Optima { class State; }
+
+namespace Reaktoro {
+
+/// The state of a chemical equilibrium calculation used to hot-start a subsequent one.
+/// An EquilibriumHotStart object stores the optimization state computed in the
+/// last equilibrium calculation in which it was used, i.e., the Lagrange
+/// multipliers, the stabilities of the species, and the partition of the
+/// variables into basic and non-basic ones. Passing it back to
+/// EquilibriumSolver::solve starts the next calculation from this state
+/// instead of the one stored in the given ChemicalState object. This is
+/// useful when many calculations with slowly varying inputs are performed,
+/// such as in reactive transport simulations, in which an
+/// EquilibriumHotStart object can be kept for each cell.
+class EquilibriumHotStart
+{
+public:
+    /// Construct a default EquilibriumHotStart object.
+    EquilibriumHotStart();
+
+    /// Construct a copy of an EquilibriumHotStart object.
+    EquilibriumHotStart(EquilibriumHotStart const& other);
+
+    /// Destroy this EquilibriumHotStart object.
+    ~EquilibriumHotStart();
+
+    /// Assign a copy of an EquilibriumHotStart object to this.
+    auto operator=(EquilibriumHotStart other) -> EquilibriumHotStart&;
+
+    /// Reset this hot-start state so that the next calculation starts from its given chemical state alone.
+    auto reset() -> void;
+
+    /// Return true if this hot-start state has not yet been set by an equilibrium calculation.
+    auto empty() const -> bool;
+
+    /// Set the Optima::State object computed in the last equilibrium calculation.
+    auto setOptimaState(Optima::State const& state) -> void;
+
+    /// Return the Optima::State object computed in the last equilibrium calculation.
+    auto optimaState() const -> Optima::State const&;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,33 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Equilibrium/EquilibriumHotStart.hpp>
+using namespace Reaktoro;
+
+void exportEquilibriumHotStart(py::module& m)
+{
+    py::class_<EquilibriumHotStart>(m, "EquilibriumHotStart")
+        .def(py::init<>())
+        .def("clone", [](EquilibriumHotStart const& self) { return EquilibriumHotStart(self); }, "Return a deep copy of this EquilibriumHotStart object.")
+        .def("reset", &EquilibriumHotStart::reset, "Reset this hot-start state so that the next calculation starts from its given chemical state alone.")
+        .def("empty", &EquilibriumHotStart::empty, "Return true if this hot-start state has not yet been set by an equilibrium calculation.")
+        ;
+}
@@ -66,6 +66,19 @@ struct EquilibriumOptions
 
     /// The calculation mode of the Hessian of the Gibbs energy function
     GibbsHessian hessian = GibbsHessian::PartiallyExact;
+
+    /// The flag indicating if exact columns of the Hessian of the Gibbs energy function should be computed with compressed seeding.
+    /// When true, species in different phases are seeded together and their
+    /// Hessian columns are recovered from a single evaluation of the chemical
+    /// properties, so that the number of evaluations needed for the exact
+    /// columns drops from the number of species to the size of the largest
+    /// phase. This assumes the chemical potentials of the species in a phase
+    /// depend only on the amounts of the species in that phase, which does not
+    /// hold for activity models that use the state of another phase (e.g., ion
+    /// exchange models using the state of the aqueous phase). Compressed seeding
+    /// is only used when there are no *p* control variables and the Jacobian of
+    /// the chemical properties is not being assembled.
+    bool use_compressed_hessian_seeding = false;
 };
 
 } // namespace Reaktoro
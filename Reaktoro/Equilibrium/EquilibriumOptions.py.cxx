@@ -30,5 +30,6 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
         .def_readwrite("logarithm_barrier_factor", &EquilibriumOptions::logarithm_barrier_factor)
         .def_readwrite("use_ideal_activity_models", &EquilibriumOptions::use_ideal_activity_models)
+        .def_readwrite("use_compressed_hessian_seeding", &EquilibriumOptions::use_compressed_hessian_seeding)
         ;
 }
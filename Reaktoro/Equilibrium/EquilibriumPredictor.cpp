@@ -24,6 +24,9 @@
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 
+// Optima includes
+#include <Optima/State.hpp>
+
 namespace Reaktoro {
 namespace {
 
@@ -55,14 +58,22 @@ auto getPressureFn(Strings const& inputs) -> GetterFn
 
 struct EquilibriumPredictor::Impl
 {
-    const ChemicalState state0;
-    const EquilibriumSensitivity sensitivity0;
+    const SharedPtr<const ChemicalState::Equilibrium> equilibrium; ///< The equilibrium data completed with the predicted values in predicted states (possibly shared with other predictors).
     const VectorXd n0;    ///< The species amounts *n* at the reference equilibrium state.
     const VectorXd p0;    ///< The control variables *p* at the reference equilibrium state.
     const VectorXd q0;    ///< The control variables *q* at the reference equilibrium state.
     const VectorXd w0;    ///< The input variables *w* at the reference equilibrium state.
     const VectorXd c0;    ///< The component amounts *c* at the reference equilibrium state.
     const VectorXd u0;    ///< The chemical properties *u* at the reference equilibrium state.
+    const ArrayXl jb0;    ///< The indices of the primary species at the reference equilibrium state.
+    const MatrixXd dndw0; ///< The derivatives *dn/dw* at the reference equilibrium state.
+    const MatrixXd dpdw0; ///< The derivatives *dp/dw* at the reference equilibrium state.
+    const MatrixXd dqdw0; ///< The derivatives *dq/dw* at the reference equilibrium state.
+    const MatrixXd dudw0; ///< The derivatives *du/dw* at the reference equilibrium state.
+    const MatrixXd dndc0; ///< The derivatives *dn/dc* at the reference equilibrium state.
+    const MatrixXd dpdc0; ///< The derivatives *dp/dc* at the reference equilibrium state.
+    const MatrixXd dqdc0; ///< The derivatives *dq/dc* at the reference equilibrium state.
+    const MatrixXd dudc0; ///< The derivatives *du/dc* at the reference equilibrium state.
     const Index Nn;       ///< The size of vector *n* with amounts of the species in the chemical system.
     const Index Nu;       ///< The size of vector *u* with the serialized properties of the chemical system.
     GetterFn getT;        ///< The function that gets temperature from either *p* or *w* depending if it is known or unwknon in the equilibrium calculation.
@@ -70,19 +81,33 @@ struct EquilibriumPredictor::Impl
 
     /// Construct a EquilibriumPredictor object.
     Impl(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0)
-    : state0(state0), sensitivity0(sensitivity0),
-      n0(state0.speciesAmounts()),
-      p0(state0.equilibrium().p()),
-      q0(state0.equilibrium().q()),
-      w0(state0.equilibrium().w()),
-      c0(state0.equilibrium().c()),
-      u0(state0.props()),
+    : Impl(state0.equilibrium(), state0.speciesAmounts(), VectorXd(state0.props()), sensitivity0, nullptr)
+    {}
+
+    /// Construct a EquilibriumPredictor object with given reference data.
+    Impl(ChemicalState::Equilibrium const& equilibrium0, VectorXdConstRef n0, VectorXdConstRef u0, EquilibriumSensitivity const& sensitivity0, SharedPtr<const ChemicalState::Equilibrium> const& equilibrium)
+    : equilibrium(equilibrium ? equilibrium : std::make_shared<const ChemicalState::Equilibrium>(equilibrium0)),
+      n0(n0),
+      p0(equilibrium0.p()),
+      q0(equilibrium0.q()),
+      w0(equilibrium0.w()),
+      c0(equilibrium0.c()),
+      u0(u0),
+      jb0(equilibrium0.indicesPrimarySpecies()),
+      dndw0(sensitivity0.dndw()),
+      dpdw0(sensitivity0.dpdw()),
+      dqdw0(sensitivity0.dqdw()),
+      dudw0(sensitivity0.dudw()),
+      dndc0(sensitivity0.dndc()),
+      dpdc0(sensitivity0.dpdc()),
+      dqdc0(sensitivity0.dqdc()),
+      dudc0(sensitivity0.dudc()),
       Nn(n0.size()),
       Nu(u0.size()),
-      getT(getTemperatureFn(state0.equilibrium().namesInputVariables())),
-      getP(getPressureFn(state0.equilibrium().namesInputVariables()))
+      getT(getTemperatureFn(equilibrium0.namesInputVariables())),
+      getP(getPressureFn(equilibrium0.namesInputVariables()))
     {
-        errorif(state0.equilibrium().w().size() == 0,
+        errorif(equilibrium0.w().size() == 0,
             "EquilibriumPredictor expects a ChemicalState object that "
             "has been used in a call to EquilibriumSolver::solve.");
     }
@@ -103,36 +128,37 @@ struct EquilibriumPredictor::Impl
 
     auto predict(ChemicalState& state, VectorXdConstRef const& dw, VectorXdConstRef const& dc) const -> void
     {
-        const auto dndw0 = sensitivity0.dndw(); // The derivatives *dn/dw* at the reference equilibrium state.
-        const auto dpdw0 = sensitivity0.dpdw(); // The derivatives *dp/dw* at the reference equilibrium state.
-        const auto dqdw0 = sensitivity0.dqdw(); // The derivatives *dq/dw* at the reference equilibrium state.
-        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* at the reference equilibrium state.
-        const auto dndc0 = sensitivity0.dndc(); // The derivatives *dn/dc* at the reference equilibrium state.
-        const auto dpdc0 = sensitivity0.dpdc(); // The derivatives *dp/dc* at the reference equilibrium state.
-        const auto dqdc0 = sensitivity0.dqdc(); // The derivatives *dq/dc* at the reference equilibrium state.
-        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* at the reference equilibrium state.
-
-        const auto n = n0 + dndw0*dw + dndc0*dc;
-        const auto p = p0 + dpdw0*dw + dpdc0*dc;
-        const auto q = q0 + dqdw0*dw + dqdc0*dc;
-        const auto u = u0 + dudw0*dw + dudc0*dc;
-
-        const auto w = w0 + dw;
-        const auto c = c0 + dc;
+        const VectorXd n = n0 + dndw0*dw + dndc0*dc;
+        const VectorXd p = p0 + dpdw0*dw + dpdc0*dc;
+        const VectorXd q = q0 + dqdw0*dw + dqdc0*dc;
+        const VectorXd u = u0 + dudw0*dw + dudc0*dc;
+
+        const VectorXd w = w0 + dw;
+        const VectorXd c = c0 + dc;
+
+        // The state of the optimization solver with the predicted variables and the primary species at the reference state
+        Optima::State optstate = equilibrium->optimaState();
+        optstate.x.resize(n.size() + q.size());
+        optstate.x << n, q;
+        optstate.p = p;
+        optstate.jb = jb0;
+        optstate.jn.resize(Nn - jb0.size());
+        Vec<bool> isprimary(Nn, false);
+        for(auto i : jb0)
+            isprimary[i] = true;
+        for(Index i = 0, j = 0; i < Nn; ++i)
+            if(!isprimary[i])
+                optstate.jn[j++] = i;
 
         state.setSpeciesAmounts(n);
         state.props().update(u);
-        state.equilibrium() = state0.equilibrium();
-        state.equilibrium().setControlVariablesP(p);
-        state.equilibrium().setControlVariablesQ(q);
+        state.equilibrium() = *equilibrium;
+        state.equilibrium().setOptimaState(optstate);
         state.equilibrium().setInputVariables(w);
         state.equilibrium().setInitialComponentAmounts(c);
 
-        auto const& pp = state.equilibrium().p();
-        auto const& ww = state.equilibrium().w();
-
-        const auto T = getT(pp, ww); // get temperature from predicted *p* or given *w*
-        const auto P = getP(pp, ww); // get pressure from predicted *p* or given *w*
+        const auto T = getT(p, w); // get temperature from predicted *p* or given *w*
+        const auto P = getP(p, w); // get pressure from predicted *p* or given *w*
 
         state.setTemperature(T);
         state.setPressure(P);
@@ -143,9 +169,6 @@ struct EquilibriumPredictor::Impl
     {
         assert(i < Nn);
 
-        const auto dudw0 = sensitivity0.dudw(); // The derivatives *du/dw* of the chemical properties of the chemical system wrt *w*.
-        const auto dudc0 = sensitivity0.dudc(); // The derivatives *du/dc* of the chemical properties of the chemical system wrt *c*.
-
         const auto dmuidw0 = dudw0.row(Nu - Nn + i); // The derivatives *dμ[i]/dw* of the chemical potential of the i-th species.
         const auto dmuidc0 = dudc0.row(Nu - Nn + i); // The derivatives *dμ[i]/dc* of the chemical potential of the i-th species.
         const auto mui0 = u0[Nu - Nn + i];
@@ -159,12 +182,39 @@ struct EquilibriumPredictor::Impl
         assert(i < Nn);
         return u0[Nu - Nn + i];
     }
+
+    /// Set the sensitivity derivatives at the reference equilibrium state.
+    auto referenceSensitivity(EquilibriumSensitivity& sensitivity) const -> void
+    {
+        sensitivity.dndw(dndw0);
+        sensitivity.dpdw(dpdw0);
+        sensitivity.dqdw(dqdw0);
+        sensitivity.dudw(dudw0);
+        sensitivity.dndc(dndc0);
+        sensitivity.dpdc(dpdc0);
+        sensitivity.dqdc(dqdc0);
+        sensitivity.dudc(dudc0);
+    }
+
+    /// Return an estimate of the memory used by this predictor (in bytes), excluding the shared equilibrium data.
+    auto memoryUsage() const -> Index
+    {
+        const auto numvalues =
+            n0.size() + p0.size() + q0.size() + w0.size() + c0.size() + u0.size() +
+            dndw0.size() + dpdw0.size() + dqdw0.size() + dudw0.size() +
+            dndc0.size() + dpdc0.size() + dqdc0.size() + dudc0.size();
+        return sizeof(EquilibriumPredictor) + sizeof(Impl) + numvalues * sizeof(double) + jb0.size() * sizeof(ArrayXl::Scalar);
+    }
 };
 
 EquilibriumPredictor::EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0)
 : pimpl(new Impl(state0, sensitivity0))
 {}
 
+EquilibriumPredictor::EquilibriumPredictor(ChemicalState::Equilibrium const& equilibrium0, VectorXdConstRef n0, VectorXdConstRef u0, EquilibriumSensitivity const& sensitivity0, SharedPtr<const ChemicalState::Equilibrium> const& equilibrium)
+: pimpl(new Impl(equilibrium0, n0, u0, sensitivity0, equilibrium))
+{}
+
 EquilibriumPredictor::EquilibriumPredictor(EquilibriumPredictor const& other)
 : pimpl(new Impl(*other.pimpl))
 {}
@@ -198,4 +248,49 @@ auto EquilibriumPredictor::speciesChemicalPotentialReference(Index ispecies) con
     return pimpl->speciesChemicalPotentialReference(ispecies);
 }
 
+auto EquilibriumPredictor::referenceSpeciesAmounts() const -> VectorXdConstRef
+{
+    return pimpl->n0;
+}
+
+auto EquilibriumPredictor::referenceControlVariablesP() const -> VectorXdConstRef
+{
+    return pimpl->p0;
+}
+
+auto EquilibriumPredictor::referenceControlVariablesQ() const -> VectorXdConstRef
+{
+    return pimpl->q0;
+}
+
+auto EquilibriumPredictor::referenceInputVariables() const -> VectorXdConstRef
+{
+    return pimpl->w0;
+}
+
+auto EquilibriumPredictor::referenceComponentAmounts() const -> VectorXdConstRef
+{
+    return pimpl->c0;
+}
+
+auto EquilibriumPredictor::referenceProperties() const -> VectorXdConstRef
+{
+    return pimpl->u0;
+}
+
+auto EquilibriumPredictor::referencePrimarySpecies() const -> ArrayXlConstRef
+{
+    return pimpl->jb0;
+}
+
+auto EquilibriumPredictor::referenceSensitivity(EquilibriumSensitivity& sensitivity) const -> void
+{
+    pimpl->referenceSensitivity(sensitivity);
+}
+
+auto EquilibriumPredictor::memoryUsage() const -> Index
+{
+    return pimpl->memoryUsage();
+}
+
 } // namespace Reaktoro
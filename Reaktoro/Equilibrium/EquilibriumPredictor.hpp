@@ -20,11 +20,11 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
 
 namespace Reaktoro {
 
 // Forward declarations
-class ChemicalState;
 class EquilibriumConditions;
 class EquilibriumSensitivity;
 
@@ -37,6 +37,17 @@ public:
     /// @param sensitivity0 The sensitivity derivatives of the chemical equilibrium state at the reference point.
     EquilibriumPredictor(ChemicalState const& state0, EquilibriumSensitivity const& sensitivity0);
 
+    /// Construct a EquilibriumPredictor object with given reference data (e.g., loaded from a file).
+    /// Only the values of the variables in `equilibrium0` are kept. The names of these variables and the
+    /// state of the optimization solver in predicted states (used in warm starts) come from `equilibrium`,
+    /// which can thus be shared by the predictors of many reference states of the same equilibrium problem.
+    /// @param equilibrium0 The equilibrium data of the reference chemical equilibrium state.
+    /// @param n0 The amounts of the species at the reference chemical equilibrium state.
+    /// @param u0 The serialized chemical properties of the system at the reference chemical equilibrium state.
+    /// @param sensitivity0 The sensitivity derivatives of the chemical equilibrium state at the reference point.
+    /// @param equilibrium The equilibrium data completed with the predicted values in predicted states (`equilibrium0` if null).
+    EquilibriumPredictor(ChemicalState::Equilibrium const& equilibrium0, VectorXdConstRef n0, VectorXdConstRef u0, EquilibriumSensitivity const& sensitivity0, SharedPtr<const ChemicalState::Equilibrium> const& equilibrium);
+
     /// Construct a copy of a EquilibriumPredictor object.
     EquilibriumPredictor(EquilibriumPredictor const& other);
 
@@ -63,6 +74,34 @@ public:
     /// Return the chemical potential of a species at given reference conditions.
     auto speciesChemicalPotentialReference(Index ispecies) const -> double;
 
+    /// Return the amounts of the species at the reference chemical equilibrium state.
+    auto referenceSpeciesAmounts() const -> VectorXdConstRef;
+
+    /// Return the control variables *p* at the reference chemical equilibrium state.
+    auto referenceControlVariablesP() const -> VectorXdConstRef;
+
+    /// Return the control variables *q* at the reference chemical equilibrium state.
+    auto referenceControlVariablesQ() const -> VectorXdConstRef;
+
+    /// Return the input variables *w* at the reference chemical equilibrium state.
+    auto referenceInputVariables() const -> VectorXdConstRef;
+
+    /// Return the amounts of the conservative components *c* at the reference chemical equilibrium state.
+    auto referenceComponentAmounts() const -> VectorXdConstRef;
+
+    /// Return the serialized chemical properties of the system at the reference chemical equilibrium state.
+    auto referenceProperties() const -> VectorXdConstRef;
+
+    /// Return the indices of the primary species at the reference chemical equilibrium state.
+    auto referencePrimarySpecies() const -> ArrayXlConstRef;
+
+    /// Set the sensitivity derivatives of the chemical equilibrium state at the reference point.
+    /// @param[out] sensitivity The sensitivity object initialized with the specifications of the reference equilibrium problem.
+    auto referenceSensitivity(EquilibriumSensitivity& sensitivity) const -> void;
+
+    /// Return an estimate of the memory used by this predictor (in bytes), excluding the equilibrium data it shares with other predictors.
+    auto memoryUsage() const -> Index;
+
 private:
     struct Impl;
 
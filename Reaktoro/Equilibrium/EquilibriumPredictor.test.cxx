@@ -147,6 +147,20 @@ TEST_CASE("Testing EquilibriumPredictor", "[EquilibriumPredictor]")
         CHECK( p.isApprox(VectorXd(state.equilibrium().p())) );
         CHECK( q.isApprox(VectorXd(state.equilibrium().q())) );
         CHECK( u.isApprox(VectorXd(state.props())) );
+        CHECK( w.isApprox(VectorXd(state.equilibrium().w())) );
+        CHECK( c.isApprox(VectorXd(state.equilibrium().c())) );
+        CHECK( (state.equilibrium().indicesPrimarySpecies() == state0.equilibrium().indicesPrimarySpecies()).all() );
+
+        // Check the reference data kept in the predictor
+        CHECK( predictor.referenceInputVariables() == w0 );
+        CHECK( predictor.referenceComponentAmounts() == c0 );
+
+        EquilibriumSensitivity sensitivity(specs);
+        predictor.referenceSensitivity(sensitivity);
+
+        CHECK( sensitivity.dndw() == dndw0 );
+        CHECK( sensitivity.dqdc() == dqdc0 );
+        CHECK( sensitivity.dudw() == dudw0 );
 
         // Check EquilibriumPredictor::speciesChemicalPotentialPredicted and EquilibriumPredictor::speciesChemicalPotentialReference
         ChemicalProps props0 = state0.props();
@@ -18,9 +18,11 @@
 #include "EquilibriumSetup.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -83,6 +85,10 @@ struct EquilibriumSetup::Impl
     ArrayXr mu;                               ///< The auxiliary vector of chemical potentials of the species.
     VectorXl isbasicvar;                      ///< The bitmap that indicates which variables in x = (n, q) are currently basic variables.
     Indices ipps;                             ///< The indices of the pure phase species (i.e., species composing single-phase species, whose chemical potentials do not depend on composition)
+    Indices iphase;                           ///< The index of the phase containing each species.
+    Indices phaseoffsets;                     ///< The index of the first species in each phase (followed by the number of species).
+    Vec<Indices> colors;                      ///< The groups of species seeded together when using compressed seeding (no two species in a group belong to the same phase).
+    bool assembling_props_jacobian = false;   ///< The flag indicating if the Jacobian of the chemical properties is being assembled (compressed seeding is not used in this case).
 
     // -------------------------------------------- //
     // ------ CONVENIENT AUXILIARY VARIABLES ------ //
@@ -137,15 +143,18 @@ struct EquilibriumSetup::Impl
 
         isbasicvar.resize(Nx);
 
-        // Initialize the indices of the pure phase species
+        // Initialize the indices of the pure phase species and the phase of each species
         auto offset = 0;
-        for(auto const& phase : system.phases())
+        for(auto const& [k, phase] : enumerate(system.phases()))
         {
             const auto size = phase.species().size();
             if(size == 1)
                 ipps.push_back(offset);
+            phaseoffsets.push_back(offset);
+            iphase.insert(iphase.end(), size, k);
             offset += size;
         }
+        phaseoffsets.push_back(offset);
     }
 
     auto assembleLowerBoundsVector(EquilibriumRestrictions const& restrictions, ChemicalState const& state0) const -> VectorXd
@@ -188,6 +197,8 @@ struct EquilibriumSetup::Impl
 
     auto updateGradX(VectorXlConstRef ibasicvars) -> void
     {
+        RKT_TRACE_COUNT("GibbsHessian::evaluations", 1);
+
         isbasicvar.fill(false);
         isbasicvar(ibasicvars).fill(true);
 
@@ -219,7 +230,14 @@ struct EquilibriumSetup::Impl
                 add_log_barrier_contrib(Hnn);
 
                 // Update columns of Hxx and Vpx corresponding to primary species
-                for(auto i : ibasicvars)
+                if(usingCompressedSeeding())
+                {
+                    Indices ispecies;
+                    for(auto i : ibasicvars)
+                        if(i < Nn) ispecies.push_back(i); // skip `q` variables (implicit titrants that are currently primary species)
+                    updateGradNCompressed(ispecies);
+                }
+                else for(auto i : ibasicvars)
                 {
                     if(i >= Nn) continue; // i corresponds to a `q` variable, and the implicit titrant is currently a primary species
                     updateFx(i);
@@ -229,7 +247,9 @@ struct EquilibriumSetup::Impl
             else // case GibbsHessian::Exact
             {
                 // Update Hxx and Vpx columns for all species
-                for(auto i = 0; i < Nn; ++i)
+                if(usingCompressedSeeding())
+                    updateGradNCompressed(range(Nn));
+                else for(auto i = 0; i < Nn; ++i)
                 {
                     updateFx(i);
                     Hxx.col(i) = grad(F.head(Nx));
@@ -256,6 +276,53 @@ struct EquilibriumSetup::Impl
         Vpx.rightCols(Nq).fill(0.0);  // these are derivatives w.r.t. amounts of implicit titrants q
     }
 
+    /// Return true if the exact columns of Hxx can be computed with compressed seeding.
+    auto usingCompressedSeeding() const -> bool
+    {
+        return options.use_compressed_hessian_seeding && Np == 0 && !assembling_props_jacobian;
+    }
+
+    /// Update the columns of Hnn for given species, seeding together species in different phases.
+    auto updateGradNCompressed(Indices const& ispecies) -> void
+    {
+        // Distribute the species into groups so that the k-th group contains the k-th given species of each phase
+        for(auto& color : colors)
+            color.clear();
+        Indices counts(phaseoffsets.size() - 1, 0);
+        for(auto i : ispecies)
+        {
+            const auto k = counts[iphase[i]]++;
+            if(k >= colors.size())
+                colors.resize(k + 1);
+            colors[k].push_back(i);
+        }
+
+        // Evaluate the chemical properties once per group. Since the chemical
+        // potentials of the species in a phase depend only on the amounts of
+        // the species in that phase, the derivatives with respect to each
+        // seeded species are found in the rows of its phase.
+        for(auto const& color : colors)
+        {
+            if(color.empty())
+                continue;
+
+            const auto useIdealModel = useIdealModelForGradWrtVariableN(color.front()); // the same for all species in the group, since these are all basic variables (or all species) here
+            for(auto i : color) autodiff::seed(n[i]);
+            props.update(n, p, w, useIdealModel);
+            updateF();
+            for(auto i : color) autodiff::unseed(n[i]);
+
+            for(auto i : color)
+            {
+                const auto k = iphase[i];
+                const auto offset = phaseoffsets[k];
+                const auto size = phaseoffsets[k + 1] - offset;
+                Hxx.col(i).fill(0.0);
+                Hxx.col(i).segment(offset, size) = grad(F.segment(offset, size));
+            }
+        }
+    }
+
     auto updateGradP() -> void
     {
         // Update Hxp and Vpp
@@ -606,11 +673,13 @@ auto EquilibriumSetup::usingDiagonalApproxDerivatives() -> bool
 auto EquilibriumSetup::assembleChemicalPropsJacobianBegin() -> void
 {
     pimpl->props.assembleFullJacobianBegin();
+    pimpl->assembling_props_jacobian = true;
 }
 
 auto EquilibriumSetup::assembleChemicalPropsJacobianEnd() -> void
 {
     pimpl->props.assembleFullJacobianEnd();
+    pimpl->assembling_props_jacobian = false;
 }
 
 auto EquilibriumSetup::equilibriumProps() const -> EquilibriumProps const&
@@ -327,6 +327,26 @@ TEST_CASE("Testing EquilibriumSetup", "[EquilibriumSetup]")
 
             CHECK( setup.getConstraintResidualsGradX().size() == 0 );
             CHECK( setup.getConstraintResidualsGradP().size() == 0 );
+
+            // Check Hxx is the same when species in different phases are seeded together
+            for(auto mode : { GibbsHessian::Exact, GibbsHessian::PartiallyExact })
+            {
+                options.hessian = mode;
+
+                options.use_compressed_hessian_seeding = false;
+                setup.setOptions(options);
+                setup.update(x, p, w);
+                setup.updateGradX(ibasicvars);
+
+                const MatrixXd Hxx = setup.getGibbsHessianX();
+
+                options.use_compressed_hessian_seeding = true;
+                setup.setOptions(options);
+                setup.update(x, p, w);
+                setup.updateGradX(ibasicvars);
+
+                CHECK( Hxx.isApprox(setup.getGibbsHessianX()) );
+            }
         }
 
         WHEN("temperature and pressure are not input variables")
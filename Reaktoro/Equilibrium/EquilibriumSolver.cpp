@@ -29,11 +29,13 @@
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumHotStart.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProps.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
@@ -83,6 +85,20 @@ struct EquilibriumSolver::Impl
     /// The optimization problem to be configured for a chemical equilibrium calculation.
     Optima::Problem optproblem;
 
+    /// The flag indicating whether the optimization problem has been constructed.
+    /// Copies of this flag are always false, so that a copy of this object constructs its
+    /// own optimization problem, with functions bound to the copy instead of the original object.
+    struct Initialized
+    {
+        bool value = false;
+        Initialized() {}
+        Initialized(Initialized const&) {}
+        auto operator=(Initialized const&) -> Initialized& { value = false; return *this; }
+    } optproblem_initialized;
+
+    /// The input variables of the current equilibrium calculation (used by the functions of the optimization problem).
+    VectorXr w;
+
     /// The optimization state of the calculation.
     Optima::State optstate;
 
@@ -152,12 +168,9 @@ struct EquilibriumSolver::Impl
         optsolver.setOptions(options.optima);
     }
 
-    /// Update the optimization problem before a new equilibrium calculation.
-    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    /// Construct the optimization problem, whose functions and constant data do not change among equilibrium calculations.
+    auto initOptProblem()
     {
-        // The input variables for the equilibrium calculation
-        const VectorXr w = conditions.inputValuesGetOrCompute(state0);
-
         // Create the Optima::Dims object with dimension info of the optimization problem
         optdims = Optima::Dims();
         optdims.x  = dims.Nx;
@@ -165,11 +178,11 @@ struct EquilibriumSolver::Impl
         optdims.be = dims.Nc;
         optdims.c  = dims.Nw + dims.Nc; // c' = (w, c) where w are the input variables and c are the amounts of components
 
-        // Recreate a new Optima::Problem problem (TODO: Avoid recreation of Optima::Problem object for each equilibrium calculation)
+        // Create the Optima::Problem object only once, with its functions bound to this object
         optproblem = Optima::Problem(optdims);
 
         // Set the resources function in the Optima::Problem object
-        optproblem.r = [=](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts) mutable
+        optproblem.r = [this](VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions fopts, Optima::ConstraintOptions hopts, Optima::ConstraintOptions vopts)
         {
             setup.update(x, p, w);
 
@@ -188,7 +201,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the objective function in the Optima::Problem object
-        optproblem.f = [=](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts) mutable
+        optproblem.f = [this](Optima::ObjectiveResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ObjectiveOptions opts)
         {
             res.f = setup.getGibbsEnergy();
             res.fx = setup.getGibbsGradX();
@@ -209,7 +222,7 @@ struct EquilibriumSolver::Impl
         };
 
         // Set the external constraint function in the Optima::Problem object
-        optproblem.v = [=](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts) mutable
+        optproblem.v = [this](Optima::ConstraintResultRef res, VectorXdConstRef x, VectorXdConstRef p, VectorXdConstRef c, Optima::ConstraintOptions opts)
         {
             res.val = setup.getConstraintResiduals();
 
@@ -229,6 +242,24 @@ struct EquilibriumSolver::Impl
         optproblem.Aex = setup.Aex();
         optproblem.Aep = setup.Aep();
 
+        // Set the Jacobian matrix d(be)/dc = [d(be)/dw d(be)/db]
+        // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
+        optproblem.bec.setZero();
+        optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
+
+        optproblem_initialized.value = true;
+    }
+
+    /// Update the optimization problem before a new equilibrium calculation.
+    auto updateOptProblem(ChemicalState const& state0, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions)
+    {
+        // Construct the optimization problem in the first equilibrium calculation (only bounds, conditions and input variables change afterwards)
+        if(!optproblem_initialized.value)
+            initOptProblem();
+
+        // The input variables for the equilibrium calculation
+        w = conditions.inputValuesGetOrCompute(state0);
+
         /// Set the right-hand side vector be of the linear equality constraints.
         optproblem.be = conditions.initialComponentAmountsGetOrCompute(state0);
 
@@ -242,21 +273,36 @@ struct EquilibriumSolver::Impl
 
         // Set the values of the input variables for sensitivity derivatives
         optproblem.c = zeros(optdims.c);
+    }
 
-        // Set the Jacobian matrix d(be)/dc = [d(be)/dw d(be)/db]
-        // The left Nw x Nb block is zero. The right Nb x Nb block is identity!
-        optproblem.bec.setZero();
-        optproblem.bec.rightCols(dims.Nc).diagonal().setOnes();
+    /// Return true if given Optima::State object is compatible with the optimization problem of this equilibrium solver.
+    auto isCompatible(Optima::State const& state) const -> bool
+    {
+        return state.dims.x == dims.Nx && state.dims.p == dims.Np && state.dims.be == dims.Nc && state.dims.c == dims.Nw + dims.Nc;
     }
 
     /// Update the initial state variables before the new equilibrium calculation.
-    auto updateOptState(ChemicalState const& state0)
+    auto updateOptState(ChemicalState const& state0) -> void
     {
-        // Initialize optstate with that stored in state0 (note state0 may have empty Optima::State object!)
-        optstate = state0.equilibrium().optimaState();
+        updateOptState(state0, state0.equilibrium().optimaState());
+    }
+
+    /// Update the initial state variables before the new equilibrium calculation using a hot-start state if not empty.
+    auto updateOptState(ChemicalState const& state0, EquilibriumHotStart const& hotstart) -> void
+    {
+        if(!hotstart.empty() && isCompatible(hotstart.optimaState()))
+            updateOptState(state0, hotstart.optimaState());
+        else updateOptState(state0);
+    }
+
+    /// Update the initial state variables before the new equilibrium calculation starting from a given Optima::State object.
+    auto updateOptState(ChemicalState const& state0, Optima::State const& optstate0) -> void
+    {
+        // Initialize optstate with given one (note this may be an empty Optima::State object!)
+        optstate = optstate0;
 
         // In case optstate corresponds to an equilibrium problem of different structure, initialize it with a clean slate
-        if(optstate.dims.x != dims.Nx || optstate.dims.p != dims.Np || optstate.dims.be != dims.Nc || optstate.dims.c != dims.Nw + dims.Nc)  // TODO: Replace this by a code that represents the EquilibriumSpecs object used for the previous calculation. Consider a dictionary of saved optstates and corresponding EquilibriumSpecs objects in case the same ChemicalState object is used within different solvers.
+        if(!isCompatible(optstate))  // TODO: Replace this by a code that represents the EquilibriumSpecs object used for the previous calculation. Consider a dictionary of saved optstates and corresponding EquilibriumSpecs objects in case the same ChemicalState object is used within different solvers.
             optstate = Optima::State(optdims);
 
         // Overwrite n in x = (n, q) with species amounts from the chemical state
@@ -365,6 +411,44 @@ struct EquilibriumSolver::Impl
         updateOptProblem(state, conditions, restrictions);
         updateOptState(state);
 
+        return solveOptProblem(state, conditions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart) -> EquilibriumResult
+    {
+        return solve(state, hotstart, xconditions, xrestrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    {
+        return solve(state, hotstart, xconditions, restrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumConditions const& conditions) -> EquilibriumResult
+    {
+        return solve(state, hotstart, conditions, xrestrictions);
+    }
+
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+    {
+        updateOptProblem(state, conditions, restrictions);
+        updateOptState(state, hotstart);
+
+        solveOptProblem(state, conditions);
+
+        // Keep the computed optimization state for the next calculation, unless it failed and cannot be trusted as a starting point
+        if(result.optima.succeeded)
+            hotstart.setOptimaState(optstate);
+        else hotstart.reset();
+
+        return result;
+    }
+
+    /// Solve the configured optimization problem starting from the current optimization state.
+    auto solveOptProblem(ChemicalState& state, EquilibriumConditions const& conditions) -> EquilibriumResult
+    {
+        RKT_TRACE_SCOPE("EquilibriumSolver::solve");
+
         const auto optstatebkp = optstate;
 
         result.optima = optsolver.solve(optproblem, optstate);
@@ -382,6 +466,8 @@ struct EquilibriumSolver::Impl
 
         warningif(!result.optima.succeeded && Warnings::isEnabled(906), EQUILIBRIUM_FAILURE_MESSAGE);
 
+        RKT_TRACE_COUNT("Optima::iterations", result.iterations());
+
         updateChemicalState(state, conditions);
 
         return result;
@@ -404,6 +490,8 @@ struct EquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
     {
+        RKT_TRACE_SCOPE("EquilibriumSolver::solve");
+
         EquilibriumResult result;
 
         updateOptProblem(state, conditions, restrictions);
@@ -411,6 +499,8 @@ struct EquilibriumSolver::Impl
 
         result.optima = optsolver.solve(optproblem, optstate, optsensitivity);
 
+        RKT_TRACE_COUNT("Optima::iterations", result.iterations());
+
         updateChemicalState(state, conditions);
         updateEquilibriumSensitivity(sensitivity);
 
@@ -459,6 +549,26 @@ auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const&
     return pimpl->solve(state, conditions, restrictions);
 }
 
+auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumHotStart& hotstart) -> EquilibriumResult
+{
+    return pimpl->solve(state, hotstart);
+}
+
+auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+{
+    return pimpl->solve(state, hotstart, restrictions);
+}
+
+auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumConditions const& conditions) -> EquilibriumResult
+{
+    return pimpl->solve(state, hotstart, conditions);
+}
+
+auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult
+{
+    return pimpl->solve(state, hotstart, conditions, restrictions);
+}
+
 auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> EquilibriumResult
 {
     return pimpl->solve(state, sensitivity);
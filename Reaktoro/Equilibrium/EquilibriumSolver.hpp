@@ -28,6 +28,7 @@ class ChemicalProps;
 class ChemicalState;
 class ChemicalSystem;
 class EquilibriumConditions;
+class EquilibriumHotStart;
 class EquilibriumRestrictions;
 class EquilibriumSensitivity;
 class EquilibriumSpecs;
@@ -79,6 +80,36 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS WITH HOT START
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a chemical state hot-started from the state of a previous calculation.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param[in,out] hotstart The state of the previous calculation to start from (in) and that of this calculation (out)
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart) -> EquilibriumResult;
+
+    /// Equilibrate a chemical state hot-started from the state of a previous calculation respecting given reactivity restrictions.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param[in,out] hotstart The state of the previous calculation to start from (in) and that of this calculation (out)
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
+
+    /// Equilibrate a chemical state hot-started from the state of a previous calculation respecting given constraint conditions.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param[in,out] hotstart The state of the previous calculation to start from (in) and that of this calculation (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumConditions const& conditions) -> EquilibriumResult;
+
+    /// Equilibrate a chemical state hot-started from the state of a previous calculation respecting given constraint conditions and reactivity restrictions.
+    /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
+    /// @param[in,out] hotstart The state of the previous calculation to start from (in) and that of this calculation (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium
+    /// @param restrictions The reactivity restrictions on the amounts of selected species
+    auto solve(ChemicalState& state, EquilibriumHotStart& hotstart, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
+
     //=================================================================================================================
     //
     // CHEMICAL EQUILIBRIUM METHODS WITH SENSITIVITY CALCULATION
@@ -23,6 +23,7 @@
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumHotStart.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
@@ -42,6 +43,11 @@ void exportEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions.", py::arg("state"), py::arg("conditions"))
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("conditions"), py::arg("restrictions"))
 
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumHotStart&>(&EquilibriumSolver::solve), "Equilibrate a chemical state hot-started from the state of a previous calculation.", py::arg("state"), py::arg("hotstart"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumHotStart&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state hot-started from the state of a previous calculation respecting given reactivity restrictions.", py::arg("state"), py::arg("hotstart"), py::arg("restrictions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumHotStart&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state hot-started from the state of a previous calculation respecting given constraint conditions.", py::arg("state"), py::arg("hotstart"), py::arg("conditions"))
+        .def("solve", py::overload_cast<ChemicalState&, EquilibriumHotStart&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state hot-started from the state of a previous calculation respecting given constraint conditions and reactivity restrictions.", py::arg("state"), py::arg("hotstart"), py::arg("conditions"), py::arg("restrictions"))
+
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&>(&EquilibriumSolver::solve), "Equilibrate a chemical state and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"))
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumRestrictions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("restrictions"))
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&>(&EquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"))
@@ -28,6 +28,7 @@
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Phases.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumHotStart.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
@@ -188,6 +189,29 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
                     { 0.0000000000000000e+00, -0.0000000000000000e+00,  0.0000000000000000e+00 }})));
             }
         }
+
+        WHEN("using a copy of a solver that has already solved and has been destroyed")
+        {
+            options.epsilon = 1e-16;
+
+            Ptr<EquilibriumSolver> original(new EquilibriumSolver(system));
+            original->setOptions(options);
+
+            ChemicalState state0(state);
+
+            result = original->solve(state0);
+
+            CHECK( result.succeeded() );
+
+            EquilibriumSolver copy(*original);
+            original.reset();
+
+            result = copy.solve(state);
+
+            CHECK( result.succeeded() );
+            CHECK( result.iterations() == 14 );
+            CHECK( state.speciesAmounts().isApprox(state0.speciesAmounts()) );
+        }
     }
 
     SECTION("There is only pure water but there are other elements besides H and O with zero amounts")
@@ -295,6 +319,40 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
             CHECK( result.iterations() == 3 );
             checkChemicalEquilibriumStateHasZeroDerivativeValues(state);
         }
+
+        WHEN("using a hot-start state from a previous calculation")
+        {
+            EquilibriumHotStart hotstart;
+
+            CHECK( hotstart.empty() );
+
+            result = solver.solve(state, hotstart);
+
+            CHECK( result.succeeded() );
+            CHECK_FALSE( hotstart.empty() );
+
+            // Slightly perturb the equilibrium state and discard the optimization state it carries, as when its amounts are updated by transport
+            ChemicalState perturbed(state);
+            perturbed.setSpeciesAmount("Na+", perturbed.speciesAmount("Na+") * 1.01, "mol");
+            perturbed.setSpeciesAmount("Cl-", perturbed.speciesAmount("Cl-") * 1.01, "mol");
+            perturbed.equilibrium().reset();
+
+            ChemicalState coldstate(perturbed);
+            ChemicalState hotstate(perturbed);
+
+            EquilibriumResult coldresult = solver.solve(coldstate);
+            EquilibriumResult hotresult = solver.solve(hotstate, hotstart);
+
+            CHECK( coldresult.succeeded() );
+            CHECK( hotresult.succeeded() );
+            CHECK( hotresult.iterations() <= coldresult.iterations() );
+            CHECK( hotstate.speciesAmounts().isApprox(coldstate.speciesAmounts(), 1e-6) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(hotstate);
+
+            hotstart.reset();
+
+            CHECK( hotstart.empty() );
+        }
     }
 
     SECTION("There is an aqueous solution and a gaseous solution")
@@ -53,6 +53,32 @@ struct SmartEquilibriumOptions
 
     /// The step length used to discretize pressure in the temperature-pressure space when storing learned calculations (in Pa).
     double pressure_step = 25.0e+5;
+
+    /// The number of layers of neighboring temperature-pressure grid cells also searched during a prediction (zero means only the cell containing the state).
+    /// The neighboring cells are searched after the one containing the state, closest first, so that states near the edge of a cell
+    /// can be predicted from records learned across it (the error control applies to them as to any other record).
+    Index neighbor_cell_layers = 1;
+
+    /// The minimum number of records in a cluster for its nearest-neighbor index to be used when searching for a record during a prediction.
+    /// Clusters with fewer records are searched in the order of their usage counts, as all records would otherwise be visited anyway.
+    Index nearest_search_min_records = 64;
+
+    /// The number of records nearest to the current state that are considered in a cluster when its nearest-neighbor index is used.
+    Index nearest_search_num_records = 16;
+
+    /// The maximum number of records kept in the knowledge database (zero means no limit).
+    /// Once exceeded, the least used records are evicted (see @ref eviction_fraction).
+    Index max_records = 0;
+
+    /// The maximum memory used by the records kept in the knowledge database, in bytes (zero means no limit).
+    /// This limit is converted into a maximum number of records using the estimated memory used by a record.
+    Index max_memory = 0;
+
+    /// The fraction of the capacity of the knowledge database freed when it is exceeded, so that evictions happen in batches.
+    double eviction_fraction = 0.1;
+
+    /// The number of threads used in batch calculations with SmartEquilibriumSolver::solveBatch (zero means the number of hardware threads).
+    Index batch_threads = 0;
 };
 
 } // namespace Reaktoro
@@ -30,6 +30,13 @@ void exportSmartEquilibriumOptions(py::module& m)
         .def_readwrite("reltol_negative_amounts", &SmartEquilibriumOptions::reltol_negative_amounts, "The relative tolerance for negative species amounts when predicting with first-order Taylor approximation.")
         .def_readwrite("reltol", &SmartEquilibriumOptions::reltol, "The relative tolerance used in the acceptance test for the predicted chemical equilibrium state.")
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol, "The absolute tolerance used in the acceptance test for the predicted chemical equilibrium state.")
+        .def_readwrite("neighbor_cell_layers", &SmartEquilibriumOptions::neighbor_cell_layers, "The number of layers of neighboring temperature-pressure grid cells also searched during a prediction (zero means only the cell containing the state).")
+        .def_readwrite("nearest_search_min_records", &SmartEquilibriumOptions::nearest_search_min_records, "The minimum number of records in a cluster for its nearest-neighbor index to be used when searching for a record during a prediction.")
+        .def_readwrite("nearest_search_num_records", &SmartEquilibriumOptions::nearest_search_num_records, "The number of records nearest to the current state that are considered in a cluster when its nearest-neighbor index is used.")
+        .def_readwrite("max_records", &SmartEquilibriumOptions::max_records, "The maximum number of records kept in the knowledge database (zero means no limit).")
+        .def_readwrite("max_memory", &SmartEquilibriumOptions::max_memory, "The maximum memory used by the records kept in the knowledge database, in bytes (zero means no limit).")
+        .def_readwrite("eviction_fraction", &SmartEquilibriumOptions::eviction_fraction, "The fraction of the capacity of the knowledge database freed when it is exceeded, so that evictions happen in batches.")
+        .def_readwrite("batch_threads", &SmartEquilibriumOptions::batch_threads, "The number of threads used in batch calculations with SmartEquilibriumSolver.solveBatch (zero means the number of hardware threads).")
         ;
 }
 
@@ -17,13 +17,26 @@
 
 #include "SmartEquilibriumSolver.hpp"
 
+// C++ includes
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Exception.hpp>
-#include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumDims.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
@@ -32,9 +45,19 @@
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
 
+// Optima includes
+#include <Optima/State.hpp>
+
 namespace Reaktoro {
 namespace detail {
 
+/// The identifier at the start of a smart equilibrium knowledge database file.
+constexpr char filemagic[8] = {'R', 'K', 'T', 'S', 'M', 'E', 'Q', '\0'};
+
+/// The version of the smart equilibrium knowledge database file format.
+/// Version 2 appends to each record the key of the reactivity restrictions used to learn it (version 1 files are still loaded).
+constexpr std::uint64_t fileversion = 2;
+
 /// Compute the step-round value of a given number.
 /// This method computes the step-round value of a given number for a given step length separating the set of step-rounded values.
 /// For example, if `step = 5` and `7.5 <= num <= 12.5`, `sround(num, step) => 10`.
@@ -45,31 +68,204 @@ auto sround(double num, double step) -> long
     return round(num / step) * step;
 }
 
+/// Return the point used to locate a record with input values `w` and initial component amounts `c` in the nearest-neighbor index of its cluster.
+auto searchPoint(VectorXdConstRef w, VectorXdConstRef c) -> VectorXd
+{
+    VectorXd x(w.size() + c.size());
+    x.head(w.size()) = w;
+    x.tail(c.size()) = c;
+    return x;
+}
+
+/// Return the scaling factors of the coordinates in the nearest-neighbor index of a cluster created with a record at point `x`.
+/// Each coordinate is scaled by the inverse of its magnitude at the first record, so that distances measure relative changes
+/// in temperature, pressure, and component amounts alike (magnitudes are bounded below to avoid division by zero).
+auto searchScaling(VectorXdConstRef x) -> VectorXd
+{
+    const auto xmin = std::max(1.0e-6 * x.cwiseAbs().maxCoeff(), 1.0e-16);
+    return x.cwiseAbs().cwiseMax(xmin).cwiseInverse();
+}
+
+/// The number of mutexes shared among the temperature-pressure grid cells (cells are assigned to them by hashing).
+constexpr auto num_cell_mutexes = 64;
+
+/// Return the key identifying the reactivity restrictions used in a calculation (zero if none).
+/// Records learned with different reactivity restrictions solve different problems, and are thus never used in predictions for each other.
+auto restrictionsKey(EquilibriumRestrictions const* restrictions) -> Index
+{
+    if(restrictions == nullptr)
+        return 0;
+
+    auto const& cannotincrease = restrictions->speciesCannotIncrease();
+    auto const& cannotdecrease = restrictions->speciesCannotDecrease();
+    auto const& cannotincreaseabove = restrictions->speciesCannotIncreaseAbove();
+    auto const& cannotdecreasebelow = restrictions->speciesCannotDecreaseBelow();
+
+    if(cannotincrease.empty() && cannotdecrease.empty() && cannotincreaseabove.empty() && cannotdecreasebelow.empty())
+        return 0;
+
+    // The sets and maps of restricted species are unordered, so their entries are sorted before hashing
+    const auto sorted = [](auto const& container) { Vec<Pair<Index, double>> v(container.begin(), container.end()); std::sort(v.begin(), v.end()); return v; };
+    const auto sortedset = [](auto const& container) { Vec<Index> v(container.begin(), container.end()); std::sort(v.begin(), v.end()); return v; };
+
+    std::size_t key = 1;
+    for(auto i : sortedset(cannotincrease)) key = hashCombine(key, 1, i);
+    for(auto i : sortedset(cannotdecrease)) key = hashCombine(key, 2, i);
+    for(auto [i, val] : sorted(cannotincreaseabove)) key = hashCombine(key, 3, i, val);
+    for(auto [i, val] : sorted(cannotdecreasebelow)) key = hashCombine(key, 4, i, val);
+
+    return key ? key : 1;
+}
+
+/// Return the lower and upper bounds of the species amounts imposed by reactivity restrictions given the amounts `n0` at the start of the calculation.
+/// These bounds are the same as those imposed by EquilibriumSolver, except for the minimum amount of a species, which is not needed to check a prediction.
+auto restrictionsBounds(EquilibriumRestrictions const& restrictions, ArrayXdConstRef n0) -> Pair<ArrayXd, ArrayXd>
+{
+    ArrayXd nlower = ArrayXd::Constant(n0.size(), -inf);
+    ArrayXd nupper = ArrayXd::Constant(n0.size(), inf);
+    for(auto [i, val] : restrictions.speciesCannotDecreaseBelow()) nlower[i] = val;
+    for(auto i : restrictions.speciesCannotDecrease()) nlower[i] = n0[i];
+    for(auto [i, val] : restrictions.speciesCannotIncreaseAbove()) nupper[i] = val;
+    for(auto i : restrictions.speciesCannotIncrease()) nupper[i] = n0[i];
+    return { nlower, nupper };
+}
+
 } // namespace detail
 
 struct SmartEquilibriumSolver::Impl
 {
-    EquilibriumSolver solver;
+    /// The use of a record in a successful prediction, needed to update the priority queues of its cell.
+    struct Usage
+    {
+        Cell* cell;      ///< The temperature-pressure grid cell containing the record.
+        Index icluster;  ///< The index of the cluster where the search started.
+        Index jcluster;  ///< The index of the cluster containing the record.
+        Index irecord;   ///< The index of the record in its cluster.
+    };
+
+    /// The data owned by each thread performing smart equilibrium calculations.
+    struct Worker
+    {
+        /// The conventional equilibrium solver used in the learning operations of this thread.
+        EquilibriumSolver solver;
 
-    EquilibriumSensitivity sensitivity;
+        /// The sensitivity derivatives computed in the learning operations of this thread.
+        EquilibriumSensitivity sensitivity;
 
-    EquilibriumConditions conditions;
+        /// The conditions used when only the chemical state is given.
+        EquilibriumConditions conditions;
+
+        /// The result of the last smart equilibrium calculation of this thread.
+        SmartEquilibriumResult result;
+
+        /// The predictor of the record used in the last accepted prediction of this thread.
+        SharedPtr<const EquilibriumPredictor> predictor;
+
+        /// The record usages in successful predictions whose priority updates have been deferred.
+        Vec<Usage> usages;
+
+        /// The flag indicating that priority updates are deferred until the end of a batch calculation.
+        bool deferred = false;
+    };
+
+    /// The synchronization primitives guarding the learned data in batch calculations.
+    /// These are never copied, so copies of a smart equilibrium solver do not share them.
+    struct Sync
+    {
+        /// The mutex guarding the insertion of new cells in the temperature-pressure grid.
+        std::shared_mutex grid;
+
+        /// The mutexes guarding the clusters and records of the temperature-pressure grid cells.
+        Array<std::shared_mutex, detail::num_cell_mutexes> cells;
+
+        /// The thread pool used in batch calculations (created on first use).
+        Ptr<ThreadPool> pool;
+
+        /// The stamp of the next stored record (copied along with the records, unlike the other members).
+        std::atomic<Index> stamp = 0;
+
+        Sync() {}
+        Sync(Sync const& other) : stamp(other.stamp.load()) {}
+        auto operator=(Sync const& other) -> Sync& { stamp = other.stamp.load(); return *this; }
+    };
+
+    /// The specifications of the equilibrium problems solved by the smart equilibrium solver.
+    EquilibriumSpecs specs;
 
     SmartEquilibriumOptions options;
 
-    SmartEquilibriumResult result;
+    /// The additional acceptance test for predicted chemical states (if any).
+    AcceptanceTest acceptance;
 
     /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
     SmartEquilibriumSolver::Grid grid;
 
+    /// The data of each thread (the first one is used in calculations outside a batch).
+    Deque<Worker> workers;
+
+    /// The synchronization primitives guarding the learned data in batch calculations.
+    Sync sync;
+
+    /// The equilibrium data shared by the predictors of all records (the names of the variables and a solver state for warm starts).
+    SharedPtr<const ChemicalState::Equilibrium> sharedequilibrium;
+
     /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
     Impl(EquilibriumSpecs const& specs)
-    : solver(specs), sensitivity(specs), conditions(specs)
+    : specs(specs)
     {
+        workers.push_back({ EquilibriumSolver(specs), EquilibriumSensitivity(specs), EquilibriumConditions(specs) });
+
         // Initialize the equilibrium solver with the default options
         setOptions(options);
     }
 
+    /// Return the mutex guarding the clusters and records of the temperature-pressure grid cell (iT, iP).
+    auto cellMutex(long iT, long iP) -> std::shared_mutex&
+    {
+        const auto h = std::hash<long>()(iT) * 31 + std::hash<long>()(iP);
+        return sync.cells[h % detail::num_cell_mutexes];
+    }
+
+    /// Return the existing temperature-pressure grid cells to be searched for a state with temperature `T` and pressure `P`.
+    /// The cell containing the state comes first, followed by the neighboring cells within the layers given in the options
+    /// ordered by the distance between the state and their boundaries (measured in units of the temperature and pressure steps).
+    auto cellsToSearch(double T, double P) -> Vec<Pair<Pair<long, long>, Cell*>>
+    {
+        const auto Tstep = options.temperature_step;
+        const auto Pstep = options.pressure_step;
+        const auto layers = static_cast<long>(options.neighbor_cell_layers);
+
+        // The distance between the state and the boundary of a cell along one dimension (zero if the state is within the cell)
+        const auto distance = [](double x, long ix, double step) { return std::max(std::abs(x - ix) / step - 0.5, 0.0); };
+
+        Vec<Pair<double, Pair<Pair<long, long>, Cell*>>> found;
+
+        std::shared_lock<std::shared_mutex> gridlock(sync.grid);
+
+        for(long i = -layers; i <= layers; ++i)
+        {
+            for(long j = -layers; j <= layers; ++j)
+            {
+                const auto iT = detail::sround(T + i * Tstep, Tstep);
+                const auto iP = detail::sround(P + j * Pstep, Pstep);
+
+                auto it = grid.cells.find({iT, iP});
+                if(it == grid.cells.end())
+                    continue;
+
+                const auto dT = distance(T, iT, Tstep);
+                const auto dP = distance(P, iP, Pstep);
+                const auto d = (i == 0 && j == 0) ? -1.0 : dT*dT + dP*dP; // the cell containing the state is always searched first
+
+                found.push_back({ d, { it->first, &it->second } });
+            }
+        }
+
+        std::stable_sort(found.begin(), found.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+        return vectorize(found, RKT_LAMBDA(x, x.second));
+    }
+
     //=================================================================================================================
     //
     // CHEMICAL EQUILIBRIUM METHODS
@@ -78,6 +274,7 @@ struct SmartEquilibriumSolver::Impl
 
     auto solve(ChemicalState& state) -> SmartEquilibriumResult
     {
+        auto& conditions = workers.front().conditions;
         conditions.temperature(state.temperature());
         conditions.pressure(state.pressure());
         return solve(state, conditions);
@@ -85,13 +282,23 @@ struct SmartEquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        auto& conditions = workers.front().conditions;
+        conditions.temperature(state.temperature());
+        conditions.pressure(state.pressure());
+        return solve(state, conditions, restrictions);
     }
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
     {
-        tic(SOLVE_STEP)
+        return solve(workers.front(), state, conditions, nullptr);
+    }
+
+    /// Perform a smart equilibrium calculation using the data of a thread and the given reactivity restrictions (if any).
+    auto solve(Worker& worker, ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const* restrictions) -> SmartEquilibriumResult
+    {
+        auto& result = worker.result;
+
+        TracingScope solvestep("SmartEquilibriumSolver::solve", true);
 
         // Save a backup state in case the smart prediction fails.
         const auto statebkp = state;
@@ -100,23 +307,92 @@ struct SmartEquilibriumSolver::Impl
         result = {};
 
         // Perform a smart prediction of the chemical state
-        timeit( predict(state, conditions), result.timing.prediction= )
+        TracingScope predictionstep("SmartEquilibriumSolver::predict", true);
+        predict(worker, state, conditions, restrictions);
+        result.timing.prediction = predictionstep.stop();
 
         // Perform a learning step if the smart prediction is not satisfactory
         if (!result.prediction.accepted) {
             state = statebkp;
-            timeit(learn(state, conditions), result.timing.learning = )
+            TracingScope learningstep("SmartEquilibriumSolver::learn", true);
+            learn(worker, state, conditions, restrictions);
+            result.timing.learning = learningstep.stop();
         }
 
-        result.timing.solve = toc(SOLVE_STEP);
+        result.timing.solve = solvestep.stop();
 
         return result;
     }
 
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-        return {};
+        return solve(workers.front(), state, conditions, &restrictions);
+    }
+
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR BATCHES OF CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    auto solveBatch(Vec<ChemicalState>& states) -> Vec<SmartEquilibriumResult>
+    {
+        Vec<EquilibriumConditions> conditions(states.size(), workers.front().conditions);
+        for(auto i = 0; i < states.size(); ++i)
+        {
+            conditions[i].temperature(states[i].temperature());
+            conditions[i].pressure(states[i].pressure());
+        }
+        return solveBatch(states, conditions);
+    }
+
+    auto solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartEquilibriumResult>
+    {
+        errorif(states.size() != conditions.size(), "SmartEquilibriumSolver::solveBatch expects the same number of chemical states (", states.size(), ") and equilibrium conditions (", conditions.size(), ").");
+
+        // Create the thread pool on first use or if the requested number of threads has changed
+        const auto nthreads = options.batch_threads ? options.batch_threads : std::max<Index>(std::thread::hardware_concurrency(), 1);
+        if(!sync.pool || sync.pool->size() != nthreads)
+            sync.pool = std::make_unique<ThreadPool>(nthreads);
+
+        // Ensure there is one worker per thread (each with its own conventional equilibrium solver)
+        while(workers.size() < nthreads)
+            workers.push_back(workers.front());
+
+        for(auto& worker : workers)
+            worker.deferred = true;
+
+        // Apply the deferred priority updates, now that no other thread is using the learned data
+        auto finish = [&]()
+        {
+            for(auto& worker : workers)
+            {
+                for(auto const& usage : worker.usages)
+                    updatePriorities(usage);
+                worker.usages.clear();
+                worker.deferred = false;
+            }
+            evict();
+        };
+
+        Vec<SmartEquilibriumResult> results(states.size());
+
+        try
+        {
+            sync.pool->run(states.size(), [&](Index i, Index ithread)
+            {
+                results[i] = solve(workers[ithread], states[i], conditions[i], nullptr);
+            });
+        }
+        catch(...)
+        {
+            finish();
+            throw;
+        }
+
+        finish();
+
+        return results;
     }
 
     //=================================================================================================================
@@ -127,26 +403,45 @@ struct SmartEquilibriumSolver::Impl
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        const auto result = solve(state);
+        updateSensitivity(workers.front(), sensitivity);
+        return result;
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        const auto result = solve(state, restrictions);
+        updateSensitivity(workers.front(), sensitivity);
+        return result;
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        const auto result = solve(state, conditions);
+        updateSensitivity(workers.front(), sensitivity);
+        return result;
     }
 
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
     {
-        errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-        return {};
+        const auto result = solve(state, conditions, restrictions);
+        updateSensitivity(workers.front(), sensitivity);
+        return result;
+    }
+
+    /// Update the sensitivity derivatives of the state computed in the last smart equilibrium calculation of a thread.
+    /// These are the derivatives computed in a learning operation or, in a prediction, those of the learned state used
+    /// in the first-order Taylor approximation (which are constant in this approximation).
+    auto updateSensitivity(Worker const& worker, EquilibriumSensitivity& sensitivity) const -> void
+    {
+        auto const& result = worker.result;
+        if(result.prediction.accepted)
+        {
+            sensitivity.initialize(specs);
+            worker.predictor->referenceSensitivity(sensitivity);
+        }
+        else if(result.learning.solve.succeeded())
+            sensitivity = worker.sensitivity;
     }
 
     //=================================================================================================================
@@ -156,17 +451,22 @@ struct SmartEquilibriumSolver::Impl
     //=================================================================================================================
 
     /// Perform a learning operation in which a full chemical equilibrium calculation is performed.
-    auto learn(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    auto learn(Worker& worker, ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const* restrictions) -> void
     {
+        auto& result = worker.result;
+        auto const& sensitivity = worker.sensitivity;
+
         //---------------------------------------------------------------------
         // GIBBS ENERGY MINIMIZATION CALCULATION DURING THE LEARNING PROCESS
         //---------------------------------------------------------------------
-        tic(EQUILIBRIUM_STEP)
+        TracingScope equilibriumstep("equilibrium", true);
 
         // Perform a full chemical equilibrium solve with sensitivity derivatives calculation
-        result.learning.solve = solver.solve(state, sensitivity, conditions);
+        result.learning.solve = restrictions ?
+            worker.solver.solve(state, worker.sensitivity, conditions, *restrictions) :
+            worker.solver.solve(state, worker.sensitivity, conditions);
 
-        result.timing.learning_solve = toc(EQUILIBRIUM_STEP);
+        result.timing.learning_solve = equilibriumstep.stop();
 
         // Store a predictor only if chemical equilibrium succeded
         if (!result.learning.solve.succeeded()) {
@@ -176,21 +476,60 @@ struct SmartEquilibriumSolver::Impl
         //---------------------------------------------------------------------
         // STORAGE STEP DURING THE LEARNING PROCESS
         //---------------------------------------------------------------------
-        tic(STORAGE_STEP)
+        TracingScope storagestep("storage", true);
+
+        // Create the record with an equilibrium predictor object for the computed equilibrium state and its sensitivities
+        const auto predictor = std::make_shared<const EquilibriumPredictor>(
+            state.equilibrium(), state.speciesAmounts(), VectorXd(state.props()), sensitivity, sharedEquilibrium(state.equilibrium()));
+        const Record record{ predictor, detail::restrictionsKey(restrictions) };
 
-        // Create an equilibrium predictor object with computed equilibrium state and its sensitivities
-        EquilibriumPredictor predictor(state, sensitivity);
+        // Store the new record in the temperature-pressure grid cell and cluster it belongs to
+        store(record, state.temperature().val(), state.pressure().val());
 
+        // Evict the least used records if the knowledge database has exceeded its capacity (at the end of a batch calculation if in one)
+        if(!worker.deferred)
+            evict();
+
+        result.timing.learning_storage = storagestep.stop();
+    }
+
+    /// Return the equilibrium data shared by the predictors of all records, set from the given one if there is none yet.
+    auto sharedEquilibrium(ChemicalState::Equilibrium const& equilibrium0) -> SharedPtr<const ChemicalState::Equilibrium>
+    {
+        auto shared = std::atomic_load(&sharedequilibrium);
+        if(shared)
+            return shared;
+        auto created = std::make_shared<const ChemicalState::Equilibrium>(equilibrium0);
+        if(std::atomic_compare_exchange_strong(&sharedequilibrium, &shared, created))
+            return created;
+        return shared; // another thread has set it in the meantime
+    }
+
+    /// Store a record in the temperature-pressure grid cell and cluster it belongs to, returning the cluster and its index there.
+    auto store(Record const& record, double T, double P) -> Pair<Cluster*, Index>
+    {
         // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
+        const auto iT = detail::sround(T, options.temperature_step);
+        const auto iP = detail::sround(P, options.pressure_step);
 
         // Get a mutable reference to an existing temperature-pressure cell or create a new one
-        auto& cell = grid.cells[{iT, iP}];
+        Cell* pcell = nullptr;
+        {
+            std::unique_lock<std::shared_mutex> gridlock(sync.grid);
+            pcell = &grid.cells[{iT, iP}];
+        }
+        auto& cell = *pcell;
 
-        // Generate the hash number for indices of primary species in the state
-        const auto iprimary = state.equilibrium().indicesPrimarySpecies();
-        const auto label = hashVector(iprimary);
+        // Prevent other threads from searching the cell while the new record is stored
+        std::unique_lock<std::shared_mutex> celllock(cellMutex(iT, iP));
+
+        // Generate the hash number for indices of primary species in the state and the reactivity restrictions used to compute it
+        auto const& predictor = *record.predictor;
+        const auto iprimary = predictor.referencePrimarySpecies();
+        const auto label = hashCombine(hashVector(iprimary), record.restrictions);
+
+        // The point locating the new record in the nearest-neighbor index of its cluster
+        const auto x = detail::searchPoint(predictor.referenceInputVariables(), predictor.referenceComponentAmounts());
 
         // Find the index of the cluster within the temperature-pressure grid cell that has the same primary species
         auto icluster = indexfn(cell.clusters, RKT_LAMBDA(cluster, cluster.label == label));
@@ -199,8 +538,11 @@ struct SmartEquilibriumSolver::Impl
         if (icluster < cell.clusters.size())
         {
             auto& cluster = cell.clusters[icluster];
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
+            cluster.records.push_back(record);
+            cluster.records.back().stamp = sync.stamp++;
             cluster.priority.extend();
+            cluster.index.add(x);
+            return { &cluster, cluster.records.size() - 1 };
         }
         else
         {
@@ -208,48 +550,45 @@ struct SmartEquilibriumSolver::Impl
             Cluster cluster;
             cluster.iprimary = iprimary;
             cluster.label = label;
-            cluster.records.push_back({ state, conditions, sensitivity, predictor });
+            cluster.restrictions = record.restrictions;
+            cluster.records.push_back(record);
+            cluster.records.back().stamp = sync.stamp++;
             cluster.priority.extend();
+            cluster.index = KdTree(detail::searchScaling(x));
+            cluster.index.add(x);
 
             // Append the new cluster and initialize its connectivity and priority
             cell.clusters.push_back(cluster);
             cell.connectivity.extend();
             cell.priority.extend();
+            return { &cell.clusters.back(), 0 };
         }
-
-        result.timing.learning_storage = toc(STORAGE_STEP);
     }
 
     /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
-    auto predict(ChemicalState& state, EquilibriumConditions const& conditions) -> void
+    auto predict(Worker& worker, ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const* restrictions) -> void
     {
+        auto& result = worker.result;
+
         // Set the prediction status to false at the beginning
         result.prediction.accepted = false;
 
-        // Skip prediction operation if no learning data exists yet
-        if(grid.cells.empty())
-            return;
-
-        // Round temperature and pressure according to their respective step lengths for discretization
-        const auto iT = detail::sround(state.temperature().val(), options.temperature_step);
-        const auto iP = detail::sround(state.pressure().val(), options.pressure_step);
+        // Find the existing temperature-pressure grid cells containing the state or neighboring it
+        const auto cells = cellsToSearch(state.temperature().val(), state.pressure().val());
 
-        // Find an existing temperature-pressure grid cell within which the state temperature/pressure are located
-        auto it = grid.cells.find({iT, iP});
-
-        // Skip prediction operation if no temperature-pressure grid cell with learning data exists yet
-        if(it == grid.cells.end())
+        // Skip prediction operation if no temperature-pressure grid cell with learning data exists yet near the state
+        if(cells.empty())
             return;
 
-        // Get a mutable reference to the found temperature-pressure cell
-        auto& cell = it->second;
-
         const auto wvals = conditions.inputValuesGetOrCompute(state);
         const auto cvals = conditions.initialComponentAmountsGetOrCompute(state);
 
         const auto w = wvals.cast<double>();
         const auto c = cvals.cast<double>();
 
+        // The point locating the current state in the nearest-neighbor index of the clusters
+        const auto x = detail::searchPoint(w.matrix(), c.matrix());
+
         // Auxiliary vectors used in the lambda function below to avoid repeated memory allocation
         VectorXd dw;
         VectorXd dc;
@@ -257,17 +596,14 @@ struct SmartEquilibriumSolver::Impl
         // The function that checks if a record in the grid pass the error test.
         auto pass_error_test = [&](Record const& record) mutable -> bool
         {
-            // The primary species at the reference chemical state
-            auto const& iprimary0 = record.state.equilibrium().indicesPrimarySpecies();
-
             // The equilibrium predictor calculator at the reference state
-            auto const& predictor0 = record.predictor;
+            auto const& predictor0 = *record.predictor;
 
-            const auto w0 = record.state.equilibrium().w();
-            const auto c0 = record.state.equilibrium().c();
+            // The primary species at the reference chemical state
+            const auto iprimary0 = predictor0.referencePrimarySpecies();
 
-            dw = w - w0;
-            dc = c - c0;
+            dw = w.matrix() - predictor0.referenceInputVariables();
+            dc = c.matrix() - predictor0.referenceComponentAmounts();
 
             using std::abs;
             using std::isnan;
@@ -283,15 +619,23 @@ struct SmartEquilibriumSolver::Impl
             return true;
         };
 
-        // Generate the hash number for indices of primary species in the state
+        // The key of the reactivity restrictions, which must be the same in the records used for the prediction
+        const auto restrictionskey = detail::restrictionsKey(restrictions);
+
+        // The bounds of the species amounts imposed by the reactivity restrictions (relative to the amounts before the prediction)
+        const auto [nlower, nupper] = restrictionskey ?
+            detail::restrictionsBounds(*restrictions, state.speciesAmounts().cast<double>()) :
+            Pair<ArrayXd, ArrayXd>();
+
+        // Generate the hash number for indices of primary species in the state and the reactivity restrictions
         const auto iprimary = state.equilibrium().indicesPrimarySpecies();
-        const auto label = hashVector(iprimary);
+        const auto label = hashCombine(hashVector(iprimary), restrictionskey);
 
-        // The function that identifies the starting cluster index
-        auto index_starting_cluster = [&]() -> Index
+        // The function that identifies the starting cluster index in a cell
+        auto index_starting_cluster = [&](Cell const& cell) -> Index
         {
             // If no primary species, then return number of clusters to trigger use of total usage counts of clusters
-            if(iprimary.size() == 0)
+            if(iprimary.size() == 0 && restrictionskey == 0)
                 return cell.clusters.size();
 
             // Find the index of the cluster with the same set of primary species (search those with highest count first)
@@ -303,101 +647,136 @@ struct SmartEquilibriumSolver::Impl
             return cell.clusters.size();
         };
 
-        // The index of the starting cluster
-        const auto icluster = index_starting_cluster();
-
-        // The ordering of the clusters to look for (starting with icluster)
-        auto const& clusters_ordering = cell.connectivity.order(icluster);
-
         //---------------------------------------------------------------------
         // SEARCH STEP DURING THE PREDICTION PROCESS
         //---------------------------------------------------------------------
-        tic(SEARCH_STEP)
+        TracingScope searchstep("search", true);
 
-        // Iterate over all clusters (starting with icluster)
-        for(auto jcluster : clusters_ordering)
+        // Iterate over the cells (starting with the one containing the state)
+        for(auto const& [key, pcell] : cells)
         {
-            // Fetch records from the cluster and the order they have to be processed in
-            auto const& records = cell.clusters[jcluster].records;
-            auto const& records_ordering = cell.clusters[jcluster].priority.order();
+            auto& cell = *pcell;
+
+            // Allow other threads to search the cell concurrently, but not to store new records in it
+            std::shared_lock<std::shared_mutex> celllock(cellMutex(key.first, key.second));
 
-            // Iterate over all records in current cluster (using the order based on the priorities)
-            for(auto irecord : records_ordering)
+            // The index of the starting cluster
+            const auto icluster = index_starting_cluster(cell);
+
+            // The ordering of the clusters to look for (starting with icluster)
+            auto const& clusters_ordering = cell.connectivity.order(icluster);
+
+            // Iterate over all clusters (starting with icluster)
+            for(auto jcluster : clusters_ordering)
             {
-                auto const& record = records[irecord];
+                auto const& cluster = cell.clusters[jcluster];
+
+                // Skip clusters with records learned with different reactivity restrictions
+                if(cluster.restrictions != restrictionskey)
+                    continue;
 
-                //---------------------------------------------------------------------
-                // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
-                //---------------------------------------------------------------------
-                tic(ERROR_CONTROL_STEP)
+                // Fetch records from the cluster and the order they have to be processed in
+                auto const& records = cluster.records;
+                auto const& records_ordering = cluster.priority.order();
 
-                // Check if the current record passes the error test
-                const auto success = pass_error_test(record);
+                // In large clusters, process only the records nearest to the current state (closest first)
+                const auto use_nearest = records.size() >= options.nearest_search_min_records;
+                const auto records_nearest = use_nearest ? cluster.index.nearest(x, options.nearest_search_num_records) : Indices();
 
-                result.timing.prediction_error_control += toc(ERROR_CONTROL_STEP);
+                const auto num_records_to_process = use_nearest ? records_nearest.size() : records_ordering.size();
 
-                if(success)
+                // Iterate over the records in current cluster (using the order based on the distances or the priorities)
+                for(Index k = 0; k < num_records_to_process; ++k)
                 {
+                    const auto irecord = use_nearest ? records_nearest[k] : records_ordering[k];
+
+                    auto const& record = records[irecord];
+
                     //---------------------------------------------------------------------
-                    // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
+                    // ERROR CONTROL STEP DURING THE PREDICTION PROCESS
                     //---------------------------------------------------------------------
-                    tic(TAYLOR_STEP)
+                    TracingScope errorcontrolstep("error-control", true);
 
-                    auto const& predictor0 = record.predictor;
+                    // Check if the current record passes the error test
+                    const auto success = pass_error_test(record);
 
-                    predictor0.predict(state, conditions);
+                    result.timing.prediction_error_control += errorcontrolstep.stop();
 
-                    result.timing.prediction_taylor = toc(TAYLOR_STEP);
+                    if(success)
+                    {
+                        //---------------------------------------------------------------------
+                        // TAYLOR PREDICTION STEP DURING THE PREDICTION PROCESS
+                        //---------------------------------------------------------------------
+                        TracingScope taylorstep("taylor", true);
 
-                    // Check if all projected species amounts are positive or at least very small negative values
-                    auto const& n = state.speciesAmounts();
+                        auto const& predictor0 = *record.predictor;
 
-                    const double nmin = n.minCoeff();
-                    const double nsum = n.sum();
+                        predictor0.predict(state, conditions);
 
-                    if(nmin <= options.reltol_negative_amounts * nsum)
-                        continue; // continue searching for a another record that produces positive amounts only or tolerable negative values
+                        result.timing.prediction_taylor = taylorstep.stop();
 
-                    // Check if projected species amounts conserve mass of chemical elements and charge within tolerance limits
-                    const auto bnew = state.componentAmounts();
-                    const auto bold = c.head(bnew.size());
-                    const double bsum = bold.sum();
-                    const double bdiffmax = (bnew - bold).cwiseAbs().maxCoeff();
+                        // Check if all projected species amounts are positive or at least very small negative values
+                        auto const& n = state.speciesAmounts();
 
-                    if(bdiffmax > options.reltol_component_amount_conservation * bsum)
-                        continue; // continue searching for a another record that produces mass conservation within tolerance limits
+                        const double nmin = n.minCoeff();
+                        const double nsum = n.sum();
 
-                    result.timing.prediction_search = toc(SEARCH_STEP);
+                        if(nmin <= options.reltol_negative_amounts * nsum)
+                            continue; // continue searching for a another record that produces positive amounts only or tolerable negative values
 
-                    //---------------------------------------------------------------------
-                    // After the search is finished successfully
-                    //---------------------------------------------------------------------
+                        // Check if projected species amounts respect the reactivity restrictions within tolerance limits and enforce them exactly
+                        if(restrictionskey)
+                        {
+                            const auto tol = options.reltol_component_amount_conservation * nsum;
+                            const ArrayXd npred = n.cast<double>();
+                            if(((npred < nlower - tol) || (npred > nupper + tol)).any())
+                                continue; // continue searching for a another record that respects the reactivity restrictions
+                            state.setSpeciesAmounts(npred.max(nlower).min(nupper));
+                        }
 
-                    // Assign small positive values to all negative amounts
-                    for(auto i = 0; i < n.size(); ++i)
-                        if(n[i] < 0.0)
-                            state.setSpeciesAmount(i, options.learning.epsilon);
+                        // Check if projected species amounts conserve mass of chemical elements and charge within tolerance limits
+                        const auto bnew = state.componentAmounts();
+                        const auto bold = c.head(bnew.size());
+                        const double bsum = bold.sum();
+                        const double bdiffmax = (bnew - bold).cwiseAbs().maxCoeff();
 
-                    //---------------------------------------------------------------------
-                    // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
-                    //---------------------------------------------------------------------
-                    tic(PRIORITY_UPDATE_STEP)
+                        if(bdiffmax > options.reltol_component_amount_conservation * bsum)
+                            continue; // continue searching for a another record that produces mass conservation within tolerance limits
 
-                    // Increment priority of the current record (irecord) in the current cluster (jcluster)
-                    cell.clusters[jcluster].priority.increment(irecord);
+                        // Check if the predicted state passes the additional acceptance test (e.g., on reaction rates in smart kinetics calculations)
+                        if(acceptance && !acceptance(state, conditions))
+                            continue; // continue searching for a another record that produces an acceptable predicted state
 
-                    // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
-                    cell.connectivity.increment(icluster, jcluster);
+                        result.timing.prediction_search = searchstep.stop();
 
-                    // Increment priority of the current cluster (jcluster)
-                    cell.priority.increment(jcluster);
+                        //---------------------------------------------------------------------
+                        // After the search is finished successfully
+                        //---------------------------------------------------------------------
 
-                    // Mark the predicted state as accepted
-                    result.prediction.accepted = true;
+                        // Assign small positive values to all negative amounts
+                        for(auto i = 0; i < n.size(); ++i)
+                            if(n[i] < 0.0)
+                                state.setSpeciesAmount(i, options.learning.epsilon);
 
-                    result.timing.prediction_priority_update = toc(PRIORITY_UPDATE_STEP);
+                        //---------------------------------------------------------------------
+                        // DATABASE PRIORITY UPDATE STEP DURING THE PREDICTION PROCESS
+                        //---------------------------------------------------------------------
+                        TracingScope priorityupdatestep("priority-update", true);
 
-                    return;
+                        // Update the priorities now, or at the end of the batch calculation since other threads may be searching this cell
+                        if(worker.deferred)
+                            worker.usages.push_back({ &cell, icluster, jcluster, irecord });
+                        else updatePriorities({ &cell, icluster, jcluster, irecord });
+
+                        // Mark the predicted state as accepted
+                        result.prediction.accepted = true;
+
+                        worker.predictor = record.predictor;
+
+                        result.timing.prediction_priority_update = priorityupdatestep.stop();
+
+                        return;
+                    }
                 }
             }
         }
@@ -405,6 +784,438 @@ struct SmartEquilibriumSolver::Impl
         result.prediction.accepted = false;
     }
 
+    /// Increment the priorities of a record and its cluster after their use in a successful prediction.
+    auto updatePriorities(Usage const& usage) -> void
+    {
+        auto& cell = *usage.cell;
+
+        // Increment priority of the current record (irecord) in the current cluster (jcluster)
+        cell.clusters[usage.jcluster].priority.increment(usage.irecord);
+
+        // Increment priority of the current cluster (jcluster) with respect to starting cluster (icluster)
+        cell.connectivity.increment(usage.icluster, usage.jcluster);
+
+        // Increment priority of the current cluster (jcluster)
+        cell.priority.increment(usage.jcluster);
+    }
+
+    //=================================================================================================================
+    //
+    // KNOWLEDGE DATABASE CAPACITY METHODS
+    //
+    //=================================================================================================================
+
+    /// Return the number of records in the knowledge database.
+    auto numRecords() const -> Index
+    {
+        Index count = 0;
+        for(auto const& [key, cell] : grid.cells)
+            for(auto const& cluster : cell.clusters)
+                count += cluster.records.size();
+        return count;
+    }
+
+    /// Return an estimate of the memory used by a record (in bytes), including its entries in the nearest-neighbor index and priority queue of its cluster.
+    /// The equilibrium data shared by all predictors is not included, since it does not grow with the number of records.
+    static auto recordMemoryUsage(Record const& record) -> Index
+    {
+        auto const& predictor = *record.predictor;
+
+        // The reference counts allocated along with the shared predictor
+        const auto sharedbytes = 2 * sizeof(long);
+
+        // The scaled copy of the point of the record in the nearest-neighbor index, and its node and splitting axis in the implicit tree
+        const auto dimension = predictor.referenceInputVariables().size() + predictor.referenceComponentAmounts().size();
+        const auto pointbytes = sizeof(VectorXd) + dimension * sizeof(double) + 2 * sizeof(Index);
+
+        // The usage count and the position of the record in the priority queue
+        const auto prioritybytes = 2 * sizeof(Index);
+
+        return sizeof(Record) + predictor.memoryUsage() + sharedbytes + pointbytes + prioritybytes;
+    }
+
+    /// Return an estimate of the memory used by the records in the knowledge database (in bytes).
+    auto memoryUsage() const -> Index
+    {
+        Index bytes = 0;
+        for(auto const& [key, cell] : grid.cells)
+            for(auto const& cluster : cell.clusters)
+                for(auto const& record : cluster.records)
+                    bytes += recordMemoryUsage(record);
+        return bytes;
+    }
+
+    /// Return the maximum number of records in the knowledge database based on the limits in the options (zero means no limit).
+    auto capacity() const -> Index
+    {
+        Index capacity = options.max_records;
+
+        if(options.max_memory == 0)
+            return capacity;
+
+        // All records have the same dimensions, so the memory used by any of them is representative
+        for(auto const& [key, cell] : grid.cells)
+            for(auto const& cluster : cell.clusters)
+                if(cluster.records.size())
+                {
+                    const auto maxrecords = std::max<Index>(options.max_memory / recordMemoryUsage(cluster.records.front()), 1);
+                    return capacity ? std::min(capacity, maxrecords) : maxrecords;
+                }
+
+        return capacity;
+    }
+
+    /// Evict the least used records once the knowledge database has exceeded its capacity.
+    /// The usage counts in the priority queues of the clusters determine which records are evicted,
+    /// with ties resolved in favor of keeping the most recently learned records. The database is
+    /// shrunk below its capacity by a fraction of it, so that evictions happen in batches.
+    /// Clusters left without records are removed from their cells, and cells left without clusters from the grid.
+    auto evict() -> void
+    {
+        const auto maxrecords = capacity();
+
+        if(maxrecords == 0)
+            return;
+
+        const auto numrecords = numRecords();
+
+        if(numrecords <= maxrecords)
+            return;
+
+        const auto target = std::max<Index>(static_cast<Index>(maxrecords * (1.0 - options.eviction_fraction)), 1);
+        const auto numevicted = numrecords - target;
+
+        /// The candidate records for eviction with their usage counts.
+        struct Candidate
+        {
+            Index usage;       ///< The usage count of the record.
+            Index stamp;       ///< The stamp of the record, which orders records by the time they were stored.
+            Cluster* cluster;  ///< The cluster containing the record.
+            Index irecord;     ///< The index of the record in its cluster.
+        };
+
+        Vec<Candidate> candidates;
+        candidates.reserve(numrecords);
+
+        for(auto& [key, cell] : grid.cells)
+            for(auto& cluster : cell.clusters)
+                for(Index i = 0; i < cluster.records.size(); ++i)
+                    candidates.push_back({ cluster.priority.priorities()[i], cluster.records[i].stamp, &cluster, i });
+
+        const auto less_used = [](Candidate const& l, Candidate const& r)
+        {
+            return l.usage < r.usage || (l.usage == r.usage && l.stamp < r.stamp);
+        };
+
+        std::nth_element(candidates.begin(), candidates.begin() + numevicted, candidates.end(), less_used);
+
+        Map<Cluster*, Indices> evicted;
+        for(Index i = 0; i < numevicted; ++i)
+            evicted[candidates[i].cluster].push_back(candidates[i].irecord);
+
+        for(auto& [cluster, irecords] : evicted)
+            removeRecords(*cluster, irecords);
+
+        for(auto it = grid.cells.begin(); it != grid.cells.end();)
+        {
+            removeEmptyClusters(it->second);
+            it = it->second.clusters.empty() ? grid.cells.erase(it) : std::next(it);
+        }
+    }
+
+    /// Remove given records from a cluster, keeping the usage counts and order of the remaining ones.
+    static auto removeRecords(Cluster& cluster, Indices const& irecords) -> void
+    {
+        const auto size = cluster.records.size();
+
+        Vec<bool> removed(size, false);
+        for(auto i : irecords)
+            removed[i] = true;
+
+        Deque<Record> records;
+        for(Index i = 0; i < size; ++i)
+            if(!removed[i])
+                records.push_back(cluster.records[i]);
+
+        cluster.records = std::move(records);
+        cluster.priority.remove(irecords);
+        cluster.index.remove(irecords);
+    }
+
+    /// Remove the clusters without records from a cell, keeping the usage counts and connectivity of the remaining ones.
+    static auto removeEmptyClusters(Cell& cell) -> void
+    {
+        Indices iclusters;
+        for(Index i = 0; i < cell.clusters.size(); ++i)
+            if(cell.clusters[i].records.empty())
+                iclusters.push_back(i);
+
+        if(iclusters.empty())
+            return;
+
+        Deque<Cluster> clusters;
+        for(auto& cluster : cell.clusters)
+            if(cluster.records.size())
+                clusters.push_back(std::move(cluster));
+
+        cell.clusters = std::move(clusters);
+        cell.connectivity.remove(iclusters);
+        cell.priority.remove(iclusters);
+    }
+
+    //=================================================================================================================
+    //
+    // KNOWLEDGE DATABASE PERSISTENCE METHODS
+    //
+    //=================================================================================================================
+
+    /// Return the names identifying the species, input variables and control variables of the records, in the order stored in a file.
+    auto fileNames() const -> Vec<Strings>
+    {
+        return { vectorize(specs.system().species(), RKT_LAMBDA(x, x.name())),
+            specs.namesInputs(), specs.namesControlVariablesP(), specs.namesControlVariablesQ() };
+    }
+
+    /// Return the number of doubles in the block of a record in a file of given version.
+    auto fileRecordSize(Index Nu, std::uint64_t version = detail::fileversion) const -> Index
+    {
+        const EquilibriumDims dims(specs);
+        const auto Nn = dims.Nn;
+        const auto Nw = dims.Nw;
+        const auto Np = dims.Np;
+        const auto Nq = dims.Nq;
+        const auto Nc = dims.Nc;
+        const auto Nx = Nn + Np + Nq + Nu;
+        return 2 + Nn + Nn + Nu + Nw + Np + Nq + Nc + Nx * (Nw + Nc) + (version >= 2 ? 1 : 0);
+    }
+
+    /// Save the records in the knowledge database to a binary file.
+    auto save(String const& path) const -> void
+    {
+        std::ofstream file(path, std::ios::binary);
+        errorif(!file.is_open(), "Could not open file `", path, "` for writing the smart equilibrium knowledge database.");
+
+        const auto write = [&](auto const& value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        const auto numrecords = numRecords();
+
+        // The sensitivity derivatives of the records are set in this object before they are written
+        EquilibriumSensitivity sensitivity(specs);
+
+        // All records have the same number of serialized chemical properties
+        Index Nu = 0;
+        for(auto const& [key, cell] : grid.cells)
+            for(auto const& cluster : cell.clusters)
+                if(cluster.records.size())
+                    Nu = cluster.records.front().predictor->referenceProperties().size();
+
+        file.write(detail::filemagic, sizeof(detail::filemagic));
+        write(detail::fileversion);
+        write(static_cast<std::uint64_t>(Nu));
+        write(static_cast<std::uint64_t>(numrecords));
+
+        // The names identifying the columns of the records, so a file is never loaded for a different equilibrium problem
+        Index numchars = 0;
+        for(auto const& names : fileNames())
+        {
+            write(static_cast<std::uint64_t>(names.size()));
+            numchars += sizeof(std::uint64_t);
+            for(auto const& name : names)
+            {
+                write(static_cast<std::uint64_t>(name.size()));
+                file.write(name.data(), name.size());
+                numchars += sizeof(std::uint64_t) + name.size();
+            }
+        }
+
+        // Pad the header so that the blocks of the records are aligned to 8 bytes
+        const char padding[8] = {};
+        file.write(padding, (8 - numchars % 8) % 8);
+
+        // Write the records as blocks of doubles of fixed size
+        for(auto const& [key, cell] : grid.cells)
+        {
+            for(auto const& cluster : cell.clusters)
+            {
+                for(Index i = 0; i < cluster.records.size(); ++i)
+                {
+                    auto const& record = cluster.records[i];
+                    auto const& predictor = *record.predictor;
+                    const auto iprimary = predictor.referencePrimarySpecies();
+                    predictor.referenceSensitivity(sensitivity);
+
+                    const auto flatten = [](MatrixXdConstRef m) -> VectorXd { MatrixXd a = m; return VectorXd::Map(a.data(), a.size()); };
+
+                    // The key of the reactivity restrictions is a hash, so it is stored bitwise in a double rather than converted
+                    double restrictions;
+                    std::memcpy(&restrictions, &record.restrictions, sizeof(double));
+
+                    ArrayXd jb = ArrayXd::Constant(predictor.referenceSpeciesAmounts().size(), -1.0);
+                    jb.head(iprimary.size()) = iprimary.cast<double>();
+
+                    const ArrayStream<double> stream(
+                        static_cast<double>(cluster.priority.priorities()[i]),
+                        static_cast<double>(iprimary.size()),
+                        jb,
+                        predictor.referenceSpeciesAmounts(),
+                        predictor.referenceProperties(),
+                        predictor.referenceInputVariables(), predictor.referenceControlVariablesP(),
+                        predictor.referenceControlVariablesQ(), predictor.referenceComponentAmounts(),
+                        flatten(sensitivity.dndw()), flatten(sensitivity.dpdw()), flatten(sensitivity.dqdw()), flatten(sensitivity.dudw()),
+                        flatten(sensitivity.dndc()), flatten(sensitivity.dpdc()), flatten(sensitivity.dqdc()), flatten(sensitivity.dudc()),
+                        restrictions);
+
+                    assert(stream.data().size() == fileRecordSize(Nu));
+
+                    file.write(reinterpret_cast<const char*>(stream.data().data()), stream.data().size() * sizeof(double));
+                }
+            }
+        }
+
+        errorif(!file, "Could not write the smart equilibrium knowledge database to file `", path, "`.");
+    }
+
+    /// Load the records in a binary file into the knowledge database.
+    auto load(String const& path) -> void
+    {
+        std::ifstream file(path, std::ios::binary);
+        errorif(!file.is_open(), "Could not open smart equilibrium knowledge database file `", path, "`.");
+
+        const auto read = [&](auto& value) { file.read(reinterpret_cast<char*>(&value), sizeof(value)); };
+
+        char magic[8];
+        file.read(magic, sizeof(magic));
+        std::uint64_t version = 0;
+        read(version);
+
+        errorif(!file || std::memcmp(magic, detail::filemagic, sizeof(magic)) != 0, "File `", path, "` is not a smart equilibrium knowledge database file.");
+        errorif(version < 1 || version > detail::fileversion, "Smart equilibrium knowledge database file `", path, "` has version ", version, " but a version up to ", detail::fileversion, " is expected.");
+
+        std::uint64_t Nu = 0, numrecords = 0;
+        read(Nu);
+        read(numrecords);
+
+        // The records must store as many chemical properties as serialized for the current chemical system, since this determines the size of their blocks
+        const auto Nuexpected = VectorXd(ChemicalProps(specs.system())).size();
+        errorif(numrecords > 0 && Nu != Nuexpected, "Smart equilibrium knowledge database file `", path, "` stores ", Nu, " chemical properties per record, but ", Nuexpected, " are expected for the current chemical system.");
+
+        Index numchars = 0;
+        for(auto const& expected : fileNames())
+        {
+            std::uint64_t size = 0;
+            read(size);
+            numchars += sizeof(std::uint64_t);
+            Strings names(size);
+            for(auto& name : names)
+            {
+                std::uint64_t length = 0;
+                read(length);
+                errorif(!file, "Smart equilibrium knowledge database file `", path, "` is truncated.");
+                name.resize(length);
+                file.read(name.data(), length);
+                numchars += sizeof(std::uint64_t) + length;
+            }
+            errorif(names != expected, "Smart equilibrium knowledge database file `", path, "` was created for a different chemical system or equilibrium specifications.");
+        }
+
+        char padding[8];
+        file.read(padding, (8 - numchars % 8) % 8);
+
+        const EquilibriumDims dims(specs);
+        const auto Nn = dims.Nn;
+        const auto Nw = dims.Nw;
+        const auto Np = dims.Np;
+        const auto Nq = dims.Nq;
+        const auto Nc = dims.Nc;
+        const auto Nx = Nn + Np + Nq + Nu;
+
+        const auto wnames = specs.namesInputs();
+        const auto pnames = specs.namesControlVariablesP();
+        const auto qnames = specs.namesControlVariablesQ();
+
+        double usage, nprimary;
+        ArrayXd jb(Nn), n0(Nn), u0(Nu), w(Nw), p(Np), q(Nq), c(Nc);
+        VectorXd dndw(Nn*Nw), dpdw(Np*Nw), dqdw(Nq*Nw), dudw(Nu*Nw), dndc(Nn*Nc), dpdc(Np*Nc), dqdc(Nq*Nc), dudc(Nu*Nc);
+
+        ArrayXd block(fileRecordSize(Nu, version));
+
+        /// The records loaded into each cluster with their usage counts in the file.
+        Map<Cluster*, Vec<Pair<Index, Index>>> usages;
+
+        for(Index k = 0; k < numrecords; ++k)
+        {
+            file.read(reinterpret_cast<char*>(block.data()), block.size() * sizeof(double));
+            errorif(!file, "Smart equilibrium knowledge database file `", path, "` is truncated.");
+
+            ArrayStream<double>(block).to(usage, nprimary, jb, n0, u0, w, p, q, c, dndw, dpdw, dqdw, dudw, dndc, dpdc, dqdc, dudc);
+
+            errorif(!(nprimary >= 0 && nprimary <= Nn) || nprimary != std::floor(nprimary), "Smart equilibrium knowledge database file `", path, "` has a record with ", nprimary, " primary species, but there are only ", Nn, " species.");
+
+            for(auto j : jb.head(static_cast<Index>(nprimary)))
+                errorif(!(j >= 0 && j < Nn) || j != std::floor(j), "Smart equilibrium knowledge database file `", path, "` has a record with invalid primary species index ", j, ".");
+
+            const ArrayXl iprimary = jb.head(static_cast<Index>(nprimary)).cast<long>();
+
+            Index restrictions = 0;
+            if(version >= 2)
+                std::memcpy(&restrictions, &block[block.size() - 1], sizeof(double));
+
+            // The Optima state with the partition of the species into primary and secondary (the remaining solver state is reinitialized on a warm start)
+            Optima::State optstate;
+            optstate.x.resize(Nn + Nq);
+            optstate.x << n0.matrix(), q.matrix();
+            optstate.p = p;
+            optstate.jb = iprimary;
+            Vec<bool> isprimary(Nn, false);
+            for(auto i : iprimary)
+            {
+                errorif(isprimary[i], "Smart equilibrium knowledge database file `", path, "` has a record with repeated primary species index ", i, ".");
+                isprimary[i] = true;
+            }
+            optstate.jn.resize(Nn - iprimary.size());
+            for(Index i = 0, j = 0; i < Nn; ++i)
+                if(!isprimary[i])
+                    optstate.jn[j++] = i;
+
+            ChemicalState::Equilibrium equilibrium(specs.system());
+            equilibrium.setNamesInputVariables(wnames);
+            equilibrium.setNamesControlVariablesP(pnames);
+            equilibrium.setNamesControlVariablesQ(qnames);
+            equilibrium.setOptimaState(optstate);
+            equilibrium.setInputVariables(w);
+            equilibrium.setInitialComponentAmounts(c);
+
+            EquilibriumSensitivity sensitivity(specs);
+            sensitivity.dndw(MatrixXd::Map(dndw.data(), Nn, Nw));
+            sensitivity.dpdw(MatrixXd::Map(dpdw.data(), Np, Nw));
+            sensitivity.dqdw(MatrixXd::Map(dqdw.data(), Nq, Nw));
+            sensitivity.dudw(MatrixXd::Map(dudw.data(), Nu, Nw));
+            sensitivity.dndc(MatrixXd::Map(dndc.data(), Nn, Nc));
+            sensitivity.dpdc(MatrixXd::Map(dpdc.data(), Np, Nc));
+            sensitivity.dqdc(MatrixXd::Map(dqdc.data(), Nq, Nc));
+            sensitivity.dudc(MatrixXd::Map(dudc.data(), Nu, Nc));
+
+            const Record record{
+                std::make_shared<const EquilibriumPredictor>(equilibrium, n0, u0, sensitivity, sharedEquilibrium(equilibrium)), restrictions };
+
+            // The serialized chemical properties start with temperature and pressure, used to re-bin the record with the current step lengths
+            const auto [cluster, irecord] = store(record, u0[0], u0[1]);
+
+            usages[cluster].push_back({ irecord, static_cast<Index>(usage) });
+        }
+
+        // Restore the usage counts of the loaded records so that they keep their priority in searches and evictions
+        for(auto& [cluster, list] : usages)
+        {
+            Deque<Index> priorities = cluster->priority.priorities();
+            for(auto const& [irecord, count] : list)
+                priorities[irecord] = count;
+            cluster->priority = PriorityQueue::withInitialPriorities(priorities);
+        }
+
+        evict();
+    }
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -415,7 +1226,8 @@ struct SmartEquilibriumSolver::Impl
     auto setOptions(SmartEquilibriumOptions const& opts) -> void
     {
         options = opts;
-        solver.setOptions(opts.learning);
+        for(auto& worker : workers)
+            worker.solver.setOptions(opts.learning);
     }
 };
 
@@ -447,8 +1259,7 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state) -> SmartEquilibriumResu
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
@@ -458,32 +1269,37 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions c
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumRestrictions is currently not supported.");
-    return {};
+    return pimpl->solve(state, conditions, restrictions);
+}
+
+auto SmartEquilibriumSolver::solveBatch(Vec<ChemicalState>& states) -> Vec<SmartEquilibriumResult>
+{
+    return pimpl->solveBatch(states);
+}
+
+auto SmartEquilibriumSolver::solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartEquilibriumResult>
+{
+    return pimpl->solveBatch(states, conditions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, restrictions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions);
 }
 
 auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult
 {
-    errorif(true, "SmartEquilibriumSolver::solve methods with given EquilibriumSensitivity is currently not supported.");
-    return {};
+    return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
 auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options) -> void
@@ -491,4 +1307,29 @@ auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options)
     pimpl->setOptions(options);
 }
 
+auto SmartEquilibriumSolver::setAcceptanceTest(AcceptanceTest const& test) -> void
+{
+    pimpl->acceptance = test;
+}
+
+auto SmartEquilibriumSolver::save(String const& path) const -> void
+{
+    pimpl->save(path);
+}
+
+auto SmartEquilibriumSolver::load(String const& path) -> void
+{
+    pimpl->load(path);
+}
+
+auto SmartEquilibriumSolver::numRecords() const -> Index
+{
+    return pimpl->numRecords();
+}
+
+auto SmartEquilibriumSolver::memoryUsage() const -> Index
+{
+    return pimpl->memoryUsage();
+}
+
 } // namespace Reaktoro
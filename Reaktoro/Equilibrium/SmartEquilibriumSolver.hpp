@@ -26,6 +26,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumPredictor.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/ODML/ClusterConnectivity.hpp>
+#include <Reaktoro/ODML/KdTree.hpp>
 #include <Reaktoro/ODML/PriorityQueue.hpp>
 
 namespace Reaktoro {
@@ -84,6 +85,27 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR BATCHES OF CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// Equilibrate a batch of chemical states concurrently.
+    /// The chemical states are distributed among the threads of a thread pool
+    /// (see SmartEquilibriumOptions::batch_threads), all of which search and
+    /// extend the same learned data, so a state learned by one thread can be
+    /// used in predictions by all others within the same batch.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @return The results of the smart equilibrium calculations, one per chemical state
+    auto solveBatch(Vec<ChemicalState>& states) -> Vec<SmartEquilibriumResult>;
+
+    /// Equilibrate a batch of chemical states concurrently respecting given constraint conditions.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions to be attained at chemical equilibrium, one per chemical state
+    /// @return The results of the smart equilibrium calculations, one per chemical state
+    auto solveBatch(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions) -> Vec<SmartEquilibriumResult>;
+
     //=================================================================================================================
     //
     // CHEMICAL EQUILIBRIUM METHODS WITH SENSITIVITY CALCULATION
@@ -91,6 +113,8 @@ public:
     //=================================================================================================================
 
     /// Equilibrate a chemical state and compute sensitivity derivatives.
+    /// When the equilibrium state is predicted, the sensitivity derivatives are those of the learned
+    /// state used in the prediction, since these are constant in the first-order Taylor approximation.
     /// @param[in,out] state The initial guess for the calculation (in) and the computed equilibrium state (out)
     /// @param[out] sensitivity The sensitivity derivatives of the equilibrium state with respect to given input conditions
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity) -> SmartEquilibriumResult;
@@ -123,20 +147,48 @@ public:
     /// Set the options of the equilibrium solver.
     auto setOptions(SmartEquilibriumOptions const& options) -> void;
 
+    /// The function type for additional acceptance tests of predicted chemical states (see @ref setAcceptanceTest).
+    using AcceptanceTest = Fn<bool(ChemicalState const& state, EquilibriumConditions const& conditions)>;
+
+    /// Set an additional acceptance test for chemical states predicted with a first-order Taylor approximation.
+    /// This test is applied after the error control on the chemical potentials of the primary species and the checks on
+    /// negative species amounts and mass conservation. A predicted state that fails it is discarded, and the search
+    /// continues with the next record in the knowledge database (or a learning operation is performed if none is found).
+    /// The test may be called concurrently from several threads in batch calculations.
+    auto setAcceptanceTest(AcceptanceTest const& test) -> void;
+
+    /// Save the records in the knowledge database to a binary file.
+    /// The file stores the reference states and sensitivities of the records with their usage counts, so that
+    /// another run (e.g., another process of a parallel simulation) can start with the learned calculations.
+    /// The records are stored as blocks of doubles of fixed size (in the byte order of the machine).
+    auto save(String const& path) const -> void;
+
+    /// Load the records in a binary file created with @ref save into the knowledge database.
+    /// The file must have been created for the same chemical system and equilibrium specifications.
+    /// The records are added to those already learned and placed in the temperature-pressure grid
+    /// according to the current options, with the capacity limits of the knowledge database applied afterwards.
+    auto load(String const& path) -> void;
+
+    /// Return the number of records currently in the knowledge database.
+    auto numRecords() const -> Index;
+
+    /// Return an estimate of the memory currently used by the records in the knowledge database (in bytes).
+    auto memoryUsage() const -> Index;
+
     /// The record of the knowledge database containing input, output, and derivatives data.
+    /// The learned data (e.g., the input variables *w*, the component amounts *c*, and the primary
+    /// species at the learned chemical equilibrium state) is kept only in the equilibrium predictor.
     struct Record
     {
-        /// The fully calculated chemical equilibrium state.
-        ChemicalState state;
-
-        /// The conditions at which the chemical equilibrium state was calculated.
-        EquilibriumConditions conditions;
+        /// The predictor of chemical equilibrium states at given new conditions.
+        /// It is never modified once created, and thus shared by copies of the record.
+        SharedPtr<const EquilibriumPredictor> predictor;
 
-        /// The sensitivity derivatives at the calculated chemical equilibrium state.
-        EquilibriumSensitivity sensitivity;
+        /// The key of the reactivity restrictions used to learn this record (zero if none).
+        Index restrictions = 0;
 
-        /// The predictor of chemical equilibrium states at given new conditions.
-        EquilibriumPredictor predictor;
+        /// The position of this record in the sequence of records stored in the knowledge database, so that older records are evicted first among equally used ones.
+        Index stamp = 0;
     };
 
     /// The cluster storing learned input-output data with same classification.
@@ -145,14 +197,20 @@ public:
         /// The indices of the primary species for this cluster.
         ArrayXl iprimary;
 
-        /// The hash of the indices of the primary species for this cluster.
+        /// The hash of the indices of the primary species and the reactivity restrictions for this cluster.
         Index label = 0;
 
+        /// The key of the reactivity restrictions used to learn the records in this cluster (zero if none).
+        Index restrictions = 0;
+
         /// The records stored in this cluster with learning data.
         Deque<Record> records;
 
         /// The priority queue for the records based on their usage count.
         PriorityQueue priority;
+
+        /// The nearest-neighbor index of the records based on their input values and initial component amounts.
+        KdTree index;
     };
 
     /// The collection of clusters containing learned input-output data associated to a temperature-pressure grid cell.
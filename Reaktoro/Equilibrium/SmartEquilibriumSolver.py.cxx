@@ -48,5 +48,10 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
+        .def("setAcceptanceTest", &SmartEquilibriumSolver::setAcceptanceTest, "Set an additional acceptance test for chemical states predicted with a first-order Taylor approximation.", py::arg("test"))
+        .def("save", &SmartEquilibriumSolver::save, "Save the records in the knowledge database to a binary file.", py::arg("path"))
+        .def("load", &SmartEquilibriumSolver::load, "Load the records in a binary file created with save into the knowledge database.", py::arg("path"))
+        .def("numRecords", &SmartEquilibriumSolver::numRecords, "Return the number of records currently in the knowledge database.")
+        .def("memoryUsage", &SmartEquilibriumSolver::memoryUsage, "Return an estimate of the memory currently used by the records in the knowledge database (in bytes).")
         ;
 }
@@ -16,16 +16,21 @@
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
 // C++ includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 
 // Catch includes
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumRestrictions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
@@ -115,4 +120,412 @@ TEST_CASE("Testing SmartEquilibriumSolver", "[SmartEquilibriumSolver]")
         CHECK( result.learned() );
         CHECK( result.iterations() == 17 );
     }
+
+    WHEN("a batch of chemical states is equilibrated concurrently - calcite and water")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.batch_threads = 4;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        EquilibriumSolver exactsolver(system);
+
+        const auto numstates = 32;
+
+        Vec<ChemicalState> states(numstates, ChemicalState(system));
+
+        for(auto i = 0; i < numstates; ++i)
+        {
+            states[i].temperature(25.0 + 0.25 * (i % 8), "celsius");
+            states[i].pressure(1.0, "bar");
+            states[i].set("H2O(aq)", 1.0 + 0.01 * i, "kg");
+            states[i].set("Calcite", 1.0 + 0.01 * i, "mol");
+        }
+
+        auto exactstates = states;
+        for(auto& exactstate : exactstates)
+            exactsolver.solve(exactstate);
+
+        const auto initialstates = states;
+
+        const auto results = solver.solveBatch(states);
+
+        REQUIRE( results.size() == numstates );
+
+        auto numpredicted = 0;
+        for(auto i = 0; i < numstates; ++i)
+        {
+            auto result = results[i];
+            CHECK( result.succeeded() );
+            numpredicted += result.predicted();
+            CHECK( largestRelativeDifferenceLogScale(states[i].speciesAmounts(), exactstates[i].speciesAmounts()) < 0.01 );
+        }
+
+        // Learned states are shared among threads, so most states in the batch are predicted
+        CHECK( numpredicted > 0 );
+
+        // A second batch over the same states is fully predicted from the learned data
+        auto states2 = exactstates;
+        for(auto i = 0; i < numstates; ++i)
+            states2[i].set("Calcite", 1.0 + 0.01 * i, "mol");
+
+        for(auto result : solver.solveBatch(states2))
+            CHECK( result.predicted() );
+
+        // The number of chemical states and equilibrium conditions must match
+        Vec<EquilibriumConditions> conditions(numstates - 1, EquilibriumConditions(system));
+        CHECK_THROWS( solver.solveBatch(states, conditions) );
+
+        // Concurrent learning operations are also correct without memoization, in which the models of the system are evaluated at every call
+        Memoization::disable();
+
+        SmartEquilibriumSolver unmemoized(system);
+        unmemoized.setOptions(options);
+
+        auto states3 = initialstates;
+        for(auto result : unmemoized.solveBatch(states3))
+            CHECK( result.succeeded() );
+
+        Memoization::enable();
+
+        for(auto i = 0; i < numstates; ++i)
+            CHECK( largestRelativeDifferenceLogScale(states3[i].speciesAmounts(), exactstates[i].speciesAmounts()) < 0.01 );
+    }
+
+    WHEN("records are searched using the nearest-neighbor index of the clusters - calcite and water")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.nearest_search_min_records = 1; // always use the nearest-neighbor index
+        options.nearest_search_num_records = 1; // consider only the nearest record
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState state(system);
+
+        // Learn states with very different amounts of water and calcite
+        for(auto amount : { 1.0, 20.0, 400.0 })
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", amount, "kg");
+            state.set("Calcite", amount, "mol");
+
+            CHECK( solver.solve(state).learned() );
+        }
+
+        // Each of the states below is predicted using only its nearest learned state
+        for(auto amount : { 1.05, 21.0, 420.0 })
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", amount, "kg");
+            state.set("Calcite", amount, "mol");
+
+            auto result = solver.solve(state);
+
+            CHECK( result.predicted() );
+        }
+    }
+
+    WHEN("the knowledge database has limited capacity - calcite and water")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        SmartEquilibriumOptions options;
+        options.max_records = 2;
+        options.eviction_fraction = 0.0;
+
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState state(system);
+
+        auto solve = [&](double amount)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", amount, "kg");
+            state.set("Calcite", amount, "mol");
+            return solver.solve(state);
+        };
+
+        CHECK( solver.numRecords() == 0 );
+        CHECK( solver.memoryUsage() == 0 );
+
+        CHECK( solve(1.0).learned() );
+        CHECK( solver.numRecords() == 1 );
+
+        // Use the first record twice so that it is not evicted
+        CHECK( solve(1.05).predicted() );
+        CHECK( solve(1.05).predicted() );
+
+        CHECK( solve(20.0).learned() );
+        CHECK( solve(400.0).learned() );
+
+        // The least used record (learned with 20 kg of water) has been evicted
+        CHECK( solver.numRecords() == 2 );
+        CHECK( solve(1.05).predicted() );
+
+        const auto bytes = solver.memoryUsage();
+
+        CHECK( bytes > 0 );
+
+        // A memory limit for about one record keeps only one record
+        options.max_records = 0;
+        options.max_memory = bytes / 2;
+        solver.setOptions(options);
+
+        CHECK( solve(8000.0).learned() );
+        CHECK( solver.numRecords() == 1 );
+
+        // Among equally used records, in the same or different clusters, the least recently learned ones are evicted first
+        options.max_records = 2;
+        options.max_memory = 0;
+
+        SmartEquilibriumSolver fresh(system);
+        fresh.setOptions(options);
+
+        auto solvefresh = [&](double water, double calcite)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", water, "kg");
+            state.set("Calcite", calcite, "mol");
+            return fresh.solve(state);
+        };
+
+        CHECK( solvefresh(1.0, 1.0).learned() );
+        CHECK( solvefresh(1.0, 1.0e-6).learned() ); // calcite dissolves completely
+        CHECK( solvefresh(400.0, 400.0).learned() );
+
+        CHECK( fresh.numRecords() == 2 );
+        CHECK( solvefresh(1.0, 1.0e-6).predicted() );
+    }
+
+    WHEN("records are searched in neighboring temperature-pressure grid cells - calcite and water")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        ChemicalState state(system);
+
+        auto solve = [&](SmartEquilibriumSolver& solver, double T)
+        {
+            state = ChemicalState(system);
+            state.temperature(T, "K");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", 1.0, "kg");
+            state.set("Calcite", 1.0, "mol");
+            return solver.solve(state);
+        };
+
+        SmartEquilibriumOptions options;
+
+        // The state at 298.15 K is stored in the cell centered at 300 K and the one at 305.5 K falls in the cell centered at 310 K
+        SmartEquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        CHECK( solve(solver, 298.15).learned() );
+        CHECK( solve(solver, 305.5).predicted() );
+        CHECK( solver.numRecords() == 1 );
+
+        // Without searching the neighboring cells, the record learned across the cell edge cannot be used
+        options.neighbor_cell_layers = 0;
+
+        SmartEquilibriumSolver isolated(system);
+        isolated.setOptions(options);
+
+        CHECK( solve(isolated, 298.15).learned() );
+        CHECK( solve(isolated, 305.5).learned() );
+        CHECK( isolated.numRecords() == 2 );
+    }
+
+    WHEN("the knowledge database is saved and loaded - calcite and water")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        ChemicalState state(system);
+
+        auto solve = [&](SmartEquilibriumSolver& solver, double amount)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", amount, "kg");
+            state.set("Calcite", amount, "mol");
+            return solver.solve(state);
+        };
+
+        SmartEquilibriumSolver solver(system);
+
+        CHECK( solve(solver, 1.0).learned() );
+        CHECK( solve(solver, 400.0).learned() );
+
+        const auto path = "smart-equilibrium-database.bin";
+
+        solver.save(path);
+
+        // A new solver starts with the records learned by the first one
+        SmartEquilibriumSolver other(system);
+        other.load(path);
+
+        CHECK( other.numRecords() == 2 );
+        CHECK( solve(other, 1.05).predicted() );
+        CHECK( solve(other, 410.0).predicted() );
+
+        const ArrayXr n = state.speciesAmounts();
+
+        CHECK( solve(solver, 410.0).predicted() );
+        CHECK( state.speciesAmounts().isApprox(n) );
+
+        // The file cannot be loaded for a different chemical system
+        ChemicalSystem another(db, solution);
+        SmartEquilibriumSolver wrong(another);
+
+        CHECK_THROWS( wrong.load(path) );
+
+        // Files with corrupted dimensions or primary species indices are not loaded
+        const auto readbytes = [](String const& filename) { std::ifstream file(filename, std::ios::binary); return String(std::istreambuf_iterator<char>(file), {}); };
+        const auto writebytes = [](String const& filename, String const& bytes) { std::ofstream file(filename, std::ios::binary); file << bytes; };
+        const auto setbytes = [](String bytes, Index offset, auto value) { std::memcpy(bytes.data() + offset, &value, sizeof(value)); return bytes; };
+
+        SmartEquilibriumSolver single(system);
+        CHECK( solve(single, 1.0).learned() );
+        single.save(path);
+
+        const auto bytes1 = readbytes(path);
+        const auto bytes2 = [&]() { solver.save(path); return readbytes(path); }();
+
+        const auto blocksize = bytes2.size() - bytes1.size(); // the size of the block of a record
+        const auto recordsbegin = bytes1.size() - blocksize; // the offset of the first record, after the header
+
+        const auto corruptpath = "smart-equilibrium-database-corrupt.bin";
+
+        writebytes(corruptpath, setbytes(bytes2, 16, std::uint64_t(12345))); // the number of chemical properties per record
+        CHECK_THROWS( SmartEquilibriumSolver(system).load(corruptpath) );
+
+        writebytes(corruptpath, setbytes(bytes2, recordsbegin + 8, 1.0e6)); // the number of primary species in the first record
+        CHECK_THROWS( SmartEquilibriumSolver(system).load(corruptpath) );
+
+        writebytes(corruptpath, setbytes(bytes2, recordsbegin + 16, -1.0)); // the first primary species index in the first record
+        CHECK_THROWS( SmartEquilibriumSolver(system).load(corruptpath) );
+
+        writebytes(corruptpath, bytes2);
+        CHECK_NOTHROW( SmartEquilibriumSolver(system).load(corruptpath) );
+
+        std::remove(corruptpath);
+        std::remove(path);
+    }
+
+    WHEN("sensitivity derivatives and reactivity restrictions are given - calcite and water")
+    {
+        SupcrtDatabase db("supcrtbl");
+
+        AqueousPhase solution("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)");
+        solution.setActivityModel(ActivityModelPitzer());
+
+        MineralPhase calcite("Calcite");
+
+        ChemicalSystem system(db, solution, calcite);
+
+        ChemicalState state(system);
+
+        SmartEquilibriumSolver solver(system);
+
+        EquilibriumSensitivity sensitivity;
+
+        EquilibriumRestrictions restrictions(system);
+        restrictions.cannotReact("Calcite");
+
+        auto initialize = [&](double amount)
+        {
+            state = ChemicalState(system);
+            state.temperature(25.0, "celsius");
+            state.pressure(1.0, "bar");
+            state.set("H2O(aq)", amount, "kg");
+            state.set("Calcite", amount, "mol");
+        };
+
+        //-------------------------------------------------------------------------------------------------------------
+        // THE SENSITIVITY DERIVATIVES OF A PREDICTED STATE ARE THOSE OF THE LEARNED STATE USED IN THE PREDICTION
+        //-------------------------------------------------------------------------------------------------------------
+
+        initialize(1.0);
+
+        CHECK( solver.solve(state, sensitivity).learned() );
+
+        const MatrixXd dndw = sensitivity.dndw();
+        const MatrixXd dndc = sensitivity.dndc();
+
+        initialize(1.05);
+
+        CHECK( solver.solve(state, sensitivity).predicted() );
+        CHECK( sensitivity.dndw() == dndw );
+        CHECK( sensitivity.dndc() == dndc );
+
+        //-------------------------------------------------------------------------------------------------------------
+        // RECORDS LEARNED WITH REACTIVITY RESTRICTIONS ARE ONLY USED IN PREDICTIONS WITH THE SAME RESTRICTIONS
+        //-------------------------------------------------------------------------------------------------------------
+
+        initialize(1.0);
+
+        CHECK( solver.solve(state, restrictions).learned() );
+        CHECK( state.speciesAmount("Calcite") == Approx(1.0) );
+        CHECK( solver.numRecords() == 2 );
+
+        initialize(1.05);
+
+        CHECK( solver.solve(state, sensitivity, restrictions).predicted() );
+        CHECK( state.speciesAmount("Calcite") == Approx(1.05) );
+
+        initialize(1.1);
+
+        CHECK( solver.solve(state).predicted() );
+        CHECK( state.speciesAmount("Calcite") < 1.1 );
+        CHECK( solver.numRecords() == 2 );
+    }
 }
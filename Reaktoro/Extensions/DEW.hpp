@@ -23,8 +23,10 @@
 // DEW Water Models
 #include <Reaktoro/Extensions/DEW/WaterModelOptions.hpp>
 #include <Reaktoro/Extensions/DEW/WaterState.hpp>
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
 #include <Reaktoro/Extensions/DEW/WaterThermoModel.hpp>
 #include <Reaktoro/Extensions/DEW/WaterElectroModel.hpp>
 #include <Reaktoro/Extensions/DEW/WaterGibbsModel.hpp>
+#include <Reaktoro/Extensions/DEW/WaterInterpolationDEW.hpp>
 #include <Reaktoro/Extensions/DEW/WaterSolventFunctionDEW.hpp>
 #include <Reaktoro/Extensions/DEW/WaterBornOmegaDEW.hpp>
@@ -42,6 +42,24 @@ auto waterBornOmegaDEW(real T,
                        real Z,
                        const WaterBornOmegaOptions& opt)
     -> real
+{
+    // Trivial cases do not need the solvent function at all
+    if (Z == 0.0 || opt.isHydrogenLike || P > opt.maxPressureForVariation)
+        return wref_Jmol;
+
+    // Solvent function g(T,P,ρ)
+    const double g = compute_g(T, P, wt, opt);
+
+    return waterBornOmegaDEW(T, P, g, wref_Jmol, Z, opt);
+}
+
+auto waterBornOmegaDEW(real T,
+                       real P,
+                       real g_,
+                       real wref_Jmol,
+                       real Z,
+                       const WaterBornOmegaOptions& opt)
+    -> real
 {
     // For neutral species (Z=0), omega = wref = constant (no P,T dependence)
     if (Z == 0.0)
@@ -63,7 +81,7 @@ auto waterBornOmegaDEW(real T,
     const double reref_A = (Z * Z) / denom; // [Å]
 
     // Solvent function g(T,P,ρ)
-    const double g = compute_g(T, P, wt, opt);
+    const double g = g_;
 
     // Electrostatic radius at (P,T)
     const double re_A = reref_A + abs(Z) * g;
@@ -92,6 +110,26 @@ auto waterBornDOmegaDP_DEW(real T,
                            real Z,
                            const WaterBornOmegaOptions& opt)
     -> real
+{
+    // Trivial cases do not need the solvent function at all
+    if (Z == 0.0 || opt.isHydrogenLike || P > opt.maxPressureForVariation)
+        return 0.0;
+
+    // g and dgdP from solvent function module
+    const double g    = compute_g(T, P, wt, opt);
+    const double dgdP = compute_dgdP(T, P, wt, g, opt); // [1/Pa]
+
+    return waterBornDOmegaDP_DEW(T, P, g, dgdP, wref_Jmol, Z, opt);
+}
+
+auto waterBornDOmegaDP_DEW(real T,
+                           real P,
+                           real g_,
+                           real dgdP_,
+                           real wref_Jmol,
+                           real Z,
+                           const WaterBornOmegaOptions& opt)
+    -> real
 {
     // For neutral species (Z=0), omega = wref = constant, so dω/dP = 0
     // For hydrogen-like or high pressure, also return 0
@@ -105,9 +143,8 @@ auto waterBornDOmegaDP_DEW(real T,
 
     const double reref_A = (Z * Z) / denom;
 
-    // g and dgdP from solvent function module
-    const double g    = compute_g(T, P, wt, opt);
-    const double dgdP = compute_dgdP(T, P, wt, g, opt); // [1/Pa]
+    const double g    = g_;
+    const double dgdP = dgdP_; // [1/Pa]
 
     const double re_A = reref_A + abs(Z) * g;
     if (re_A <= 0.0)
@@ -68,4 +68,26 @@ auto waterBornDOmegaDP_DEW(real T,
                            const WaterBornOmegaOptions& opt = {})
     -> real;
 
+/// Born coefficient omega(P, T) in J/mol from a precomputed solvent function g.
+///
+/// Same logic as waterBornOmegaDEW above, but with g(T,P) supplied by the
+/// caller (e.g. from a shared WaterState) instead of being re-evaluated.
+auto waterBornOmegaDEW(real T,
+                       real P,
+                       real g,
+                       real wref,
+                       real Z,
+                       const WaterBornOmegaOptions& opt = {})
+    -> real;
+
+/// Pressure derivative dω/dP in J/mol/Pa from precomputed g and dg/dP [1/Pa].
+auto waterBornDOmegaDP_DEW(real T,
+                           real P,
+                           real g,
+                           real dgdP,
+                           real wref,
+                           real Z,
+                           const WaterBornOmegaOptions& opt = {})
+    -> real;
+
 } // namespace Reaktoro
@@ -23,6 +23,7 @@
 #include <numeric>
 #include <algorithm>
 #include <fstream>
+#include <cstdint>
 #include <cstdio>
 #include <map>
 #include <tuple>
@@ -33,7 +34,9 @@
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Extensions/DEW/DEWDatabase.hpp>
+#include <Reaktoro/Extensions/DEW/WaterInterpolationDEW.hpp>
 #include <Reaktoro/Extensions/DEW/WaterState.hpp>
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
 #include <Reaktoro/Extensions/DEW/WaterModelOptions.hpp>
 #include <Reaktoro/Models/StandardThermoModels/StandardThermoModelDEW.hpp>
 
@@ -948,3 +951,249 @@ TEST_CASE("Integration method GaussLegendre16 produces consistent results", "[de
     }
 }
 
+
+TEST_CASE("Integration method AdaptiveGaussKronrod agrees with high-resolution Simpson", "[dew][integration][adaptive]")
+{
+    WaterGibbsModelOptions simpOpts;
+    simpOpts.model = WaterGibbsModel::DewIntegral;
+    simpOpts.thermo.eosModel = WaterEosModel::ZhangDuan2005;
+    simpOpts.integrationMethod = WaterIntegrationMethod::Simpson;
+    simpOpts.integrationSteps = 5000;
+    simpOpts.densityTolerance = 0.001;
+
+    WaterGibbsModelOptions gkOpts = simpOpts;
+    gkOpts.integrationMethod = WaterIntegrationMethod::AdaptiveGaussKronrod;
+    gkOpts.integrationTolerance = 1.0e-3;
+
+    std::vector<std::tuple<double, double>> conditions = {
+        {300, 10}, {500, 20}, {700, 30}, {900, 40}
+    };
+
+    for (const auto& [T_C, P_kb] : conditions)
+    {
+        double T_K = T_C + 273.15;
+        double P_Pa = P_kb * 1.0e8;
+
+        double G_simp = waterGibbsModel(T_K, P_Pa, simpOpts);
+        double G_gk = waterGibbsModel(T_K, P_Pa, gkOpts);
+
+        INFO("T=" << T_C << "°C, P=" << P_kb << " kb");
+        INFO("Simpson: " << G_simp << " J/mol");
+        INFO("GK15:    " << G_gk << " J/mol");
+        CHECK(G_gk == Approx(G_simp).margin(1.0));
+    }
+}
+
+TEST_CASE("Incremental DewIntegral reuses the integral at the nearest lower pressure", "[dew][integration][incremental]")
+{
+    WaterGibbsModelOptions fullOpts;
+    fullOpts.model = WaterGibbsModel::DewIntegral;
+    fullOpts.thermo.eosModel = WaterEosModel::ZhangDuan2005;
+    fullOpts.integrationMethod = WaterIntegrationMethod::AdaptiveGaussKronrod;
+    fullOpts.integrationTolerance = 1.0e-3;
+    fullOpts.densityTolerance = 0.001;
+
+    WaterGibbsModelOptions incrOpts = fullOpts;
+    incrOpts.useIncrementalIntegration = true;
+
+    clearWaterGibbsIntegralCache();
+
+    const double T_K = 600.0 + 273.15;
+
+    // Sweep pressure upwards along the isotherm, as in a geotherm run
+    for (double P_kb = 2.0; P_kb <= 40.0; P_kb += 2.0)
+    {
+        const double P_Pa = P_kb * 1.0e8;
+
+        const double G_full = waterGibbsModel(T_K, P_Pa, fullOpts);
+        const double G_incr = waterGibbsModel(T_K, P_Pa, incrOpts);
+
+        INFO("P=" << P_kb << " kb");
+        CHECK(G_incr == Approx(G_full).margin(1.0));
+
+        // A repeated call is answered exactly from the cache
+        CHECK(waterGibbsModel(T_K, P_Pa, incrOpts) == G_incr);
+    }
+
+    clearWaterGibbsIntegralCache();
+}
+
+//=============================================================================
+// Shared water state cache
+//=============================================================================
+
+TEST_CASE("WaterStateCache shares one water state per (T, P) across DEW species", "[dew][cache]")
+{
+    const auto opts = makeWaterModelOptionsDEW();
+
+    const real T = 500.0 + 273.15; // 500 °C
+    const real P = 5.0e8;          // 5 kb
+
+    WaterStateCache::clear();
+
+    SECTION("Repeated calls at the same (T, P) are answered from the cache")
+    {
+        const auto ws1 = WaterStateCache::state(T, P, opts);
+        const auto ws2 = WaterStateCache::state(T, P, opts);
+
+        CHECK(WaterStateCache::misses() == 1);
+        CHECK(WaterStateCache::hits() == 1);
+        CHECK(WaterStateCache::size() == 1);
+
+        const auto ws0 = waterState(T, P, waterStateOptionsDEW(opts));
+
+        CHECK(ws1.thermo.D == ws0.thermo.D);
+        CHECK(ws1.electro.epsilon == ws0.electro.epsilon);
+        CHECK(ws1.gibbs == ws0.gibbs);
+        CHECK(ws1.g_solv == ws0.g_solv);
+        CHECK(ws1.dgdP == ws0.dgdP);
+        CHECK(ws2.gibbs == ws1.gibbs);
+    }
+
+    SECTION("Different options or derivative seeds are cached separately")
+    {
+        auto other = opts;
+        other.eosModel = WaterEosModel::ZhangDuan2009;
+
+        real Tseeded = T;
+        Tseeded[1] = 1.0;
+
+        WaterStateCache::state(T, P, opts);
+        WaterStateCache::state(T, P, other);
+        WaterStateCache::state(Tseeded, P, opts);
+
+        CHECK(WaterStateCache::misses() == 3);
+        CHECK(WaterStateCache::hits() == 0);
+    }
+
+    SECTION("All DEW species at the same (T, P) trigger a single water state evaluation")
+    {
+        StandardThermoModelParamsDEW params;
+        params.Gf = -261881.0; params.Hf = -240300.0; params.Sr = 58.409;
+        params.a1 = 7.7695e-6; params.a2 = -0.0954; params.a3 = 13.6731; params.a4 = -11920.0;
+        params.c1 = 76.065; params.c2 = -298640.0; params.wref = 138323.0; params.charge = 1.0;
+        params.Tmax = 1273.15;
+
+        auto modelNa = StandardThermoModelDEW(params);
+
+        params.charge = 0.0;
+        auto modelNeutral = StandardThermoModelDEW(params);
+
+        const auto propsNa = modelNa(T, P);
+        const auto propsNeutral = modelNeutral(T, P);
+
+        CHECK(WaterStateCache::misses() == 1);
+        CHECK(WaterStateCache::hits() == 1);
+
+        WaterStateCache::disable();
+
+        CHECK(modelNa(T, P).G0 == Approx(propsNa.G0));
+        CHECK(modelNeutral(T, P).G0 == Approx(propsNeutral.G0));
+        CHECK(WaterStateCache::size() == 0);
+
+        WaterStateCache::enable();
+    }
+
+    WaterStateCache::clear();
+}
+
+//=============================================================================
+// Interpolation tables of DEW water properties
+//=============================================================================
+
+TEST_CASE("WaterStateTableDEW reproduces the direct DEW water models", "[dew][interpolation]")
+{
+    const auto opts = makeWaterModelOptionsDEW();
+
+    WaterStateTableOptionsDEW grid;
+    grid.Tmin = 400.0 + 273.15;
+    grid.Tmax = 500.0 + 273.15;
+    grid.dT   = 10.0;
+    grid.Pmin = 1.0e9;  // 10 kb
+    grid.Pmax = 2.0e9;  // 20 kb
+    grid.dP   = 5.0e7;  // 500 bar
+
+    const WaterStateTableDEW table(opts, grid);
+
+    REQUIRE_FALSE(table.empty());
+    CHECK(table.contains(450.0 + 273.15, 1.5e9));
+    CHECK_FALSE(table.contains(600.0 + 273.15, 1.5e9));
+    CHECK_FALSE(table.contains(450.0 + 273.15, 3.0e9));
+
+    const auto wsOpts = waterStateOptionsDEW(opts);
+
+    SECTION("Interpolated properties match the direct evaluation within the cell")
+    {
+        const real T = 443.7 + 273.15;
+        const real P = 1.3721e9;
+
+        const auto ws = table.state(T, P);
+        const auto ws0 = waterState(T, P, wsOpts);
+
+        CHECK(ws.thermo.D == Approx(ws0.thermo.D).epsilon(1e-5));
+        CHECK(ws.thermo.DP == Approx(ws0.thermo.DP).epsilon(1e-3));
+        CHECK(ws.electro.epsilon == Approx(ws0.electro.epsilon).epsilon(1e-5));
+        CHECK(ws.electro.bornQ == Approx(ws0.electro.bornQ).epsilon(1e-3));
+        CHECK(ws.g_solv == Approx(ws0.g_solv).margin(1e-6));
+        CHECK(ws.gibbs == Approx(ws0.gibbs).margin(1.0));
+    }
+
+    SECTION("Interpolation derivatives follow autodiff seeds")
+    {
+        real P = 1.3721e9;
+        P[1] = 1.0;
+
+        const auto ws = table.state(443.7 + 273.15, P);
+
+        // dG/dP of water is its molar volume M/rho
+        const auto Vm = 18.01528e-3 / ws.thermo.D;
+        CHECK(ws.gibbs[1] == Approx(static_cast<double>(Vm)).epsilon(1e-3));
+    }
+
+    SECTION("Tables survive a save/load round trip and serve interpolation-enabled options")
+    {
+        const auto path = "WaterStateTableDEW.test.bin";
+        table.save(path);
+        const auto loaded = WaterStateTableDEW::load(path);
+        std::remove(path);
+
+        const real T = 471.2 + 273.15;
+        const real P = 1.8123e9;
+
+        CHECK(loaded.state(T, P).thermo.D == table.state(T, P).thermo.D);
+        CHECK(loaded.state(T, P).gibbs == table.state(T, P).gibbs);
+
+        registerWaterStateTableDEW(loaded);
+
+        auto interpOpts = opts;
+        interpOpts.useInterpolation = true;
+
+        CHECK(waterStateDEW(T, P, interpOpts).gibbs == table.state(T, P).gibbs);
+
+        // Outside the table the direct models are used
+        const real Tout = 700.0 + 273.15;
+        CHECK(waterStateDEW(Tout, P, interpOpts).thermo.D == waterState(Tout, P, wsOpts).thermo.D);
+
+        // Do not leak the registered table into other tests
+        clearWaterStateTablesDEW();
+    }
+
+    SECTION("Loading rejects files whose grid is inconsistent")
+    {
+        const auto path = "WaterStateTableDEW.corrupt.bin";
+        table.save(path);
+
+        // Overwrite the number of temperature points, stored after the header, model options and grid
+        const std::uint64_t nT = 1;
+        const auto offset = 8 + sizeof(std::uint32_t) + 5*sizeof(std::int32_t) + 2*sizeof(double) + 6*sizeof(double);
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(offset);
+            file.write(reinterpret_cast<const char*>(&nT), sizeof(nT));
+        }
+
+        CHECK_THROWS(WaterStateTableDEW::load(path));
+
+        std::remove(path);
+    }
+}
@@ -1,6 +1,9 @@
 #include <Reaktoro/Extensions/DEW/WaterGibbsModel.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <mutex>
 
 #include <Reaktoro/Extensions/DEW/WaterPsatPolynomialsDEW.hpp>
 #include <Reaktoro/Extensions/DEW/WaterHelmholtzPropsWagnerPruss.hpp>
@@ -122,6 +125,76 @@ struct GaussLegendre16
     };
 };
 
+// Helper: 7-point Gauss / 15-point Kronrod nodes and weights (QUADPACK qk15)
+// for interval [-1, 1]. Only the non-negative half of the symmetric rule is stored.
+struct GaussKronrod15
+{
+    // Kronrod nodes; the odd entries (1, 3, 5, 7) are also the Gauss nodes
+    static constexpr double nodes[8] = {
+        0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+        0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+        0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+        0.207784955007898467600689403773245, 0.000000000000000000000000000000000
+    };
+
+    // Kronrod weights
+    static constexpr double wkronrod[8] = {
+        0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+        0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+        0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+        0.204432940075298892414161999234649, 0.209482141084727828012999174891714
+    };
+
+    // Gauss weights for nodes[1], nodes[3], nodes[5], nodes[7]
+    static constexpr double wgauss[4] = {
+        0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+        0.381830050505118944950369775488975, 0.417959183673469387755102040816327
+    };
+};
+
+// Molar volume V_m = M / rho [m3/mol] at (T, P) from the chosen EOS (0 if unphysical).
+inline double molarVolume(double T_K,
+                          double P_Pa,
+                          const WaterThermoModelOptions& thermoWithTol,
+                          const double M)
+{
+    const auto wt = waterThermoPropsModel(T_K, P_Pa, thermoWithTol);
+    return (wt.D > 0.0) ? (M / wt.D) : 0.0;
+}
+
+//----------------------------------------------------------------------------//
+// Trapezoidal Rule (O(h²))
+//----------------------------------------------------------------------------//
+double trapezoidalRule(double T_K,
+                       double P_start_Pa,
+                       double P_end_Pa,
+                       int nsteps,
+                       const WaterThermoModelOptions& thermoWithTol,
+                       const double M)
+{
+    const double dP = (P_end_Pa - P_start_Pa) / nsteps;
+
+    auto wt_prev = waterThermoPropsModel(T_K, P_start_Pa, thermoWithTol);
+    real Vm_prev = (wt_prev.D > 0.0) ? (M / wt_prev.D) : real(0.0);
+
+    double integral = 0.0;
+
+    for (int i = 1; i <= nsteps; ++i)
+    {
+        const double Pstep_Pa = P_start_Pa + i * dP;
+        const auto wt = waterThermoPropsModel(T_K, Pstep_Pa, thermoWithTol);
+
+        if (wt.D <= 0.0)
+            continue;
+
+        const double Vm = M / wt.D;
+        integral += 0.5 * (Vm_prev + Vm) * dP;
+        Vm_prev = Vm;
+    }
+
+    return integral;
+}
+
 //----------------------------------------------------------------------------//
 // Simpson's Rule (O(h⁴))
 //----------------------------------------------------------------------------//
@@ -205,6 +278,253 @@ double gaussLegendre16(double T_K,
     return integral;
 }
 
+//----------------------------------------------------------------------------//
+// Adaptive 7/15-Point Gauss-Kronrod Quadrature
+//----------------------------------------------------------------------------//
+// Global adaptive strategy (as in QUADPACK QAG): repeatedly bisect the segment
+// with the largest error estimate |K15 - G7| until the summed error estimate
+// falls below `tolerance` [J/mol] or `maxsubdivisions` bisections were made.
+// V_m(P) is smooth along an isotherm, so a handful of segments (15 EOS
+// evaluations each) usually replaces thousands of fixed steps.
+
+struct KronrodSegment
+{
+    double a, b;     // pressure interval [Pa]
+    double integral; // 15-point Kronrod estimate [J/mol]
+    double error;    // |K15 - G7| error estimate [J/mol]
+};
+
+KronrodSegment gaussKronrod15(double T_K,
+                              double a,
+                              double b,
+                              const WaterThermoModelOptions& thermoWithTol,
+                              const double M)
+{
+    const double center = 0.5 * (a + b);
+    const double half_width = 0.5 * (b - a);
+
+    const double fc = molarVolume(T_K, center, thermoWithTol, M);
+
+    double kronrod = GaussKronrod15::wkronrod[7] * fc;
+    double gauss = GaussKronrod15::wgauss[3] * fc;
+
+    for (int i = 0; i < 7; ++i)
+    {
+        const double dx = half_width * GaussKronrod15::nodes[i];
+        const double fsum = molarVolume(T_K, center - dx, thermoWithTol, M)
+                          + molarVolume(T_K, center + dx, thermoWithTol, M);
+        kronrod += GaussKronrod15::wkronrod[i] * fsum;
+        if (i % 2 == 1)
+            gauss += GaussKronrod15::wgauss[i / 2] * fsum;
+    }
+
+    return { a, b, half_width * kronrod, std::abs(half_width * (kronrod - gauss)) };
+}
+
+double adaptiveGaussKronrod(double T_K,
+                            double P_start_Pa,
+                            double P_end_Pa,
+                            double tolerance,
+                            int maxsubdivisions,
+                            const WaterThermoModelOptions& thermoWithTol,
+                            const double M)
+{
+    std::vector<KronrodSegment> segments;
+    segments.push_back(gaussKronrod15(T_K, P_start_Pa, P_end_Pa, thermoWithTol, M));
+
+    double error = segments.front().error;
+
+    for (int k = 0; k < maxsubdivisions && error > tolerance; ++k)
+    {
+        auto worst = std::max_element(segments.begin(), segments.end(),
+            [](const KronrodSegment& l, const KronrodSegment& r) { return l.error < r.error; });
+
+        const KronrodSegment s = *worst;
+        const double mid = 0.5 * (s.a + s.b);
+
+        *worst = gaussKronrod15(T_K, s.a, mid, thermoWithTol, M);
+        segments.push_back(gaussKronrod15(T_K, mid, s.b, thermoWithTol, M));
+
+        error = 0.0;
+        for (const auto& seg : segments)
+            error += seg.error;
+    }
+
+    double integral = 0.0;
+    for (const auto& seg : segments)
+        integral += seg.integral;
+
+    return integral;
+}
+
+//----------------------------------------------------------------------------//
+// Integration of V_m dP over a pressure sub-interval
+//----------------------------------------------------------------------------//
+// Integrate over [P_a, P_b] with the method chosen in `opt`, where `fraction`
+// is the length of [P_a, P_b] relative to the full interval [1000 bar, P].
+// Fixed-step methods use fraction * integrationSteps steps, and the adaptive
+// method fraction * integrationTolerance, so the resolution per unit pressure
+// is that of a full integration from 1000 bar (identical when fraction = 1).
+double integrateMolarVolume(double T_K,
+                            double P_a_Pa,
+                            double P_b_Pa,
+                            double fraction,
+                            const WaterThermoModelOptions& thermoWithTol,
+                            const WaterGibbsModelOptions& opt,
+                            const double M)
+{
+    const auto scaledSteps = [&](int nsteps)
+    {
+        return (fraction >= 1.0) ? nsteps : std::max(1, static_cast<int>(std::ceil(nsteps * fraction)));
+    };
+
+    switch (opt.integrationMethod)
+    {
+        case WaterIntegrationMethod::Trapezoidal:
+            // Fixed step trapezoidal rule: O(h²)
+            return trapezoidalRule(T_K, P_a_Pa, P_b_Pa, scaledSteps(opt.integrationSteps), thermoWithTol, M);
+
+        case WaterIntegrationMethod::Simpson:
+            // Simpson's 1/3 rule: O(h⁴)
+            return simpsonRule(T_K, P_a_Pa, P_b_Pa, scaledSteps(opt.integrationSteps), thermoWithTol, M);
+
+        case WaterIntegrationMethod::GaussLegendre16:
+            // 16-point Gauss-Legendre quadrature: O(1/n³²)
+            // integrationSteps = number of 16-node segments
+            return gaussLegendre16(T_K, P_a_Pa, P_b_Pa, scaledSteps(std::max(1, opt.integrationSteps / 16)), thermoWithTol, M);
+
+        case WaterIntegrationMethod::AdaptiveGaussKronrod:
+            // Adaptive Gauss-Kronrod with absolute error control
+            return adaptiveGaussKronrod(T_K, P_a_Pa, P_b_Pa, opt.integrationTolerance * std::min(fraction, 1.0),
+                opt.integrationMaxSubdivisions, thermoWithTol, M);
+    }
+
+    return 0.0;
+}
+
+//----------------------------------------------------------------------------//
+// Incremental integration cache (per isotherm)
+//----------------------------------------------------------------------------//
+// Stores ∫ V_m dP from 1000 bar to P for every pressure P evaluated on an
+// isotherm, so later calls only integrate from the nearest lower cached P.
+
+struct GibbsIntegralIsotherm
+{
+    double T_K = 0.0;
+    WaterThermoModelOptions thermo;
+    WaterIntegrationMethod method = WaterIntegrationMethod::Trapezoidal;
+    int steps = 0;
+    double tolerance = 0.0;
+    int maxsubdivisions = 0;
+    std::map<double, double> integrals; // P [Pa] -> ∫ V_m dP from 1000 bar [J/mol]
+};
+
+struct GibbsIntegralCache
+{
+    /// The maximum number of isotherms kept in the cache.
+    static constexpr std::size_t maxIsotherms = 64;
+
+    /// The maximum number of cached pressures per isotherm.
+    static constexpr std::size_t maxPressures = 4096;
+
+    std::mutex mutex;
+    std::vector<GibbsIntegralIsotherm> isotherms;
+    std::size_t next = 0; // isotherm slot overwritten next once full
+};
+
+auto gibbsIntegralCache() -> GibbsIntegralCache&
+{
+    static GibbsIntegralCache cache;
+    return cache;
+}
+
+bool sameIsotherm(const GibbsIntegralIsotherm& iso,
+                  double T_K,
+                  const WaterThermoModelOptions& thermo,
+                  const WaterGibbsModelOptions& opt)
+{
+    return iso.T_K == T_K
+        && iso.thermo.eosModel == thermo.eosModel
+        && iso.thermo.usePsatPolynomials == thermo.usePsatPolynomials
+        && iso.thermo.psatRelativeTolerance == thermo.psatRelativeTolerance
+        && iso.thermo.densityTolerance == thermo.densityTolerance
+        && iso.thermo.zhangDuan2009Options.usePsat == thermo.zhangDuan2009Options.usePsat
+        && iso.thermo.zhangDuan2009Options.pressureToleranceBar == thermo.zhangDuan2009Options.pressureToleranceBar
+        && iso.thermo.zhangDuan2009Options.maxIterations == thermo.zhangDuan2009Options.maxIterations
+        && iso.method == opt.integrationMethod
+        && iso.steps == opt.integrationSteps
+        && iso.tolerance == opt.integrationTolerance
+        && iso.maxsubdivisions == opt.integrationMaxSubdivisions;
+}
+
+double incrementalIntegral(double T_K,
+                           double P_start_Pa,
+                           double P_Pa,
+                           const WaterThermoModelOptions& thermoWithTol,
+                           const WaterGibbsModelOptions& opt,
+                           const double M)
+{
+    auto& cache = gibbsIntegralCache();
+
+    // Find the nearest lower cached pressure on this isotherm (or 1000 bar)
+    double P_lower_Pa = P_start_Pa;
+    double integral_lower = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        for (const auto& iso : cache.isotherms)
+        {
+            if (!sameIsotherm(iso, T_K, thermoWithTol, opt))
+                continue;
+            auto it = iso.integrals.upper_bound(P_Pa);
+            if (it != iso.integrals.begin())
+            {
+                --it;
+                P_lower_Pa = it->first;
+                integral_lower = it->second;
+            }
+            break;
+        }
+    }
+
+    if (P_lower_Pa == P_Pa)
+        return integral_lower;
+
+    const double fraction = (P_Pa - P_lower_Pa) / (P_Pa - P_start_Pa);
+    const double integral = integral_lower
+        + integrateMolarVolume(T_K, P_lower_Pa, P_Pa, fraction, thermoWithTol, opt, M);
+
+    // Store the new integral on its isotherm (creating the isotherm if needed)
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto iso = std::find_if(cache.isotherms.begin(), cache.isotherms.end(),
+        [&](const GibbsIntegralIsotherm& x) { return sameIsotherm(x, T_K, thermoWithTol, opt); });
+    if (iso == cache.isotherms.end())
+    {
+        GibbsIntegralIsotherm newiso;
+        newiso.T_K = T_K;
+        newiso.thermo = thermoWithTol;
+        newiso.method = opt.integrationMethod;
+        newiso.steps = opt.integrationSteps;
+        newiso.tolerance = opt.integrationTolerance;
+        newiso.maxsubdivisions = opt.integrationMaxSubdivisions;
+        if (cache.isotherms.size() < GibbsIntegralCache::maxIsotherms)
+        {
+            cache.isotherms.push_back(std::move(newiso));
+            iso = cache.isotherms.end() - 1;
+        }
+        else
+        {
+            cache.next %= GibbsIntegralCache::maxIsotherms;
+            iso = cache.isotherms.begin() + cache.next++;
+            *iso = std::move(newiso);
+        }
+    }
+    if (iso->integrals.size() >= GibbsIntegralCache::maxPressures)
+        iso->integrals.clear();
+    iso->integrals[P_Pa] = integral;
+
+    return integral;
+}
+
 //----------------------------------------------------------------------------//
 // Gibbs at 1000 bar (polynomial from Excel)
 //----------------------------------------------------------------------------//
@@ -285,53 +605,17 @@ double gibbsDewIntegral_J_per_mol(double T_K,
             G_int_J += Vm * spacing_Pa;
         }
     }
+    else if (opt.useIncrementalIntegration)
+    {
+        // Incremental mode: continue from the nearest lower cached pressure
+        const double P_start_Pa = 1000.0 * 1.0e5;
+        G_int_J = incrementalIntegral(T_K, P_start_Pa, P_Pa, thermoWithTol, opt, M);
+    }
     else
     {
-        // High-precision mode: choose integration method
+        // High-precision mode: integrate from 1000 bar with the chosen method
         const double P_start_Pa = 1000.0 * 1.0e5;
-
-        switch (opt.integrationMethod)
-        {
-            case WaterIntegrationMethod::Trapezoidal:
-            {
-                // Fixed step trapezoidal rule: O(h²)
-                const int nsteps = opt.integrationSteps;
-                const double dP = (P_Pa - P_start_Pa) / nsteps;
-
-                auto wt_prev = waterThermoPropsModel(T_K, P_start_Pa, thermoWithTol);
-                real Vm_prev = (wt_prev.D > 0.0) ? (M / wt_prev.D) : real(0.0);
-
-                for (int i = 1; i <= nsteps; ++i)
-                {
-                    const double Pstep_Pa = P_start_Pa + i * dP;
-                    const auto wt = waterThermoPropsModel(T_K, Pstep_Pa, thermoWithTol);
-
-                    if (wt.D <= 0.0)
-                        continue;
-
-                    const double Vm = M / wt.D;
-                    G_int_J += 0.5 * (Vm_prev + Vm) * dP;
-                    Vm_prev = Vm;
-                }
-                break;
-            }
-
-            case WaterIntegrationMethod::Simpson:
-            {
-                // Simpson's 1/3 rule: O(h⁴)
-                G_int_J = simpsonRule(T_K, P_start_Pa, P_Pa, opt.integrationSteps, thermoWithTol, M);
-                break;
-            }
-
-            case WaterIntegrationMethod::GaussLegendre16:
-            {
-                // 16-point Gauss-Legendre quadrature: O(1/n³²)
-                // integrationSteps = number of 16-node segments
-                int nsegments = std::max(1, opt.integrationSteps / 16);
-                G_int_J = gaussLegendre16(T_K, P_start_Pa, P_Pa, nsegments, thermoWithTol, M);
-                break;
-            }
-        }
+        G_int_J = integrateMolarVolume(T_K, P_start_Pa, P_Pa, 1.0, thermoWithTol, opt, M);
     }
 
     // Total Gibbs:
@@ -401,4 +685,12 @@ auto waterGibbsModel(real T,
     return G_J_per_mol;
 }
 
+auto clearWaterGibbsIntegralCache() -> void
+{
+    auto& cache = gibbsIntegralCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.isotherms.clear();
+    cache.next = 0;
+}
+
 } // namespace Reaktoro
@@ -35,6 +35,7 @@ enum class WaterIntegrationMethod
     Trapezoidal     = 0,  ///< Trapezoidal rule: O(h²) error
     Simpson         = 1,  ///< Simpson's 1/3 rule: O(h⁴) error
     GaussLegendre16 = 2,  ///< 16-point Gauss-Legendre quadrature: O(1/n³²) error
+    AdaptiveGaussKronrod = 3,  ///< Adaptive 7/15-point Gauss-Kronrod quadrature with error control
 };
 
 /// Options to control Gibbs calculation.
@@ -62,6 +63,8 @@ struct WaterGibbsModelOptions
     ///   - Trapezoidal:     Fast, O(h²) error, good for 5000+ steps
     ///   - Simpson:         O(h⁴), ~1.5x slower than trapezoidal, better accuracy
     ///   - GaussLegendre16: Very high accuracy O(1/n³²), fewer function evals
+    ///   - AdaptiveGaussKronrod: Subdivides only where needed until
+    ///     integrationTolerance is met, typically ~100x fewer EOS evaluations
     WaterIntegrationMethod integrationMethod = WaterIntegrationMethod::Trapezoidal;
 
     /// Integration steps for DewIntegral model (when integrating V dP).
@@ -80,6 +83,24 @@ struct WaterGibbsModelOptions
     /// Default 0.001 bar gives high accuracy.
     /// Only affects Zhang & Duan EOS during Gibbs integration.
     double densityTolerance = 0.001;
+
+    /// Absolute error tolerance [J/mol] of the volume integral.
+    /// Only applies when integrationMethod = AdaptiveGaussKronrod.
+    double integrationTolerance = 1.0e-3;
+
+    /// Maximum number of interval bisections of the adaptive integrator.
+    /// Only applies when integrationMethod = AdaptiveGaussKronrod.
+    int integrationMaxSubdivisions = 200;
+
+    /// If true, reuse the volume integral cached at the nearest lower pressure
+    /// on the same isotherm and integrate only the remaining pressure interval.
+    ///
+    /// This turns a pressure sweep along an isotherm (e.g. a geotherm run)
+    /// into O(ΔP) work per call instead of restarting from 1000 bar. The
+    /// step size (fixed-step methods) or tolerance per pressure interval
+    /// (AdaptiveGaussKronrod) matches a full integration from 1000 bar.
+    /// Ignored when useExcelIntegration = true.
+    bool useIncrementalIntegration = false;
 };
 
 /// Compute the Gibbs free energy of pure water at (T, P).
@@ -93,4 +114,8 @@ auto waterGibbsModel(real T,
                      const WaterGibbsModelOptions& opt = {})
     -> real;
 
+/// Remove all volume integrals cached by the incremental DewIntegral mode.
+/// @see WaterGibbsModelOptions::useIncrementalIntegration
+auto clearWaterGibbsIntegralCache() -> void;
+
 } // namespace Reaktoro
@@ -0,0 +1,447 @@
+// WaterInterpolationDEW.cpp
+
+#include <Reaktoro/Extensions/DEW/WaterInterpolationDEW.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <mutex>
+
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Extensions/DEW/WaterGibbsModel.hpp>
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// The WaterThermoProps members tabulated (T and P are set exactly on evaluation).
+const Vec<real WaterThermoProps::*> thermofields = {
+    &WaterThermoProps::V,   &WaterThermoProps::S,   &WaterThermoProps::A,
+    &WaterThermoProps::U,   &WaterThermoProps::H,   &WaterThermoProps::G,
+    &WaterThermoProps::Cv,  &WaterThermoProps::Cp,  &WaterThermoProps::D,
+    &WaterThermoProps::DT,  &WaterThermoProps::DP,  &WaterThermoProps::DTT,
+    &WaterThermoProps::DTP, &WaterThermoProps::DPP, &WaterThermoProps::PT,
+    &WaterThermoProps::PD,  &WaterThermoProps::PTT, &WaterThermoProps::PTD,
+    &WaterThermoProps::PDD,
+};
+
+// The WaterElectroProps members tabulated.
+const Vec<real WaterElectroProps::*> electrofields = {
+    &WaterElectroProps::epsilon,   &WaterElectroProps::epsilonT,  &WaterElectroProps::epsilonP,
+    &WaterElectroProps::epsilonTT, &WaterElectroProps::epsilonTP, &WaterElectroProps::epsilonPP,
+    &WaterElectroProps::bornZ,     &WaterElectroProps::bornY,     &WaterElectroProps::bornQ,
+    &WaterElectroProps::bornN,     &WaterElectroProps::bornU,     &WaterElectroProps::bornX,
+};
+
+// The remaining WaterState members tabulated (Gibbs energy, solvent function g and dg/dP).
+const Vec<real WaterState::*> statefields = {
+    &WaterState::gibbs, &WaterState::g_solv, &WaterState::dgdP,
+};
+
+// The total number of tabulated properties.
+const Index numprops = thermofields.size() + electrofields.size() + statefields.size();
+
+// The identifier and version at the start of a binary table file.
+const char filemagic[8] = { 'R', 'K', 'T', 'D', 'E', 'W', 'W', 'T' };
+const std::uint32_t fileversion = 1;
+
+// Copy the tabulated properties of a water state into `values`.
+auto extractProps(const WaterState& ws, double* values) -> void
+{
+    Index k = 0;
+    for(auto field : thermofields) values[k++] = static_cast<double>(ws.thermo.*field);
+    for(auto field : electrofields) values[k++] = static_cast<double>(ws.electro.*field);
+    for(auto field : statefields) values[k++] = static_cast<double>(ws.*field);
+}
+
+// Return true if two water model options tabulate the same properties (the interpolation flag is irrelevant).
+auto sameModels(WaterModelOptions a, WaterModelOptions b) -> bool
+{
+    a.useInterpolation = b.useInterpolation = false;
+    return a == b;
+}
+
+// Return the number of grid points from `xmin` to `xmax` with spacing `dx`.
+auto numPoints(double xmin, double xmax, double dx) -> Index
+{
+    return static_cast<Index>(std::round((xmax - xmin) / dx)) + 1;
+}
+
+// Cubic Hermite basis functions on [0, 1] for the values (h0*) and unit-step derivatives (h1*) at t = 0 and t = 1.
+struct HermiteBasis
+{
+    real h00, h01, h10, h11;
+
+    explicit HermiteBasis(const real& t)
+    {
+        const real s = 1.0 - t;
+        h00 = (1.0 + 2.0*t) * s * s;
+        h01 = t * t * (3.0 - 2.0*t);
+        h10 = t * s * s;
+        h11 = -t * t * s;
+    }
+};
+
+} // namespace
+
+WaterStateTableDEW::WaterStateTableDEW()
+{}
+
+WaterStateTableDEW::WaterStateTableDEW(const WaterModelOptions& opts, const WaterStateTableOptionsDEW& grid)
+: m_opts(opts), m_grid(grid)
+{
+    errorif(grid.dT <= 0.0 || grid.dP <= 0.0, "Cannot build a DEW water table with non-positive grid spacing.");
+    errorif(grid.Tmax <= grid.Tmin || grid.Pmax <= grid.Pmin, "Cannot build a DEW water table with an empty temperature or pressure range.");
+
+    m_opts.useInterpolation = false;
+    m_nT = numPoints(grid.Tmin, grid.Tmax, grid.dT);
+    m_nP = numPoints(grid.Pmin, grid.Pmax, grid.dP);
+
+    errorif(m_nT < 2 || m_nP < 2, "Cannot build a DEW water table with fewer than two points along temperature or pressure.");
+
+    // The model evaluation used at the nodes, with the same Gibbs integration options as the direct
+    // evaluation used outside the table, so that properties are continuous across its boundary. The
+    // integral is computed incrementally along each isotherm, which keeps the step size (or tolerance)
+    // of a full integration from 1000 bar, so each node costs one pressure step of integration.
+    auto wsOpts = waterStateOptionsDEW(m_opts);
+    wsOpts.gibbs.useIncrementalIntegration = true;
+
+    // Tabulate the values of every property at every node
+    Vec<double> values(m_nT * m_nP * numprops);
+    for(Index i = 0; i < m_nT; ++i)
+    {
+        const double T = grid.Tmin + i * grid.dT;
+        for(Index j = 0; j < m_nP; ++j)
+        {
+            const double P = grid.Pmin + j * grid.dP;
+            const auto ws = waterState(T, P, wsOpts);
+            extractProps(ws, values.data() + (i * m_nP + j) * numprops);
+        }
+    }
+
+    const auto f = [&](Index i, Index j, Index k) { return values[(i * m_nP + j) * numprops + k]; };
+
+    // Finite difference derivative (per grid step) along temperature
+    const auto fx = [&](Index i, Index j, Index k)
+    {
+        if(i == 0) return f(1, j, k) - f(0, j, k);
+        if(i == m_nT - 1) return f(i, j, k) - f(i - 1, j, k);
+        return 0.5 * (f(i + 1, j, k) - f(i - 1, j, k));
+    };
+
+    // Finite difference derivative (per grid step) along pressure
+    const auto fy = [&](Index i, Index j, Index k)
+    {
+        if(j == 0) return f(i, 1, k) - f(i, 0, k);
+        if(j == m_nP - 1) return f(i, j, k) - f(i, j - 1, k);
+        return 0.5 * (f(i, j + 1, k) - f(i, j - 1, k));
+    };
+
+    // Finite difference cross derivative (per grid step squared)
+    const auto fxy = [&](Index i, Index j, Index k)
+    {
+        if(i == 0) return fy(1, j, k) - fy(0, j, k);
+        if(i == m_nT - 1) return fy(i, j, k) - fy(i - 1, j, k);
+        return 0.5 * (fy(i + 1, j, k) - fy(i - 1, j, k));
+    };
+
+    m_data.resize(4 * values.size());
+    for(Index i = 0; i < m_nT; ++i)
+        for(Index j = 0; j < m_nP; ++j)
+            for(Index k = 0; k < numprops; ++k)
+            {
+                double* node = m_data.data() + ((i * m_nP + j) * numprops + k) * 4;
+                node[0] = f(i, j, k);
+                node[1] = fx(i, j, k);
+                node[2] = fy(i, j, k);
+                node[3] = fxy(i, j, k);
+            }
+}
+
+auto WaterStateTableDEW::load(const String& path) -> WaterStateTableDEW
+{
+    std::ifstream file(path, std::ios::binary);
+    errorif(!file.is_open(), "Could not open DEW water table file `", path, "`.");
+
+    const auto read = [&](auto& value) { file.read(reinterpret_cast<char*>(&value), sizeof(value)); };
+
+    char magic[8];
+    file.read(magic, sizeof(magic));
+    std::uint32_t version = 0;
+    read(version);
+
+    errorif(!file || std::memcmp(magic, filemagic, sizeof(magic)) != 0, "File `", path, "` is not a DEW water table file.");
+    errorif(version != fileversion, "DEW water table file `", path, "` has version ", version, " but version ", fileversion, " is expected.");
+
+    WaterStateTableDEW table;
+
+    std::int32_t eos, dielectric, gibbs, born, psat;
+    double psatRelTol;
+    read(eos); read(dielectric); read(gibbs); read(born); read(psat);
+    read(psatRelTol);
+    read(table.m_opts.densityTolerance);
+    table.m_opts.eosModel = static_cast<WaterEosModel>(eos);
+    table.m_opts.dielectricModel = static_cast<WaterDielectricModel>(dielectric);
+    table.m_opts.gibbsModel = static_cast<WaterGibbsModel>(gibbs);
+    table.m_opts.bornModel = static_cast<WaterBornModel>(born);
+    table.m_opts.usePsatPolynomials = psat != 0;
+    table.m_opts.psatRelTol = psatRelTol;
+    table.m_opts.useInterpolation = false;
+
+    auto& grid = table.m_grid;
+    read(grid.Tmin); read(grid.Tmax); read(grid.dT);
+    read(grid.Pmin); read(grid.Pmax); read(grid.dP);
+
+    std::uint64_t nT, nP, nprops;
+    read(nT); read(nP); read(nprops);
+
+    errorif(nprops != numprops, "DEW water table file `", path, "` stores ", nprops, " properties but ", numprops, " are expected.");
+    errorif(nT < 2 || nP < 2, "DEW water table file `", path, "` has fewer than two points along temperature or pressure.");
+    errorif(!(grid.dT > 0.0) || !(grid.dP > 0.0), "DEW water table file `", path, "` has non-positive grid spacing.");
+    errorif(numPoints(grid.Tmin, grid.Tmax, grid.dT) != nT || numPoints(grid.Pmin, grid.Pmax, grid.dP) != nP,
+        "DEW water table file `", path, "` has temperature or pressure ranges inconsistent with its grid spacing and number of points.");
+
+    table.m_nT = nT;
+    table.m_nP = nP;
+    table.m_data.resize(nT * nP * nprops * 4);
+    file.read(reinterpret_cast<char*>(table.m_data.data()), table.m_data.size() * sizeof(double));
+
+    errorif(!file, "DEW water table file `", path, "` is truncated.");
+
+    return table;
+}
+
+auto WaterStateTableDEW::save(const String& path) const -> void
+{
+    std::ofstream file(path, std::ios::binary);
+    errorif(!file.is_open(), "Could not open file `", path, "` for writing the DEW water table.");
+
+    const auto write = [&](const auto& value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+    file.write(filemagic, sizeof(filemagic));
+    write(fileversion);
+
+    write(static_cast<std::int32_t>(m_opts.eosModel));
+    write(static_cast<std::int32_t>(m_opts.dielectricModel));
+    write(static_cast<std::int32_t>(m_opts.gibbsModel));
+    write(static_cast<std::int32_t>(m_opts.bornModel));
+    write(static_cast<std::int32_t>(m_opts.usePsatPolynomials));
+    write(static_cast<double>(m_opts.psatRelTol));
+    write(m_opts.densityTolerance);
+
+    write(m_grid.Tmin); write(m_grid.Tmax); write(m_grid.dT);
+    write(m_grid.Pmin); write(m_grid.Pmax); write(m_grid.dP);
+
+    write(static_cast<std::uint64_t>(m_nT));
+    write(static_cast<std::uint64_t>(m_nP));
+    write(static_cast<std::uint64_t>(numprops));
+
+    file.write(reinterpret_cast<const char*>(m_data.data()), m_data.size() * sizeof(double));
+
+    errorif(!file, "Could not write the DEW water table to file `", path, "`.");
+}
+
+auto WaterStateTableDEW::modelOptions() const -> const WaterModelOptions&
+{
+    return m_opts;
+}
+
+auto WaterStateTableDEW::gridOptions() const -> const WaterStateTableOptionsDEW&
+{
+    return m_grid;
+}
+
+auto WaterStateTableDEW::empty() const -> bool
+{
+    return m_data.empty();
+}
+
+auto WaterStateTableDEW::contains(const real& T, const real& P) const -> bool
+{
+    const auto Tmax = m_grid.Tmin + (m_nT - 1) * m_grid.dT;
+    const auto Pmax = m_grid.Pmin + (m_nP - 1) * m_grid.dP;
+    return !empty() && m_grid.Tmin <= T && T <= Tmax && m_grid.Pmin <= P && P <= Pmax;
+}
+
+auto WaterStateTableDEW::state(const real& T, const real& P) const -> WaterState
+{
+    errorif(!contains(T, P), "Cannot interpolate DEW water properties at ", T, " K and ", P, " Pa, which lie outside the table.");
+
+    // Locate the grid cell containing (T, P) and the local coordinates (u, v) in [0, 1]
+    const real x = (T - m_grid.Tmin) / m_grid.dT;
+    const real y = (P - m_grid.Pmin) / m_grid.dP;
+
+    const auto i = std::min(static_cast<Index>(std::floor(static_cast<double>(x))), m_nT - 2);
+    const auto j = std::min(static_cast<Index>(std::floor(static_cast<double>(y))), m_nP - 2);
+
+    const HermiteBasis bu(x - static_cast<double>(i));
+    const HermiteBasis bv(y - static_cast<double>(j));
+
+    // The weights of the value, T, P and TP derivatives at the four corners of the cell
+    const real wu[2][2] = { { bu.h00, bu.h10 }, { bu.h01, bu.h11 } }; // [corner][value/derivative]
+    const real wv[2][2] = { { bv.h00, bv.h10 }, { bv.h01, bv.h11 } };
+
+    real weights[2][2][4];
+    for(Index a = 0; a < 2; ++a)
+        for(Index b = 0; b < 2; ++b)
+        {
+            weights[a][b][0] = wu[a][0] * wv[b][0];
+            weights[a][b][1] = wu[a][1] * wv[b][0];
+            weights[a][b][2] = wu[a][0] * wv[b][1];
+            weights[a][b][3] = wu[a][1] * wv[b][1];
+        }
+
+    const auto interpolate = [&](Index k) -> real
+    {
+        real res = 0.0;
+        for(Index a = 0; a < 2; ++a)
+            for(Index b = 0; b < 2; ++b)
+            {
+                const double* node = m_data.data() + (((i + a) * m_nP + (j + b)) * numprops + k) * 4;
+                res += weights[a][b][0] * node[0]
+                     + weights[a][b][1] * node[1]
+                     + weights[a][b][2] * node[2]
+                     + weights[a][b][3] * node[3];
+            }
+        return res;
+    };
+
+    WaterState ws;
+
+    Index k = 0;
+    for(auto field : thermofields) ws.thermo.*field = interpolate(k++);
+    for(auto field : electrofields) ws.electro.*field = interpolate(k++);
+    for(auto field : statefields) ws.*field = interpolate(k++);
+
+    ws.thermo.T = T;
+    ws.thermo.P = P;
+    ws.hasGibbs = true;
+    ws.hasSolventG = true;
+
+    return ws;
+}
+
+namespace {
+
+/// A table in the registry, which may still be under construction by another thread.
+struct WaterStateTableEntry
+{
+    WaterModelOptions opts;
+    std::shared_future<SharedPtr<const WaterStateTableDEW>> table;
+};
+
+/// The tables shared by all DEW species, one per set of water model options.
+/// The mutex guards only the lookup and insertion of entries, never the construction of a table.
+struct WaterStateTableRegistry
+{
+    std::mutex mutex;
+    Vec<WaterStateTableEntry> entries;
+};
+
+auto tableRegistry() -> WaterStateTableRegistry&
+{
+    static WaterStateTableRegistry registry;
+    return registry;
+}
+
+/// Return a future that is already set to a given table.
+auto readyTable(SharedPtr<const WaterStateTableDEW> table) -> std::shared_future<SharedPtr<const WaterStateTableDEW>>
+{
+    std::promise<SharedPtr<const WaterStateTableDEW>> promise;
+    promise.set_value(std::move(table));
+    return promise.get_future().share();
+}
+
+} // namespace
+
+auto registerWaterStateTableDEW(const WaterStateTableDEW& table) -> void
+{
+    errorif(table.empty(), "Cannot register an empty DEW water table.");
+
+    auto newtable = readyTable(std::make_shared<const WaterStateTableDEW>(table));
+
+    auto& registry = tableRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for(auto& entry : registry.entries)
+    {
+        if(sameModels(entry.opts, table.modelOptions()))
+        {
+            entry.table = newtable;
+            return;
+        }
+    }
+    registry.entries.push_back({ table.modelOptions(), newtable });
+}
+
+auto clearWaterStateTablesDEW() -> void
+{
+    auto& registry = tableRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.entries.clear();
+}
+
+auto waterStateTableDEW(const WaterModelOptions& opts) -> SharedPtr<const WaterStateTableDEW>
+{
+    auto& registry = tableRegistry();
+
+    std::promise<SharedPtr<const WaterStateTableDEW>> promise;
+    std::shared_future<SharedPtr<const WaterStateTableDEW>> existing;
+
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for(const auto& entry : registry.entries)
+            if(sameModels(entry.opts, opts))
+                existing = entry.table;
+
+        // Insert a placeholder so that concurrent first uses wait for this thread to build the table only once
+        if(!existing.valid())
+            registry.entries.push_back({ opts, promise.get_future().share() });
+    }
+
+    // Wait outside the lock in case the table is still being built by another thread
+    if(existing.valid())
+        return existing.get();
+
+    // Build the table without holding the lock, so that lookups of other tables are not blocked meanwhile
+    try
+    {
+        auto table = std::make_shared<const WaterStateTableDEW>(opts);
+        promise.set_value(table);
+        return table;
+    }
+    catch(...)
+    {
+        // Remove the placeholder so that a later use can try again, and forward the error to the threads waiting for it
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto& entries = registry.entries;
+            const auto placeholder = [&](WaterStateTableEntry const& entry)
+            {
+                return sameModels(entry.opts, opts) && entry.table.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+            };
+            entries.erase(std::remove_if(entries.begin(), entries.end(), placeholder), entries.end());
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
+auto waterStateDEW(real T, real P, const WaterModelOptions& opts) -> WaterState
+{
+    if(opts.useInterpolation)
+    {
+        const auto table = waterStateTableDEW(opts);
+        if(table->contains(T, P))
+            return table->state(T, P);
+    }
+
+    return waterState(T, P, waterStateOptionsDEW(opts));
+}
+
+} // namespace Reaktoro
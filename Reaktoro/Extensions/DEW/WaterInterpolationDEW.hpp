@@ -0,0 +1,114 @@
+// WaterInterpolationDEW.hpp
+//
+// Precomputed DEW water property tables with bicubic interpolation.
+//
+// The DEW water models (Zhang & Duan EOS, dielectric models, ∫V dP Gibbs
+// integral, solvent function g) are evaluated once on a dense T-P grid and
+// afterwards served by C¹ bicubic Hermite interpolation. The derivatives of
+// the interpolant with respect to T and P are those of the same bicubic
+// polynomial, so autodiff seeds on T and P propagate consistently.
+//
+// Nodal derivatives are estimated by finite differences on the grid, so the
+// interpolation error is bounded by the grid spacing and the smoothness of
+// each property; points outside the table are never extrapolated.
+//
+// Select the backend with WaterModelOptions::useInterpolation = true.
+// Tables are built on first use (or registered from a file saved with
+// WaterStateTableDEW::save) and shared by all species using the same
+// water model options.
+
+#pragma once
+
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Extensions/DEW/WaterModelOptions.hpp>
+#include <Reaktoro/Extensions/DEW/WaterState.hpp>
+
+namespace Reaktoro {
+
+/// The grid of a DEW water property table (SI units).
+struct WaterStateTableOptionsDEW
+{
+    /// The minimum temperature of the table [K] (default 100 °C).
+    double Tmin = 373.15;
+
+    /// The maximum temperature of the table [K] (default 1200 °C).
+    double Tmax = 1473.15;
+
+    /// The temperature spacing of the table [K].
+    double dT = 10.0;
+
+    /// The minimum pressure of the table [Pa] (default 1 kbar, the lower limit of the DEW Gibbs integral).
+    double Pmin = 1.0e8;
+
+    /// The maximum pressure of the table [Pa] (default 60 kbar).
+    double Pmax = 6.0e9;
+
+    /// The pressure spacing of the table [Pa] (default 500 bar).
+    double dP = 5.0e7;
+};
+
+/// A table of DEW water states on a uniform T-P grid served by bicubic interpolation.
+class WaterStateTableDEW
+{
+public:
+    /// Construct a default (empty) WaterStateTableDEW object.
+    WaterStateTableDEW();
+
+    /// Construct a WaterStateTableDEW object by evaluating the DEW water models on a grid.
+    /// @param opts The water model options whose properties are tabulated
+    /// @param grid The temperature and pressure grid of the table
+    WaterStateTableDEW(const WaterModelOptions& opts, const WaterStateTableOptionsDEW& grid = {});
+
+    /// Return a WaterStateTableDEW object saved in a binary file with @ref save.
+    static auto load(const String& path) -> WaterStateTableDEW;
+
+    /// Save this table to a binary file.
+    auto save(const String& path) const -> void;
+
+    /// Return the water model options whose properties are tabulated.
+    auto modelOptions() const -> const WaterModelOptions&;
+
+    /// Return the temperature and pressure grid of the table.
+    auto gridOptions() const -> const WaterStateTableOptionsDEW&;
+
+    /// Return true if the table is empty.
+    auto empty() const -> bool;
+
+    /// Return true if (T, P) lies within the table.
+    auto contains(const real& T, const real& P) const -> bool;
+
+    /// Return the interpolated water state at (T, P), which must lie within the table.
+    auto state(const real& T, const real& P) const -> WaterState;
+
+private:
+    /// The water model options whose properties are tabulated.
+    WaterModelOptions m_opts;
+
+    /// The temperature and pressure grid of the table.
+    WaterStateTableOptionsDEW m_grid;
+
+    /// The number of temperature and pressure points in the grid.
+    Index m_nT = 0, m_nP = 0;
+
+    /// The value and the T, P and TP derivatives (per grid step) of every property at every node.
+    Vec<double> m_data;
+};
+
+/// Register a table to be used for its water model options when interpolation is enabled.
+/// Replaces any table previously registered or built for the same options.
+auto registerWaterStateTableDEW(const WaterStateTableDEW& table) -> void;
+
+/// Remove all tables registered or built for interpolation, so that the next use of each set of water model options builds its table again.
+auto clearWaterStateTablesDEW() -> void;
+
+/// Return the table for given water model options, building it with the default grid on first use.
+/// Concurrent first uses of the same options wait for a single construction of the table, while
+/// uses of other options proceed meanwhile.
+auto waterStateTableDEW(const WaterModelOptions& opts) -> SharedPtr<const WaterStateTableDEW>;
+
+/// Return the DEW water state at (T, P) for given water model options.
+/// Uses the interpolation table when `opts.useInterpolation` is true and
+/// (T, P) lies within it, and the direct model evaluation otherwise.
+auto waterStateDEW(real T, real P, const WaterModelOptions& opts) -> WaterState;
+
+} // namespace Reaktoro
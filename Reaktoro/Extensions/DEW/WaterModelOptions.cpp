@@ -23,4 +23,21 @@ auto makeWaterModelOptionsDEW() -> WaterModelOptions
     return opt;
 }
 
+auto operator==(const WaterModelOptions& l, const WaterModelOptions& r) -> bool
+{
+    return l.eosModel           == r.eosModel
+        && l.dielectricModel    == r.dielectricModel
+        && l.gibbsModel         == r.gibbsModel
+        && l.bornModel          == r.bornModel
+        && l.usePsatPolynomials == r.usePsatPolynomials
+        && l.psatRelTol         == r.psatRelTol
+        && l.densityTolerance   == r.densityTolerance
+        && l.useInterpolation   == r.useInterpolation;
+}
+
+auto operator!=(const WaterModelOptions& l, const WaterModelOptions& r) -> bool
+{
+    return !(l == r);
+}
+
 } // namespace Reaktoro
@@ -57,10 +57,22 @@ struct WaterModelOptions
     /// Density calculation tolerance [bar] for Zhang & Duan EOS.
     /// Default 0.001 bar gives high accuracy.
     double densityTolerance = 0.001;
+
+    /// If true, serve water properties from a precomputed T-P table with bicubic
+    /// interpolation (see WaterInterpolationDEW.hpp) instead of evaluating the
+    /// models above at every (T, P). Points outside the table fall back to the
+    /// direct evaluation.
+    bool useInterpolation = false;
 };
 
 /// Convenience: Construct a WaterModelOptions corresponding to
 /// "classic DEW-style" behavior.
 auto makeWaterModelOptionsDEW() -> WaterModelOptions;
 
+/// Return true if two WaterModelOptions objects select the same models and tolerances.
+auto operator==(const WaterModelOptions& l, const WaterModelOptions& r) -> bool;
+
+/// Return true if two WaterModelOptions objects differ in any model or tolerance.
+auto operator!=(const WaterModelOptions& l, const WaterModelOptions& r) -> bool;
+
 } // namespace Reaktoro
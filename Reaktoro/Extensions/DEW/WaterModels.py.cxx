@@ -19,7 +19,9 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Extensions/DEW/WaterInterpolationDEW.hpp>
 #include <Reaktoro/Extensions/DEW/WaterModelOptions.hpp>
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
 using namespace Reaktoro;
 
 void exportDEWWaterModels(py::module& m)
@@ -61,9 +63,53 @@ void exportDEWWaterModels(py::module& m)
         .def_readwrite("bornModel", &WaterModelOptions::bornModel)
         .def_readwrite("usePsatPolynomials", &WaterModelOptions::usePsatPolynomials)
         .def_readwrite("psatRelTol", &WaterModelOptions::psatRelTol)
+        .def_readwrite("densityTolerance", &WaterModelOptions::densityTolerance)
+        .def_readwrite("useInterpolation", &WaterModelOptions::useInterpolation)
         ;
 
     // Export makeWaterModelOptionsDEW function
     m.def("makeWaterModelOptionsDEW", &makeWaterModelOptionsDEW,
         "Create WaterModelOptions with DEW default settings");
+
+    // Export WaterStateTableOptionsDEW struct
+    py::class_<WaterStateTableOptionsDEW>(m, "WaterStateTableOptionsDEW")
+        .def(py::init<>())
+        .def_readwrite("Tmin", &WaterStateTableOptionsDEW::Tmin)
+        .def_readwrite("Tmax", &WaterStateTableOptionsDEW::Tmax)
+        .def_readwrite("dT", &WaterStateTableOptionsDEW::dT)
+        .def_readwrite("Pmin", &WaterStateTableOptionsDEW::Pmin)
+        .def_readwrite("Pmax", &WaterStateTableOptionsDEW::Pmax)
+        .def_readwrite("dP", &WaterStateTableOptionsDEW::dP)
+        ;
+
+    // Export WaterStateTableDEW class (precomputed DEW water property tables)
+    py::class_<WaterStateTableDEW>(m, "WaterStateTableDEW")
+        .def(py::init<>())
+        .def(py::init<const WaterModelOptions&, const WaterStateTableOptionsDEW&>(), py::arg("opts"), py::arg("grid") = WaterStateTableOptionsDEW{})
+        .def_static("load", &WaterStateTableDEW::load)
+        .def("save", &WaterStateTableDEW::save)
+        .def("modelOptions", &WaterStateTableDEW::modelOptions, py::return_value_policy::reference_internal)
+        .def("gridOptions", &WaterStateTableDEW::gridOptions, py::return_value_policy::reference_internal)
+        .def("empty", &WaterStateTableDEW::empty)
+        .def("contains", &WaterStateTableDEW::contains)
+        ;
+
+    m.def("registerWaterStateTableDEW", &registerWaterStateTableDEW,
+        "Register a DEW water table to be used when WaterModelOptions.useInterpolation is true");
+
+    m.def("clearWaterStateTablesDEW", &clearWaterStateTablesDEW,
+        "Remove all DEW water tables registered or built for interpolation");
+
+    // Export WaterStateCache (process-wide cache of DEW water states)
+    py::class_<WaterStateCache, std::unique_ptr<WaterStateCache, py::nodelete>>(m, "WaterStateCache")
+        .def_static("enable", &WaterStateCache::enable)
+        .def_static("disable", &WaterStateCache::disable)
+        .def_static("isEnabled", &WaterStateCache::isEnabled)
+        .def_static("setCapacity", &WaterStateCache::setCapacity)
+        .def_static("capacity", &WaterStateCache::capacity)
+        .def_static("size", &WaterStateCache::size)
+        .def_static("hits", &WaterStateCache::hits)
+        .def_static("misses", &WaterStateCache::misses)
+        .def_static("clear", &WaterStateCache::clear)
+        ;
 }
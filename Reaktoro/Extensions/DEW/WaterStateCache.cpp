@@ -0,0 +1,253 @@
+// WaterStateCache.cpp
+
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
+
+#include <mutex>
+
+#include <Reaktoro/Common/Tracing.hpp>
+#include <Reaktoro/Extensions/DEW/WaterInterpolationDEW.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The key identifying a cached water state, including the derivative seeds of T and P.
+struct WaterStateKey
+{
+    double T  = 0.0; ///< The value of temperature [K]
+    double Tx = 0.0; ///< The derivative seed of temperature
+    double P  = 0.0; ///< The value of pressure [Pa]
+    double Px = 0.0; ///< The derivative seed of pressure
+    WaterModelOptions opts;
+
+    auto operator==(const WaterStateKey& other) const -> bool
+    {
+        return T == other.T && Tx == other.Tx && P == other.P && Px == other.Px && opts == other.opts;
+    }
+};
+
+auto makeKey(const real& T, const real& P, const WaterModelOptions& opts) -> WaterStateKey
+{
+    return { T[0], T[1], P[0], P[1], opts };
+}
+
+} // namespace
+
+auto waterStateOptionsDEW(const WaterModelOptions& waterOpts) -> WaterStateOptions
+{
+    WaterStateOptions opts;
+
+    // Configure thermo model (EOS)
+    opts.thermo.eosModel = waterOpts.eosModel;
+    opts.thermo.usePsatPolynomials = waterOpts.usePsatPolynomials;
+    opts.thermo.psatRelativeTolerance = waterOpts.psatRelTol;
+    opts.thermo.densityTolerance = waterOpts.densityTolerance;
+
+    // Configure dielectric model
+    opts.dielectric.primary = static_cast<WaterDielectricPrimaryModel>(waterOpts.dielectricModel);
+    if (waterOpts.usePsatPolynomials)
+        opts.dielectric.psatMode = WaterDielectricPsatMode::UsePsatWhenNear;
+    else
+        opts.dielectric.psatMode = WaterDielectricPsatMode::None;
+    opts.dielectric.psatRelativeTolerance = waterOpts.psatRelTol;
+
+    // Configure Gibbs calculation (always required for species thermodynamics)
+    opts.computeGibbs = true;
+    opts.gibbs.model = waterOpts.gibbsModel;
+    opts.gibbs.thermo = opts.thermo;  // Use same EOS for Gibbs integral
+    // Use high-precision integration (5000 steps) by default
+    opts.gibbs.integrationSteps = 5000;
+    opts.gibbs.useExcelIntegration = false;
+    opts.gibbs.densityTolerance = waterOpts.densityTolerance;
+
+    // Enable solvent function g and dg/dP (used by the Born omega of every species).
+    // Note: the Psat branch of g evaluates along Psat(T) regardless of P, so it is
+    // not used here; the Psat density override is already applied in opts.thermo.
+    opts.computeSolventG = true;
+    opts.solvent = WaterSolventFunctionOptions{};
+
+    // Enable Born omega calculation if requested
+    if (waterOpts.bornModel != WaterBornModel::None)
+    {
+        opts.computeOmega = true;
+        opts.omega.solvent = opts.solvent;
+    }
+
+    return opts;
+}
+
+struct WaterStateCache::Impl
+{
+    /// The mutex guarding the cached entries and counters.
+    std::mutex mutex;
+
+    /// The cached keys, with the water state of each in `states`.
+    Vec<WaterStateKey> keys;
+
+    /// The cached water states.
+    Vec<WaterState> states;
+
+    /// The index of the entry to be overwritten next once the cache is full.
+    Index next = 0;
+
+    /// The maximum number of cached entries.
+    Index capacity = 32;
+
+    /// The number of calls answered from the cache.
+    Index hits = 0;
+
+    /// The number of calls that required a new water state evaluation.
+    Index misses = 0;
+
+    /// The flag indicating whether caching is enabled.
+    bool enabled = true;
+
+    auto find(const WaterStateKey& key) const -> Index
+    {
+        for(Index i = 0; i < keys.size(); ++i)
+            if(keys[i] == key)
+                return i;
+        return keys.size();
+    }
+
+    auto insert(const WaterStateKey& key, const WaterState& ws) -> void
+    {
+        if(capacity == 0)
+            return;
+        if(keys.size() < capacity)
+        {
+            keys.push_back(key);
+            states.push_back(ws);
+            return;
+        }
+        next = next % capacity;
+        keys[next] = key;
+        states[next] = ws;
+        ++next;
+    }
+
+    auto state(const real& T, const real& P, const WaterModelOptions& opts) -> WaterState
+    {
+        const auto key = makeKey(T, P, opts);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(enabled)
+            {
+                const auto i = find(key);
+                if(i < keys.size())
+                {
+                    RKT_TRACE_COUNT("WaterStateCache::hits", 1);
+                    ++hits;
+                    return states[i];
+                }
+            }
+            RKT_TRACE_COUNT("WaterStateCache::misses", 1);
+            ++misses;
+        }
+
+        // Evaluate outside the lock so concurrent misses for distinct (T, P) do not serialize
+        const auto ws = waterStateDEW(T, P, opts);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(enabled && find(key) == keys.size())
+            insert(key, ws);
+
+        return ws;
+    }
+};
+
+WaterStateCache::WaterStateCache()
+: pimpl(new Impl())
+{}
+
+WaterStateCache::~WaterStateCache()
+{}
+
+auto WaterStateCache::instance() -> WaterStateCache&
+{
+    static WaterStateCache obj;
+    return obj;
+}
+
+auto WaterStateCache::state(real T, real P, const WaterModelOptions& opts) -> WaterState
+{
+    return instance().pimpl->state(T, P, opts);
+}
+
+auto WaterStateCache::enable() -> void
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    impl.enabled = true;
+}
+
+auto WaterStateCache::disable() -> void
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    impl.enabled = false;
+    impl.keys.clear();
+    impl.states.clear();
+    impl.next = 0;
+}
+
+auto WaterStateCache::isEnabled() -> bool
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    return impl.enabled;
+}
+
+auto WaterStateCache::setCapacity(Index capacity) -> void
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    impl.capacity = capacity;
+    if(impl.keys.size() > capacity)
+    {
+        impl.keys.resize(capacity);
+        impl.states.resize(capacity);
+    }
+    impl.next = 0;
+}
+
+auto WaterStateCache::capacity() -> Index
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    return impl.capacity;
+}
+
+auto WaterStateCache::size() -> Index
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    return impl.keys.size();
+}
+
+auto WaterStateCache::hits() -> Index
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    return impl.hits;
+}
+
+auto WaterStateCache::misses() -> Index
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    return impl.misses;
+}
+
+auto WaterStateCache::clear() -> void
+{
+    auto& impl = *instance().pimpl;
+    std::lock_guard<std::mutex> lock(impl.mutex);
+    impl.keys.clear();
+    impl.states.clear();
+    impl.next = 0;
+    impl.hits = 0;
+    impl.misses = 0;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,85 @@
+// WaterStateCache.hpp
+//
+// Process-wide cache of DEW water states shared by all aqueous species.
+//
+// Every aqueous solute using StandardThermoModelDEW needs the same water
+// density, dielectric properties, Gibbs energy and solvent function g at
+// the current (T, P). Without sharing, a DEW aqueous phase with N species
+// repeats the Zhang & Duan density solve and the ∫V dP Gibbs integral N
+// times per property update. With this cache it is done once per (T, P).
+//
+// Entries are keyed on (T, P, WaterModelOptions). The key includes the
+// autodiff derivative seeds of T and P, so a state evaluated while
+// differentiating with respect to T or P is never returned for a call at
+// the same values with different seeds.
+
+#pragma once
+
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Extensions/DEW/WaterModelOptions.hpp>
+#include <Reaktoro/Extensions/DEW/WaterState.hpp>
+
+namespace Reaktoro {
+
+/// Return the WaterStateOptions used by DEW aqueous species for given water model options.
+///
+/// Gibbs energy and the solvent function g (with dg/dP) are always enabled,
+/// since every DEW species needs them for its Born omega and G0 terms.
+auto waterStateOptionsDEW(const WaterModelOptions& opts) -> WaterStateOptions;
+
+/// A process-wide cache of DEW water states keyed on (T, P, WaterModelOptions).
+class WaterStateCache
+{
+public:
+    /// Construct a copy of a WaterStateCache object [deleted].
+    WaterStateCache(const WaterStateCache&) = delete;
+
+    /// Assign a WaterStateCache object to this [deleted].
+    auto operator=(const WaterStateCache&) -> WaterStateCache& = delete;
+
+    /// Return the single WaterStateCache object.
+    static auto instance() -> WaterStateCache&;
+
+    /// Return the DEW water state at (T, P), computing it only if not already cached.
+    static auto state(real T, real P, const WaterModelOptions& opts) -> WaterState;
+
+    /// Enable caching of water states (the default).
+    static auto enable() -> void;
+
+    /// Disable caching of water states (every call to @ref state recomputes).
+    static auto disable() -> void;
+
+    /// Return true if caching of water states is enabled.
+    static auto isEnabled() -> bool;
+
+    /// Set the maximum number of water states kept in the cache (default 32).
+    static auto setCapacity(Index capacity) -> void;
+
+    /// Return the maximum number of water states kept in the cache.
+    static auto capacity() -> Index;
+
+    /// Return the number of water states currently in the cache.
+    static auto size() -> Index;
+
+    /// Return the number of calls to @ref state answered from the cache.
+    static auto hits() -> Index;
+
+    /// Return the number of calls to @ref state that required a new water state evaluation.
+    static auto misses() -> Index;
+
+    /// Remove all cached water states and reset the hit/miss counters.
+    static auto clear() -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+
+    /// Construct a default WaterStateCache object [private].
+    WaterStateCache();
+
+    /// Destroy this WaterStateCache object [private].
+    ~WaterStateCache();
+};
+
+} // namespace Reaktoro
@@ -17,9 +17,6 @@
 
 #include "NasaDatabase.hpp"
 
-// Reaktoro includes
-#include <Reaktoro/Core/Embedded.hpp>
-
 namespace Reaktoro {
 
 NasaDatabase::NasaDatabase(Database database)
@@ -37,8 +34,7 @@ auto NasaDatabase::withName(String name) -> NasaDatabase
         "The currently supported names are: \n"
         "    - nasa-cea \n",
         "");
-    const String contents = Embedded::get("databases/reaktoro/" + name + ".json");
-    return fromStringJSON(contents);
+    return Database::fromEmbeddedFile(name + ".json");
 }
 
 } // namespace Reaktoro
@@ -23,9 +23,6 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
-#include <Reaktoro/Core/Data.hpp>
-#include <Reaktoro/Core/Embedded.hpp>
-#include <Reaktoro/Core/Support/DatabaseParser.hpp>
 
 namespace Reaktoro {
 
@@ -63,10 +60,7 @@ auto SupcrtDatabase::withName(const String& name) -> SupcrtDatabase
         "    - supcrtbl \n",
         "    - supcrtbl-organics \n",
         "");
-    const auto text = Embedded::get("databases/reaktoro/" + name + ".json");
-    const auto doc = Data::parseJson(text);
-    DatabaseParser dbparser(doc);
-    return Database(dbparser);
+    return Database::fromEmbeddedFile(name + ".json");
 }
 
 } // namespace Reaktoro
@@ -31,6 +31,15 @@ struct SmartKineticsOptions : SmartEquilibriumOptions
     /// Construct a  SmartKineticsOptions object from a SmartEquilibriumOptions one.
     SmartKineticsOptions(SmartEquilibriumOptions const& other)
     : SmartEquilibriumOptions(other) {}
+
+    /// The relative tolerance used in the acceptance test for the reaction rates at the predicted chemical state.
+    /// The changes in the extents of the reactions predicted with first-order Taylor approximation, *Δξ*, are
+    /// compared with those obtained from the reaction rates evaluated at the predicted chemical state, *ΔtMr*.
+    /// The prediction is accepted only if |Δξ - ΔtMr| <= reltol_rates * |ΔtMr| + abstol_rates for all reactions.
+    double reltol_rates = 0.1;
+
+    /// The absolute tolerance used in the acceptance test for the reaction rates at the predicted chemical state (in mol).
+    double abstol_rates = 1.0e-10;
 };
 
 } // namespace Reaktoro
@@ -27,5 +27,7 @@ void exportSmartKineticsOptions(py::module& m)
 {
     py::class_<SmartKineticsOptions, SmartEquilibriumOptions>(m, "SmartKineticsOptions")
         .def(py::init<>())
+        .def_readwrite("reltol_rates", &SmartKineticsOptions::reltol_rates, "The relative tolerance used in the acceptance test for the reaction rates at the predicted chemical state.")
+        .def_readwrite("abstol_rates", &SmartKineticsOptions::abstol_rates, "The absolute tolerance used in the acceptance test for the reaction rates at the predicted chemical state (in mol).")
         ;
 }
@@ -17,9 +17,13 @@
 
 #include "SmartKineticsSolver.hpp"
 
+// C++ includes
+#include <cmath>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
@@ -46,7 +50,9 @@ struct SmartKineticsSolver::Impl
     EquilibriumConditions kconditions; ///< The equilibrium conditions used for the kinetics calculations.
     SmartKineticsOptions koptions;     ///< The options of this kinetics solver.
     SmartKineticsResult kresult;       ///< The result of the equilibrium calculation with kinetic constraints
+    const MatrixXd M;                  ///< The matrix *M = tr(K)K* relating the reaction rates to the changes in the extents of the reactions, where *K* is the stoichiometric matrix of the reactions.
     VectorXr w;                        ///< The auxiliary vector used to set the w input variables of the equilibrium conditions used for the kinetics calculations.
+    VectorXd c0;                       ///< The auxiliary vector used to set the initial amounts c0 of the conservative components of the equilibrium conditions used for the kinetics calculations.
     VectorXd plower;                   ///< The auxiliary vector used to set the lower bounds of p variables of the equilibrium conditions used for the kinetics calculations.
     VectorXd pupper;                   ///< The auxiliary vector used to set the upper bounds of p variables of the equilibrium conditions used for the kinetics calculations.
 
@@ -60,7 +66,9 @@ struct SmartKineticsSolver::Impl
       idt(kspecs.indexInputVariable("dt")),
       ksolver(kspecs),
       kconditions(kspecs),
+      M(system.stoichiometricMatrix().transpose() * system.stoichiometricMatrix()),
       w(kdims.Nw),
+      c0(kdims.Nc),
       plower(kdims.Np),
       pupper(kdims.Np)
     {
@@ -76,6 +84,42 @@ struct SmartKineticsSolver::Impl
 
         // Update the options in the underlying equilibrium solver
         ksolver.setOptions(koptions);
+
+        // Update the acceptance test of the predicted states on the reaction rates in the underlying equilibrium solver
+        ksolver.setAcceptanceTest(createAcceptanceTestForReactionRates());
+    }
+
+    /// Create the acceptance test of predicted states that controls the errors in the reaction rates.
+    /// The predicted changes in the extents of the reactions *Δξ* (the last *Nr* control variables *p*) must agree with those
+    /// obtained from the reaction rates evaluated at the predicted state, *ΔtMr*, since Δξ - ΔtMr = 0 in the kinetics step.
+    /// Note that the test captures everything it needs by value, since copies of the equilibrium solver share it.
+    auto createAcceptanceTestForReactionRates() const -> SmartEquilibriumSolver::AcceptanceTest
+    {
+        const auto Nr = kdims.Nr;
+        const auto idt = this->idt;
+        const auto M = this->M;
+        const auto reltol = koptions.reltol_rates;
+        const auto abstol = koptions.abstol_rates;
+
+        return [=](ChemicalState const& state, EquilibriumConditions const& conditions) -> bool
+        {
+            if(Nr == 0)
+                return true;
+
+            const auto dt = state.equilibrium().w()[idt];
+            const auto dxi = state.equilibrium().p().tail(Nr).matrix();
+            const VectorXd r = state.props().reactionRates().cast<double>().matrix();
+            const VectorXd dxirates = dt * M * r;
+
+            using std::abs;
+            using std::isnan;
+
+            for(Index i = 0; i < Nr; ++i)
+                if(abs(dxi[i] - dxirates[i]) > reltol * abs(dxirates[i]) + abstol || isnan(dxirates[i]))
+                    return false;
+
+            return true;
+        };
     }
 
     /// Update the equilibrium conditions for kinetics with given state and time step.
@@ -89,7 +133,11 @@ struct SmartKineticsSolver::Impl
     /// Update the equilibrium conditions for kinetics with given state, time step, and equilibrium conditions to be attained during chemical kinetics.
     auto updateEquilibriumConditionsForKinetics(ChemicalState& state, real const& dt, EquilibriumConditions const& econditions) -> void
     {
+        auto const& K = system.stoichiometricMatrix();
+        auto const& n0 = state.speciesAmounts();
+
         w << econditions.inputValues(), dt;
+        c0 << econditions.initialComponentAmountsGetOrCompute(state), K.transpose() * n0.matrix();
 
         plower.head(edims.Np) = econditions.lowerBoundsControlVariablesP();
         plower.tail(kdims.Nr).fill(-inf); // no lower bounds for Δξ
@@ -98,6 +146,7 @@ struct SmartKineticsSolver::Impl
         pupper.tail(kdims.Nr).fill(+inf); // no upper bounds for Δξ
 
         kconditions.setInputVariables(w);
+        kconditions.setInitialComponentAmounts(c0);
         kconditions.setLowerBoundsControlVariablesP(plower);
         kconditions.setUpperBoundsControlVariablesP(pupper);
     }
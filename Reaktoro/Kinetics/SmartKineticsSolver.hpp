@@ -34,7 +34,12 @@ class KineticsSensitivity;
 struct SmartKineticsOptions;
 struct SmartKineticsResult;
 
-/// Used for chemical kinetics calculations.
+/// Used for chemical kinetics calculations accelerated with on-demand learning.
+/// A kinetics step is first predicted with a first-order Taylor approximation from
+/// a previously learned step, whose acceptance is controlled by the errors in the
+/// chemical potentials of the primary species and in the reaction rates at the
+/// predicted state. A conventional kinetics step is performed and learned otherwise.
+/// @see SmartKineticsOptions
 class SmartKineticsSolver
 {
 public:
@@ -128,4 +128,76 @@ TEST_CASE("Testing SmartKineticsSolver", "[SmartKineticsSolver]")
         CHECK( result.learned() );
         CHECK( result.iterations() == 16 );
     }
+
+    WHEN("the reaction rates at the predicted state fail the error control - calcite and water")
+    {
+        Params params = Params::embedded("PalandriKharaka.yaml");
+
+        SupcrtDatabase db("supcrtbl");
+
+        ChemicalSystem system(db,
+            AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)").setActivityModel(ActivityModelDavies()),
+            MineralPhase("Calcite"),
+            GeneralReaction("Calcite").setRateModel(ReactionRateModelPalandriKharaka(params)),
+            Surface("Calcite").withAreaModel([](ChemicalProps const&) { return 1.0; })
+        );
+
+        SmartKineticsOptions options;
+        options.reltol_rates = 0.0; // any difference between predicted and evaluated reaction rates is rejected
+        options.abstol_rates = 0.0;
+
+        SmartKineticsSolver solver(system);
+        solver.setOptions(options);
+
+        SmartKineticsResult result;
+
+        ChemicalState state(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = solver.solve(state, 0.1);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        // The same change that is predicted with the default options must now be learned
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = solver.solve(state, 0.12);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        // The same change passes the error control with the default tolerances on the reaction rates
+        SmartKineticsSolver defaultsolver(system);
+        defaultsolver.setOptions(SmartKineticsOptions());
+
+        state = ChemicalState(system);
+        state.temperature(25.0, "celsius");
+        state.pressure(1.0, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0, "mol");
+
+        result = defaultsolver.solve(state, 0.1);
+
+        CHECK( result.succeeded() );
+        CHECK( result.learned() );
+
+        state = ChemicalState(system);
+        state.temperature(30.0, "celsius");
+        state.pressure(2.0, "bar");
+        state.set("H2O(aq)", 1.1, "kg");
+        state.set("Calcite", 1.1, "mol");
+
+        result = defaultsolver.solve(state, 0.12);
+
+        CHECK( result.succeeded() );
+        CHECK( result.predicted() );
+    }
 }
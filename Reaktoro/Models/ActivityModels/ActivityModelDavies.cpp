@@ -56,8 +56,7 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
     // The electrical charges of the charged species only
     const ArrayXd charges = mixture.charges()(icharged_species);
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous mixture
@@ -67,7 +66,8 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const stateptr = std::make_shared<AqueousMixtureState>(mixture.state(T, P, x));
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -326,8 +326,7 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         bneutral.push_back(params.bneutral(species.formula()));
     }
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous mixture
@@ -337,7 +336,8 @@ auto activityModelDebyeHuckel(const SpeciesList& species, ActivityModelDebyeHuck
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const stateptr = std::make_shared<AqueousMixtureState>(mixture.state(T, P, x));
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -188,8 +188,7 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
     ArrayXr xr;
     ArrayXr xq;
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -202,7 +201,8 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         auto const RT = universalGasConstant*T;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        auto const aqstateptr = std::make_shared<AqueousMixtureState>(solution.state(T, P, x));
+        auto const& aqstate = *aqstateptr;
 
         // The ionic strength of the solution and its square root
         auto const& I = aqstate.Ie;
@@ -333,8 +333,7 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         charges.push_back(species.charge());
     }
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     // Define the activity model function of the aqueous phase
@@ -344,7 +343,8 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const stateptr = std::make_shared<AqueousMixtureState>(mixture.state(T, P, x));
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
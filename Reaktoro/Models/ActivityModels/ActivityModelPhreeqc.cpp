@@ -93,8 +93,7 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         s_x.push_back(s);
     }
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -106,7 +105,8 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         assert(x.minCoeff() > 0.0 && x.maxCoeff() <= 1.0);
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        auto const aqstateptr = std::make_shared<AqueousMixtureState>(solution.state(T, P, x));
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -34,6 +34,7 @@
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcWater.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
@@ -319,17 +320,51 @@ struct PitzerParam
 
     /// The temperature-pressure correction model for the interaction parameter.
     const Fn<real(real const&, real const&)> model;
+};
+
+/// Used to store the interaction parameters of one kind (e.g., all \eq{\beta^{(0)}_{ij}} parameters) in contiguous arrays.
+struct PitzerParamGroup
+{
+    Indices i0; ///< The indices of the first species in the interactions.
+    Indices i1; ///< The indices of the second species in the interactions.
+    Indices i2; ///< The indices of the third species in the interactions (empty for binary interactions).
 
-    /// The current value of the interaction parameter since last update.
-    real value;
+    Vec<Fn<real(real const&, real const&)>> models; ///< The temperature-pressure correction models of the interaction parameters.
 
-    /// Update the current value of the interaction parameter.
-    auto update(real const& T, real const& P)
+    Index offset = 0; ///< The position of the values of these interaction parameters in PitzerParamValues::values.
+
+    /// Add an interaction parameter to this group if its species exist in the solution.
+    auto add(PitzerParam const& param) -> bool
     {
-        value = model(T, P);
+        if(param.ispecies.empty())
+            return false;
+        i0.push_back(param.ispecies[0]);
+        i1.push_back(param.ispecies[1]);
+        if(param.ispecies.size() > 2)
+            i2.push_back(param.ispecies[2]);
+        models.push_back(param.model);
+        return true;
+    }
+
+    /// Return the number of interaction parameters in this group.
+    auto size() const -> Index
+    {
+        return models.size();
     }
 };
 
+/// The values of all Pitzer interaction parameters and of \eq{A^\phi} at a temperature and pressure.
+struct PitzerParamValues
+{
+    double T  = 0.0; ///< The temperature of these values (in K).
+    double Tx = 0.0; ///< The derivative seed of temperature.
+    double P  = 0.0; ///< The pressure of these values (in Pa).
+    double Px = 0.0; ///< The derivative seed of pressure.
+
+    ArrayXr values; ///< The values of the interaction parameters of all groups, one group after another.
+    real Aphi;      ///< The Debye-Huckel parameter \eq{A^\phi(T, P)}.
+};
+
 /// Auxiliary alias for ActivityModelParamsPitzer::InteractionParamAttribs.
 using PitzerInteractionParamAttribs = ActivityModelParamsPitzer::InteractionParamAttribs;
 
@@ -585,29 +620,6 @@ auto computeJ0J1PHREEQC(real const& X) -> Tuple<real, real>
     return { JAY, JPRIME };
 }
 
-/// The function that computes electrostatic mixing effects of unsymmetrical cation-cation and anion-anion pairs \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)}.
-auto computeThetaValuesInterpolation(real const& I, real const& sqrtI, real const& Aphi, double zi, double zj) -> Pair<real, real>
-{
-    auto const aux = 6.0*Aphi*sqrtI;
-
-    auto const xij = zi*zj*aux;
-    auto const xii = zi*zi*aux;
-    auto const xjj = zj*zj*aux;
-
-    auto const J0ij = J0(xij);
-    auto const J0ii = J0(xii);
-    auto const J0jj = J0(xjj);
-
-    auto const J1ij = J1(xij);
-    auto const J1ii = J1(xii);
-    auto const J1jj = J1(xjj);
-
-    auto const thetaE = zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
-    auto const thetaEP = zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaE/I;
-
-    return { thetaE, thetaEP };
-}
-
 /// The function that computes electrostatic mixing effects of unsymmetrical cation-cation and anion-anion pairs \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} exactly like in PHREEQC.
 auto computeThetaValuesPHREEQC(real const& I, real const& sqrtI, real const& Aphi, double zi, double zj) -> Pair<real, real>
 {
@@ -635,121 +647,181 @@ struct PitzerState
     ArrayXr ln_gamma; ///< The activity coefficients of the aqueous species (natural log).
 };
 
+/// Return the index of `value` in `values`, appending it to `values` first if not yet there.
+template<typename T>
+auto indexOrAppend(Vec<T>& values, T const& value) -> Index
+{
+    auto const idx = index(values, value);
+    if(idx == values.size())
+        values.push_back(value);
+    return idx;
+}
+
 /// The auxiliary type used to implement the Pitzer activity model.
 struct PitzerModel
 {
     AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
 
-    Vec<PitzerParam> beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
-    Vec<PitzerParam> psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
-    Vec<PitzerParam> lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
-    Vec<PitzerParam> zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
-    Vec<PitzerParam> mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
-    Vec<PitzerParam> eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+    PitzerParamGroup beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamGroup theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
+    PitzerParamGroup psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
+    PitzerParamGroup lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
+    PitzerParamGroup zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
+    PitzerParamGroup mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
+    PitzerParamGroup eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+
+    Index numparams = 0; ///< The total number of interaction parameters in all groups above.
 
-    Vec<real> alpha1; ///< The parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
-    Vec<real> alpha2; ///< The parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    Vec<real> alpha1; ///< The distinct values of the parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    Vec<real> alpha2; ///< The distinct values of the parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(2)}_{ij}}.
+    Indices ialpha1;  ///< The index in `alpha1` of the \eq{alpha_1_{ij}} value used with each parameter \eq{\beta^{(1)}_{ij}}.
+    Indices ialpha2;  ///< The index in `alpha2` of the \eq{alpha_2_{ij}} value used with each parameter \eq{\beta^{(2)}_{ij}}.
 
     using Tuples2i = Tuples<Index, Index>;                   ///< Auxiliary type for a tuple of 2 index values.
+    using Tuples3i = Tuples<Index, Index, Index>;            ///< Auxiliary type for a tuple of 3 index values.
+    using Tuples2d = Tuples<double, double>;                 ///< Auxiliary type for a tuple of 2 double values.
     using Tuples3d = Tuples<double, double, double>;         ///< Auxiliary type for a tuple of 3 double values.
     using Tuples4d = Tuples<double, double, double, double>; ///< Auxiliary type for a tuple of 4 double values.
 
     Tuples3d lambda_coeffs; ///< The coefficients multiplying the terms where the lambda Pitzer parameter is involved.
     Tuples4d mu_coeffs;     ///< The coefficients multiplying the terms where the mu Pitzer parameter is involved.
 
-    Tuples2i thetaij; ///< The indices (i, j) of the cation-cation and anion-anion species pairs used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
-    ArrayXr thetaE;   ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} associated to the \eq{\theta_{ij}} parameters.
-    ArrayXr thetaEP;  ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} associated to the \eq{\theta_{ij}} parameters.
+    Tuples2i thetaij;    ///< The indices (i, j) of the cation-cation and anion-anion species pairs with unequal charges used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions (these vanish for pairs with equal charges).
+    Indices ithetazz;    ///< The index in `thetazz` of the charge class of each species pair in `thetaij`.
+    Tuples2d thetazz;    ///< The distinct charge classes (zi, zj) of the species pairs in `thetaij`.
+    Tuples3i thetazzk;   ///< The indices in `thetaxz` of the charge products zi*zj, zi*zi, and zj*zj of each charge class in `thetazz`.
+    Vec<double> thetaxz; ///< The distinct charge products for which \eq{J_0(x)} and \eq{J_1(x)} need to be evaluated.
 
     Fn<real(real const&, real const&)> Aphi; ///< The function that computes the Debye-huckel parameter \eq{A^\phi(T, P)} in the Pitzer model.
 
+    Vec<PitzerParamValues> cache; ///< The values of the interaction parameters at the most recently used temperatures and pressures.
+    Index cachenext = 0;          ///< The index of the entry in `cache` to be overwritten next once the cache is full.
+
+    /// The maximum number of temperature-pressure pairs for which the interaction parameters are cached.
+    static constexpr Index cachecapacity = 8;
+
+    ArrayXr G1, GP1, E1; ///< The workspace for \eq{g(\alpha_1\sqrt{I})}, \eq{g^\prime(\alpha_1\sqrt{I})}, and \eq{e^{-\alpha_1\sqrt{I}}} for each distinct \eq{\alpha_1}.
+    ArrayXr G2, GP2, E2; ///< The workspace for \eq{g(\alpha_2\sqrt{I})}, \eq{g^\prime(\alpha_2\sqrt{I})}, and \eq{e^{-\alpha_2\sqrt{I}}} for each distinct \eq{\alpha_2}.
+    ArrayXr J0x, J1x;    ///< The workspace for \eq{J_0(x)} and \eq{J_1(x)} for each distinct charge product in `thetaxz`.
+    ArrayXr thetaE;      ///< The workspace for \eq{^{E}\theta_{ij}(I)} for each charge class in `thetazz`.
+    ArrayXr thetaEP;     ///< The workspace for \eq{^{E}\theta_{ij}^{\prime}(I)} for each charge class in `thetazz`.
+
     /// Construct a default Pitzer object.
     PitzerModel()
     {}
 
     /// Construct a Pitzer object with given list of species in the aqueous solution and the parameters for the Pitzer activity model.
-    // PitzerModel(SpeciesList const& specieslist, ActivityModelParamsPitzer const& params)
     PitzerModel(AqueousMixture const& solution, ActivityModelParamsPitzer const& params)
     : solution(solution)
     {
         for(auto const& entry : params.beta0)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta0.push_back(param);
+            beta0.add(createPitzerParamBinary(solution.species(), entry));
 
         for(auto const& entry : params.beta1)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta1.push_back(param);
+            beta1.add(createPitzerParamBinary(solution.species(), entry));
 
         for(auto const& entry : params.beta2)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta2.push_back(param);
+            beta2.add(createPitzerParamBinary(solution.species(), entry));
 
         for(auto const& entry : params.Cphi)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                Cphi.push_back(param);
+            Cphi.add(createPitzerParamBinary(solution.species(), entry));
 
         for(auto const& entry : params.theta)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                theta.push_back(param);
+            theta.add(createPitzerParamBinary(solution.species(), entry));
 
         for(auto const& entry : params.psi)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                psi.push_back(param);
+            psi.add(createPitzerParamTernary(solution.species(), entry));
 
         for(auto const& entry : params.lambda)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                lambda.push_back(param);
+            lambda.add(createPitzerParamBinary(solution.species(), entry));
 
         for(auto const& entry : params.zeta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                zeta.push_back(param);
+            zeta.add(createPitzerParamTernary(solution.species(), entry));
 
         for(auto const& entry : params.mu)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                mu.push_back(param);
+            mu.add(createPitzerParamTernary(solution.species(), entry));
 
         for(auto const& entry : params.eta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                eta.push_back(param);
+            eta.add(createPitzerParamTernary(solution.species(), entry));
+
+        for(auto group : { &beta0, &beta1, &beta2, &Cphi, &theta, &psi, &lambda, &zeta, &mu, &eta })
+        {
+            group->offset = numparams;
+            numparams += group->size();
+        }
+
+        Vec<real> alpha1s, alpha2s;
 
         for(auto const& entry : params.beta1)
-            alpha1.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1));
+            alpha1s.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1));
 
         for(auto const& entry : params.beta2)
-            alpha2.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2));
+            alpha2s.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2));
+
+        for(auto i = 0; i < beta1.size(); ++i)
+            ialpha1.push_back(indexOrAppend(alpha1, alpha1s[i]));
+
+        for(auto i = 0; i < beta2.size(); ++i)
+            ialpha2.push_back(indexOrAppend(alpha2, alpha2s[i]));
+
+        auto const& z = solution.charges();
 
         auto const& ications = solution.indicesCations();
         auto const& ianions = solution.indicesAnions();
 
-        for(auto i = 0; i < ications.size() - 1; ++i)
+        auto addThetaPair = [&](Index i, Index j)
+        {
+            if(z[i] == z[j])
+                return;
+            thetaij.emplace_back(i, j);
+            ithetazz.push_back(indexOrAppend(thetazz, Tuple<double, double>{ z[i], z[j] }));
+        };
+
+        for(auto i = 0; i < ications.size(); ++i)
             for(auto j = i + 1; j < ications.size(); ++j)
-                thetaij.emplace_back(ications[i], ications[j]);
+                addThetaPair(ications[i], ications[j]);
 
-        for(auto i = 0; i < ianions.size() - 1; ++i)
+        for(auto i = 0; i < ianions.size(); ++i)
             for(auto j = i + 1; j < ianions.size(); ++j)
-                thetaij.emplace_back(ianions[i], ianions[j]);
+                addThetaPair(ianions[i], ianions[j]);
 
-        auto const& z = solution.charges();
+        for(auto const& [zi, zj] : thetazz)
+        {
+            auto const kij = indexOrAppend(thetaxz, zi*zj);
+            auto const kii = indexOrAppend(thetaxz, zi*zi);
+            auto const kjj = indexOrAppend(thetaxz, zj*zj);
+            thetazzk.emplace_back(kij, kii, kjj);
+        }
 
-        for(auto const& entry : lambda)
+        for(auto i = 0; i < lambda.size(); ++i)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
+            auto const i1 = lambda.i0[i];
+            auto const i2 = lambda.i1[i];
             lambda_coeffs.push_back(determineLambdaCoeffs(z[i1], z[i2], i1, i2));
         }
 
-        for(auto const& entry : mu)
+        for(auto i = 0; i < mu.size(); ++i)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            auto const i3 = entry.ispecies[2];
+            auto const i1 = mu.i0[i];
+            auto const i2 = mu.i1[i];
+            auto const i3 = mu.i2[i];
             mu_coeffs.push_back(determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3));
         }
 
+        G1.resize(alpha1.size());
+        GP1.resize(alpha1.size());
+        E1.resize(alpha1.size());
+        G2.resize(alpha2.size());
+        GP2.resize(alpha2.size());
+        E2.resize(alpha2.size());
+        J0x.resize(thetaxz.size());
+        J1x.resize(thetaxz.size());
+        thetaE.resize(thetazz.size());
+        thetaEP.resize(thetazz.size());
+
         // Define the function Aphi(T, P) according to PHREEQC (see method calc_dielectrics at utilities.cpp for computing A0)
         Aphi = [](real const& T, real const& P) -> real
         {
@@ -762,44 +834,43 @@ struct PitzerModel
             auto const Aphi0 = DH_B * e2_DkT / 6.0;
             return Aphi0;
         };
-
-        Aphi = memoizeLast(Aphi); // memoize so that subsequent repeated calls with same (T, P) return cached result.
     }
 
-    /// Update all Pitzer interaction parameters according to current temperature and pressure.
-    auto updateParams(real const& T, real const& P)
+    /// Return the values of all Pitzer interaction parameters at given temperature and pressure, evaluating them only if not cached yet.
+    auto params(real const& T, real const& P) -> PitzerParamValues const&
     {
-        auto const Pbar = P * 1e-5; // from Pa to bar
+        for(auto const& entry : cache)
+            if(entry.T == T[0] && entry.Tx == T[1] && entry.P == P[0] && entry.Px == P[1])
+            {
+                RKT_TRACE_COUNT("ActivityModelPitzer::cache::hits", 1);
+                return entry;
+            }
 
-        for(auto& param : beta0)
-            param.value = param.model(T, Pbar);
+        RKT_TRACE_COUNT("ActivityModelPitzer::cache::misses", 1);
 
-        for(auto& param : beta1)
-            param.value = param.model(T, Pbar);
+        auto const ientry = cache.size() < cachecapacity ? cache.size() : cachenext++ % cachecapacity;
 
-        for(auto& param : beta2)
-            param.value = param.model(T, Pbar);
+        if(ientry == cache.size())
+            cache.emplace_back();
 
-        for(auto& param : Cphi)
-            param.value = param.model(T, Pbar);
+        auto& entry = cache[ientry];
 
-        for(auto& param : theta)
-            param.value = param.model(T, Pbar);
+        entry.T  = T[0];
+        entry.Tx = T[1];
+        entry.P  = P[0];
+        entry.Px = P[1];
 
-        for(auto& param : psi)
-            param.value = param.model(T, Pbar);
+        entry.values.resize(numparams);
 
-        for(auto& param : lambda)
-            param.value = param.model(T, Pbar);
+        auto const Pbar = P * 1e-5; // from Pa to bar
 
-        for(auto& param : zeta)
-            param.value = param.model(T, Pbar);
+        for(auto group : { &beta0, &beta1, &beta2, &Cphi, &theta, &psi, &lambda, &zeta, &mu, &eta })
+            for(auto i = 0; i < group->size(); ++i)
+                entry.values[group->offset + i] = group->models[i](T, Pbar);
 
-        for(auto& param : mu)
-            param.value = param.model(T, Pbar);
+        entry.Aphi = Aphi(T, P);
 
-        for(auto& param : eta)
-            param.value = param.model(T, Pbar);
+        return entry;
     }
 
     /// Evaluate the Pitzer model and compute the properties of the aqueous solution.
@@ -813,9 +884,6 @@ struct PitzerModel
         auto const& icharged = solution.indicesCharged();
         auto const& Mw = solution.water().molarMass(); // in kg/mol
 
-        /// Update all Pitzer interaction parameters according to current temperature and pressure.
-        updateParams(T, P);
-
         // The ionic strength of the solution and its square-root
         auto const I = aqstate.Ie;
         auto const DI = sqrt(I);
@@ -834,76 +902,127 @@ struct PitzerModel
         if(OSUM == 0.0)
             return;
 
-        // Compute the Debye-Huckel coefficient Aphi0 at (T, P)
-        auto const Aphi0 = Aphi(T, P);
+        // The Pitzer interaction parameters and the Debye-Huckel coefficient Aphi0 at (T, P)
+        auto const& values = params(T, P);
+        auto const& Aphi0 = values.Aphi;
+
+        auto const vbeta0  = values.values.segment(beta0.offset, beta0.size());
+        auto const vbeta1  = values.values.segment(beta1.offset, beta1.size());
+        auto const vbeta2  = values.values.segment(beta2.offset, beta2.size());
+        auto const vCphi   = values.values.segment(Cphi.offset, Cphi.size());
+        auto const vtheta  = values.values.segment(theta.offset, theta.size());
+        auto const vpsi    = values.values.segment(psi.offset, psi.size());
+        auto const vlambda = values.values.segment(lambda.offset, lambda.size());
+        auto const vzeta   = values.values.segment(zeta.offset, zeta.size());
+        auto const vmu     = values.values.segment(mu.offset, mu.size());
+        auto const veta    = values.values.segment(eta.offset, eta.size());
+
+        // Evaluate the ionic strength dependent functions once per distinct alpha value instead of once per beta parameter
+        for(auto k = 0; k < alpha1.size(); ++k)
+        {
+            auto const x = alpha1[k] * DI;
+            G1[k] = G(x);
+            GP1[k] = GP(x);
+            E1[k] = exp(-x);
+        }
+
+        for(auto k = 0; k < alpha2.size(); ++k)
+        {
+            auto const x = alpha2[k] * DI;
+            G2[k] = G(x);
+            GP2[k] = GP(x);
+            E2[k] = exp(-x);
+        }
+
+        // Evaluate J0 and J1 once per distinct charge product and then ^E theta and ^E theta' once per charge class
+        auto const aux = 6.0*Aphi0*DI;
+
+        for(auto k = 0; k < thetaxz.size(); ++k)
+        {
+            J0x[k] = J0(thetaxz[k]*aux);
+            J1x[k] = J1(thetaxz[k]*aux);
+        }
+
+        for(auto c = 0; c < thetazz.size(); ++c)
+        {
+            auto const [zi, zj] = thetazz[c];
+            auto const [kij, kii, kjj] = thetazzk[c];
+
+            thetaE[c] = zi*zj/(4*I) * (J0x[kij] - 0.5*J0x[kii] - 0.5*J0x[kjj]);
+            thetaEP[c] = zi*zj/(8*I*I) * (J1x[kij] - 0.5*J1x[kii] - 0.5*J1x[kjj]) - thetaE[c]/I;
+        }
 
         // The b parameter of the Pitzer model
-	    auto const B = 1.2;
+        auto const B = 1.2;
 
         // The F term in the Pitzer model
-	    real F = -Aphi0*(DI/(1 + B*DI) + 2.0*log(1.0 + B*DI)/B);
+        real F = -Aphi0*(DI/(1 + B*DI) + 2.0*log(1.0 + B*DI)/B);
 
         // The osmotic coefficient of water in the Pitzer model
         OSMOT = -Aphi0*I*DI/(1 + B*DI);
 
-        for(auto const& param : beta0)
+        for(auto i = 0; i < beta0.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = beta0.i0[i];
+            auto const i1 = beta0.i1[i];
 
-            LGAMMA[i0] += M[i1] * 2.0 * param.value;
-            LGAMMA[i1] += M[i0] * 2.0 * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            LGAMMA[i0] += M[i1] * 2.0 * vbeta0[i];
+            LGAMMA[i1] += M[i0] * 2.0 * vbeta0[i];
+            OSMOT += M[i0] * M[i1] * vbeta0[i];
         }
 
-        for(auto const& [i, param] : enumerate(beta1))
+        for(auto i = 0; i < beta1.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            F += M[i0] * M[i1] * param.value * GP(alpha1[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha1[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha1[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha1[i] * DI);
+            auto const i0 = beta1.i0[i];
+            auto const i1 = beta1.i1[i];
+            auto const k = ialpha1[i];
+
+            F += M[i0] * M[i1] * vbeta1[i] * GP1[k]/I;
+            LGAMMA[i0] += M[i1] * 2.0 * vbeta1[i] * G1[k];
+            LGAMMA[i1] += M[i0] * 2.0 * vbeta1[i] * G1[k];
+            OSMOT += M[i0] * M[i1] * vbeta1[i] * E1[k];
         }
 
-        for(auto const& [i, param] : enumerate(beta2))
+        for(auto i = 0; i < beta2.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            F += M[i0] * M[i1] * param.value * GP(alpha2[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha2[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha2[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha2[i] * DI);
+            auto const i0 = beta2.i0[i];
+            auto const i1 = beta2.i1[i];
+            auto const k = ialpha2[i];
+
+            F += M[i0] * M[i1] * vbeta2[i] * GP2[k]/I;
+            LGAMMA[i0] += M[i1] * 2.0 * vbeta2[i] * G2[k];
+            LGAMMA[i1] += M[i0] * 2.0 * vbeta2[i] * G2[k];
+            OSMOT += M[i0] * M[i1] * vbeta2[i] * E2[k];
         }
 
-        for(auto const& param : Cphi)
+        for(auto i = 0; i < Cphi.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = Cphi.i0[i];
+            auto const i1 = Cphi.i1[i];
 
             auto const aux = 2.0 * sqrt(abs(z[i0] * z[i1]));
 
-            CSUM += M[i0] * M[i1] * param.value/aux;
-            LGAMMA[i0] += M[i1] * BIGZ * param.value/aux;
-            LGAMMA[i1] += M[i0] * BIGZ * param.value/aux;
-            OSMOT += M[i0] * M[i1] * BIGZ * param.value/aux;
+            CSUM += M[i0] * M[i1] * vCphi[i]/aux;
+            LGAMMA[i0] += M[i1] * BIGZ * vCphi[i]/aux;
+            LGAMMA[i1] += M[i0] * BIGZ * vCphi[i]/aux;
+            OSMOT += M[i0] * M[i1] * BIGZ * vCphi[i]/aux;
         }
 
-        for(auto const& param : theta)
+        for(auto i = 0; i < theta.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = theta.i0[i];
+            auto const i1 = theta.i1[i];
 
-            LGAMMA[i0] += 2.0 * M[i1] * param.value;
-            LGAMMA[i1] += 2.0 * M[i0] * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            LGAMMA[i0] += 2.0 * M[i1] * vtheta[i];
+            LGAMMA[i1] += 2.0 * M[i0] * vtheta[i];
+            OSMOT += M[i0] * M[i1] * vtheta[i];
         }
 
-        for(auto const& [i0, i1] : thetaij)
+        for(auto const& [k, pair] : enumerate(thetaij))
         {
-            auto const [etheta, ethetap] = computeThetaValuesInterpolation(I, DI, Aphi0, z[i0], z[i1]);
+            auto const [i0, i1] = pair;
+            auto const& etheta = thetaE[ithetazz[k]];
+            auto const& ethetap = thetaEP[ithetazz[k]];
 
             F += M[i0] * M[i1] * ethetap;
             LGAMMA[i0] += 2.0 * M[i1] * etheta;
@@ -911,66 +1030,66 @@ struct PitzerModel
             OSMOT += M[i0] * M[i1] * (etheta + I*ethetap);
         }
 
-        for(auto const& param : psi)
+        for(auto i = 0; i < psi.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = psi.i0[i];
+            auto const i1 = psi.i1[i];
+            auto const i2 = psi.i2[i];
+
+            LGAMMA[i0] += M[i1] * M[i2] * vpsi[i];
+            LGAMMA[i1] += M[i0] * M[i2] * vpsi[i];
+            LGAMMA[i2] += M[i0] * M[i1] * vpsi[i];
+            OSMOT += M[i0] * M[i1] * M[i2] * vpsi[i];
         }
 
-        for(auto const& [i, param] : enumerate(lambda))
+        for(auto i = 0; i < lambda.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = lambda.i0[i];
+            auto const i1 = lambda.i1[i];
 
             auto const [clng0, clng1, cosm] = lambda_coeffs[i];
 
-            LGAMMA[i0] += M[i1] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * param.value * clng1;
-            OSMOT += M[i0] * M[i1] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * vlambda[i] * clng0;
+            LGAMMA[i1] += M[i0] * vlambda[i] * clng1;
+            OSMOT += M[i0] * M[i1] * vlambda[i] * cosm;
         }
 
-        for(auto const& param : zeta)
+        for(auto i = 0; i < zeta.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = zeta.i0[i];
+            auto const i1 = zeta.i1[i];
+            auto const i2 = zeta.i2[i];
+
+            LGAMMA[i0] += M[i1] * M[i2] * vzeta[i];
+            LGAMMA[i1] += M[i0] * M[i2] * vzeta[i];
+            LGAMMA[i2] += M[i0] * M[i1] * vzeta[i];
+            OSMOT += M[i0] * M[i1] * M[i2] * vzeta[i];
         }
 
-        for(auto const& [i, param] : enumerate(mu))
+        for(auto i = 0; i < mu.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
+            auto const i0 = mu.i0[i];
+            auto const i1 = mu.i1[i];
+            auto const i2 = mu.i2[i];
 
             auto const [clng0, clng1, clng2, cosm] = mu_coeffs[i];
 
-            LGAMMA[i0] += M[i1] * M[i2] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value * clng1;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value * clng2;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * M[i2] * vmu[i] * clng0;
+            LGAMMA[i1] += M[i0] * M[i2] * vmu[i] * clng1;
+            LGAMMA[i2] += M[i0] * M[i1] * vmu[i] * clng2;
+            OSMOT += M[i0] * M[i1] * M[i2] * vmu[i] * cosm;
         }
 
-        for(auto const& param : eta)
+        for(auto i = 0; i < eta.size(); ++i)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = eta.i0[i];
+            auto const i1 = eta.i1[i];
+            auto const i2 = eta.i2[i];
+
+            LGAMMA[i0] += M[i1] * M[i2] * veta[i];
+            LGAMMA[i1] += M[i0] * M[i2] * veta[i];
+            LGAMMA[i2] += M[i0] * M[i1] * veta[i];
+            OSMOT += M[i0] * M[i1] * M[i2] * veta[i];
         }
 
         // Finalise the calculation of the activity coefficient by adding the missing F and CSUM contributions
@@ -1001,8 +1120,7 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
     // The PitzerState object that holds computed properties of the aqueous solution by the Pitzer model
     PitzerState pzstate;
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto aqstateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto aqsolutionptr = std::make_shared<AqueousMixture>(solution);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -1011,7 +1129,8 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
         auto const& [T, P, x] = args;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        auto const aqstateptr = std::make_shared<AqueousMixtureState>(solution.state(T, P, x));
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
@@ -792,4 +792,49 @@ TEST_CASE("Testing ActivityModelPitzer", "[ActivityModelPitzer]")
         CHECK( props.ln_g[31]/ln10 == Approx( 0.239383000) ); // H4SiO4 (PHREEQC:  0.23937, difference: 5.43e-03 %)
         CHECK( props.ln_g[32]/ln10 == Approx(-1.906930000) ); // Sr+2 (PHREEQC: -1.90518, difference: 9.19e-02 %)
     }
+
+    WHEN("the model is evaluated at more temperatures and pressures than those with cached interaction parameters")
+    {
+        const auto species = SpeciesList("H2O H+ OH- Na+ K+ Mg+2 Ca+2 Cl- SO4-2 HCO3- CO3-2 CO2");
+
+        const auto x = ArrayXr::Constant(species.size(), 1.0 / species.size()).eval();
+
+        const auto P = 1.0e+5;
+
+        const auto generator = ActivityModelPitzer();
+
+        // The activity model reused across all evaluations below
+        ActivityModel fn = generator(species);
+
+        ActivityProps props = ActivityProps::create(species.size());
+        ActivityProps expected = ActivityProps::create(species.size());
+
+        for(auto i = 0; i < 2; ++i)
+        {
+            for(auto j = 0; j < 12; ++j)
+            {
+                const real T = 298.15 + 5.0*j;
+
+                fn(props, {T, P, x});
+
+                generator(species)(expected, {T, P, x});
+
+                CHECK( props.ln_g.isApprox(expected.ln_g) );
+                CHECK( props.ln_a.isApprox(expected.ln_a) );
+            }
+        }
+
+        // Check derivatives with respect to temperature are not mistaken for cached values at the same temperature
+        real T = 298.15;
+
+        fn(props, {T, P, x});
+
+        autodiff::seed(T);
+        fn(props, {T, P, x});
+        generator(species)(expected, {T, P, x});
+        autodiff::unseed(T);
+
+        for(auto i = 0; i < species.size(); ++i)
+            CHECK( props.ln_g[i][1] == Approx(expected.ln_g[i][1]) );
+    }
 }
@@ -1390,8 +1390,7 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
     // Initialize the Pitzer params
     PitzerParams pitzer(mixture);
 
-    // Shared pointers used in `props.extra` to avoid heap memory allocation for big objects
-    auto stateptr = std::make_shared<AqueousMixtureState>();
+    // Shared pointer used in `props.extra` to avoid heap memory allocation for the big aqueous mixture object
     auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
 
     ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args) mutable
@@ -1400,7 +1399,8 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        auto const stateptr = std::make_shared<AqueousMixtureState>(mixture.state(T, P, x));
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
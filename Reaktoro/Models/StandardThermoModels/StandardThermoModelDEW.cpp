@@ -24,6 +24,7 @@ using std::log;
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Extensions/DEW/WaterState.hpp>
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
 #include <Reaktoro/Extensions/DEW/WaterBornOmegaDEW.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 
@@ -50,47 +51,7 @@ const auto theta = 228.0;
 /// The constant characteristic ψ of the solvent (in units of Pa)
 const auto psi = 2600.0e+05;
 
-/// Configure WaterStateOptions for DEW thermo calculations
-auto configureWaterStateOptions(const WaterModelOptions& waterOpts) -> WaterStateOptions
-{
-    WaterStateOptions opts;
-
-    // Configure thermo model (EOS)
-    opts.thermo.eosModel = waterOpts.eosModel;
-    opts.thermo.usePsatPolynomials = waterOpts.usePsatPolynomials;
-    opts.thermo.psatRelativeTolerance = waterOpts.psatRelTol;
-    opts.thermo.densityTolerance = waterOpts.densityTolerance;
-
-    // Configure dielectric model
-    opts.dielectric.primary = static_cast<WaterDielectricPrimaryModel>(waterOpts.dielectricModel);
-    if (waterOpts.usePsatPolynomials)
-        opts.dielectric.psatMode = WaterDielectricPsatMode::UsePsatWhenNear;
-    else
-        opts.dielectric.psatMode = WaterDielectricPsatMode::None;
-    opts.dielectric.psatRelativeTolerance = waterOpts.psatRelTol;
-
-    // Configure Gibbs calculation (always required for species thermodynamics)
-    opts.computeGibbs = true;
-    opts.gibbs.model = waterOpts.gibbsModel;
-    opts.gibbs.thermo = opts.thermo;  // Use same EOS for Gibbs integral
-    // Use high-precision integration (5000 steps) by default
-    opts.gibbs.integrationSteps = 5000;
-    opts.gibbs.useExcelIntegration = false;
-    opts.gibbs.densityTolerance = waterOpts.densityTolerance;
-
-    // Enable solvent function (for omega calculation)
-    opts.computeSolventG = true;
-    opts.solvent.Psat = waterOpts.usePsatPolynomials;
-
-    // Enable Born omega calculation if requested
-    if (waterOpts.bornModel != WaterBornModel::None)
-    {
-        opts.computeOmega = true;
-        opts.omega.solvent = opts.solvent;
-    }
-
-    return opts;
-}} // namespace
+} // namespace
 
 auto StandardThermoModelDEW(const StandardThermoModelParamsDEW& params) -> StandardThermoModel
 {
@@ -99,12 +60,10 @@ auto StandardThermoModelDEW(const StandardThermoModelParamsDEW& params) -> Stand
         auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
         const auto& [Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wr, charge, Tmax, waterOpts] = params;
 
-        // Configure and compute DEW water state
-        const auto wsOpts = configureWaterStateOptions(waterOpts);
-        const auto ws = waterState(T, P, wsOpts);
+        // Fetch the DEW water state shared by all DEW species at (T, P)
+        const auto ws = WaterStateCache::state(T, P, waterOpts);
 
-        // Extract water thermo properties
-        const auto& wt = ws.thermo;
+        // Extract water electrostatic properties
         const auto& we = ws.electro;
 
         // Born omega values (using DEW models if enabled)
@@ -120,9 +79,10 @@ auto StandardThermoModelDEW(const StandardThermoModelParamsDEW& params) -> Stand
             // Compute DEW Born omega and derivatives for ALL species (charged and neutral)
             // Neutral species have constant omega = wref (polarization/quadrupole)
             // Charged species have pressure-dependent omega from Born theory
+            // The solvent function g and dg/dP come from the shared water state
             WaterBornOmegaOptions omegaOpts;  // Use default options
-            w = waterBornOmegaDEW(T, P, wt, wr, charge, omegaOpts);
-            wP = waterBornDOmegaDP_DEW(T, P, wt, wr, charge, omegaOpts);
+            w = waterBornOmegaDEW(T, P, ws.g_solv, wr, charge, omegaOpts);
+            wP = waterBornDOmegaDP_DEW(T, P, ws.g_solv, ws.dgdP, wr, charge, omegaOpts);
 
             // For temperature derivatives, we'd need to compute at T±ε
             // Simplified approach: use Born function derivatives from WaterElectroProps
@@ -55,6 +55,32 @@ auto ClusterConnectivity::extend() -> void
     matrix.push_back(PriorityQueue::withInitialPrioritiesAndOrder(priorities, order));
 }
 
+auto ClusterConnectivity::remove(Indices const& iclusters) -> void
+{
+    if(iclusters.empty())
+        return;
+
+    Vec<bool> removed(size(), false);
+    for(auto icluster : iclusters)
+    {
+        assert(icluster < size());
+        removed[icluster] = true;
+    }
+
+    // Remove the rows of the removed clusters and their entries in the remaining rows
+    Deque<PriorityQueue> rows;
+    for(Index i = 0; i < size(); ++i)
+    {
+        if(removed[i])
+            continue;
+        rows.push_back(std::move(matrix[i]));
+        rows.back().remove(iclusters);
+    }
+
+    matrix = std::move(rows);
+    queue.remove(iclusters);
+}
+
 auto ClusterConnectivity::increment(Index icluster, Index jcluster) -> void
 {
     // Only jcluster needs to be bounded, because icluster >= size() has a specific logic
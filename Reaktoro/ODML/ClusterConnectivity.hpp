@@ -36,6 +36,10 @@ public:
     /// Extend the connectivity matrix following creation of a new cluster.
     auto extend() -> void;
 
+    /// Remove clusters from the connectivity matrix, after which the remaining ones are renumbered.
+    /// @param iclusters The indices of the clusters to be removed.
+    auto remove(Indices const& iclusters) -> void;
+
     /// Increment the rank/usage count for the connectivity from one cluster to another.
     /// @param icluster The index of the starting cluster.
     /// @param jcluster The index of the cluster which usage count is incremented.
@@ -0,0 +1,199 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "KdTree.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+#include <queue>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+KdTree::KdTree()
+{}
+
+KdTree::KdTree(VectorXdConstRef scaling)
+: scaling(scaling)
+{}
+
+auto KdTree::size() const -> Index
+{
+    return points.size();
+}
+
+auto KdTree::dimension() const -> Index
+{
+    return points.empty() ? 0 : points.front().size();
+}
+
+auto KdTree::add(VectorXdConstRef point) -> void
+{
+    errorif(!points.empty() && point.size() != dimension(), "Expecting a point with dimension ", dimension(), " in KdTree::add but got one with dimension ", point.size(), ".");
+    errorif(scaling.size() && point.size() != scaling.size(), "Expecting a point with dimension ", scaling.size(), " (the number of scaling factors) in KdTree::add but got one with dimension ", point.size(), ".");
+
+    if(scaling.size())
+        points.push_back(point.cwiseProduct(scaling));
+    else points.push_back(point);
+
+    // Rebuild the tree once the unindexed points exceed half the indexed ones
+    const auto nindexed = tree.size();
+    const auto nunindexed = points.size() - nindexed;
+    if(nunindexed > std::max<Index>(8, nindexed / 2))
+        rebuild();
+}
+
+auto KdTree::remove(Indices const& ipoints) -> void
+{
+    if(ipoints.empty())
+        return;
+
+    Vec<bool> removed(points.size(), false);
+    for(auto ipoint : ipoints)
+    {
+        errorif(ipoint >= points.size(), "Cannot remove point with index ", ipoint, " in KdTree::remove since there are only ", points.size(), " points.");
+        removed[ipoint] = true;
+    }
+
+    Index j = 0;
+    for(Index i = 0; i < points.size(); ++i)
+        if(!removed[i])
+            points[j++] = std::move(points[i]);
+    points.resize(j);
+
+    rebuild();
+}
+
+auto KdTree::clear() -> void
+{
+    points.clear();
+    tree.clear();
+    axes.clear();
+}
+
+auto KdTree::nearest(VectorXdConstRef point, Index k) const -> Indices
+{
+    k = std::min(k, size());
+
+    if(k == 0)
+        return {};
+
+    const VectorXd x = scaling.size() ? VectorXd(point.cwiseProduct(scaling)) : VectorXd(point);
+
+    // The k nearest points found so far, with the farthest one on top
+    std::priority_queue<Pair<double, Index>> best;
+
+    auto consider = [&](Index ipoint)
+    {
+        const auto d = (points[ipoint] - x).squaredNorm();
+        if(best.size() < k)
+            best.push({ d, ipoint });
+        else if(d < best.top().first)
+        {
+            best.pop();
+            best.push({ d, ipoint });
+        }
+    };
+
+    auto search = [&](auto&& self, Index begin, Index end) -> void
+    {
+        if(begin >= end)
+            return;
+
+        const auto mid = begin + (end - begin)/2;
+        const auto ipoint = tree[mid];
+        const auto axis = axes[mid];
+
+        consider(ipoint);
+
+        const auto delta = x[axis] - points[ipoint][axis];
+
+        // Search first the side of the splitting plane containing the point
+        if(delta < 0.0)
+        {
+            self(self, begin, mid);
+            if(best.size() < k || delta*delta < best.top().first)
+                self(self, mid + 1, end);
+        }
+        else
+        {
+            self(self, mid + 1, end);
+            if(best.size() < k || delta*delta < best.top().first)
+                self(self, begin, mid);
+        }
+    };
+
+    search(search, 0, tree.size());
+
+    // Scan the points added after the last rebuild
+    for(auto ipoint = tree.size(); ipoint < points.size(); ++ipoint)
+        consider(ipoint);
+
+    Indices result(best.size());
+    for(auto i = result.size(); i > 0; --i)
+    {
+        result[i - 1] = best.top().second;
+        best.pop();
+    }
+
+    return result;
+}
+
+auto KdTree::rebuild() -> void
+{
+    tree.resize(points.size());
+    axes.resize(points.size());
+    std::iota(tree.begin(), tree.end(), 0);
+    build(0, tree.size());
+}
+
+auto KdTree::build(Index begin, Index end) -> void
+{
+    if(end - begin <= 1)
+    {
+        if(begin < end)
+            axes[begin] = 0;
+        return;
+    }
+
+    // Split along the coordinate with largest spread among the points in this subtree
+    VectorXd lower = points[tree[begin]];
+    VectorXd upper = lower;
+    for(auto i = begin + 1; i < end; ++i)
+    {
+        lower = lower.cwiseMin(points[tree[i]]);
+        upper = upper.cwiseMax(points[tree[i]]);
+    }
+
+    Index axis = 0;
+    (upper - lower).maxCoeff(&axis);
+
+    const auto mid = begin + (end - begin)/2;
+
+    std::nth_element(tree.begin() + begin, tree.begin() + mid, tree.begin() + end,
+        [&](Index l, Index r) { return points[l][axis] < points[r][axis]; });
+
+    axes[mid] = axis;
+
+    build(begin, mid);
+    build(mid + 1, end);
+}
+
+} // namespace Reaktoro
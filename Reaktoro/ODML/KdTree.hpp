@@ -0,0 +1,79 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// A k-d tree for nearest-neighbor queries over points that are added incrementally.
+/// Every coordinate is multiplied by a scaling factor before distances are computed,
+/// so that coordinates of different magnitudes contribute comparably. Points added
+/// after the last rebuild are kept in an unindexed tail that is scanned linearly,
+/// and the tree is rebuilt once this tail grows beyond half the indexed points.
+class KdTree
+{
+public:
+    /// Construct a default instance of KdTree (points are not scaled).
+    KdTree();
+
+    /// Construct an instance of KdTree with given scaling factors for the point coordinates.
+    explicit KdTree(VectorXdConstRef scaling);
+
+    /// Return the number of points in the tree.
+    auto size() const -> Index;
+
+    /// Return the dimension of the points in the tree (zero if no point has been added yet).
+    auto dimension() const -> Index;
+
+    /// Add a new point to the tree, identified by its insertion index.
+    auto add(VectorXdConstRef point) -> void;
+
+    /// Remove given points from the tree, after which the remaining points are identified by their new insertion indices.
+    /// @param ipoints The indices of the points to be removed
+    auto remove(Indices const& ipoints) -> void;
+
+    /// Remove all points from the tree, keeping its scaling factors.
+    auto clear() -> void;
+
+    /// Return the indices of the `k` points nearest to a given point, ordered by increasing distance.
+    auto nearest(VectorXdConstRef point, Index k) const -> Indices;
+
+private:
+    /// Rebuild the tree so that all points are indexed.
+    auto rebuild() -> void;
+
+    /// Recursively build the subtree with points `tree[begin:end]`.
+    auto build(Index begin, Index end) -> void;
+
+    /// The scaling factors of the point coordinates (empty if points are not scaled).
+    VectorXd scaling;
+
+    /// The scaled points added to the tree, in insertion order.
+    Vec<VectorXd> points;
+
+    /// The indices of the points arranged as an implicit balanced tree (the root of `tree[begin:end]` is at its middle).
+    Indices tree;
+
+    /// The splitting coordinate of each node of the implicit tree.
+    Indices axes;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,117 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/ODML/KdTree.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing KdTree", "[KdTree]")
+{
+    // The brute-force search for the k nearest points, used for comparison
+    auto bruteforce = [](Vec<VectorXd> const& points, VectorXd const& scaling, VectorXd const& x, Index k)
+    {
+        Indices indices(points.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        auto distance = [&](Index i) { return (points[i] - x).cwiseProduct(scaling).squaredNorm(); };
+        std::stable_sort(indices.begin(), indices.end(), [&](Index l, Index r) { return distance(l) < distance(r); });
+        indices.resize(std::min(k, points.size()));
+        return indices;
+    };
+
+    const auto dim = 5;
+
+    VectorXd scaling = VectorXd::Ones(dim);
+    scaling[0] = 1.0e-2; // e.g., temperature in K
+    scaling[1] = 1.0e-5; // e.g., pressure in Pa
+
+    KdTree tree(scaling);
+
+    CHECK( tree.size() == 0 );
+    CHECK( tree.dimension() == 0 );
+    CHECK( tree.nearest(VectorXd::Zero(dim), 3).empty() );
+
+    Vec<VectorXd> points;
+
+    std::srand(1234);
+
+    auto randompoint = [&]()
+    {
+        VectorXd x = VectorXd::Random(dim);
+        x[0] = 300.0 + 50.0 * x[0];
+        x[1] = 1.0e5 + 1.0e5 * x[1];
+        return x;
+    };
+
+    // Add points one at a time, checking queries both before and after the tree is rebuilt
+    for(auto i = 0; i < 300; ++i)
+    {
+        points.push_back(randompoint());
+        tree.add(points.back());
+
+        if(i % 37 == 0)
+        {
+            const VectorXd x = randompoint();
+            CHECK( tree.nearest(x, 7) == bruteforce(points, scaling, x, 7) );
+        }
+    }
+
+    CHECK( tree.size() == 300 );
+    CHECK( tree.dimension() == dim );
+
+    for(auto i = 0; i < 20; ++i)
+    {
+        const VectorXd x = randompoint();
+        CHECK( tree.nearest(x, 1) == bruteforce(points, scaling, x, 1) );
+        CHECK( tree.nearest(x, 10) == bruteforce(points, scaling, x, 10) );
+    }
+
+    // An existing point is its own nearest point
+    CHECK( tree.nearest(points[123], 1) == Indices{123} );
+
+    // Asking for more points than there are in the tree returns all of them
+    CHECK( tree.nearest(points[0], 1000).size() == 300 );
+
+    // Points with wrong dimension are not accepted
+    CHECK_THROWS( tree.add(VectorXd::Zero(dim + 1)) );
+
+    // Removing points renumbers the remaining ones in their insertion order
+    tree.remove({ 0, 10, 123, 299 });
+    for(auto i : { 299, 123, 10, 0 })
+        points.erase(points.begin() + i);
+
+    CHECK( tree.size() == 296 );
+
+    for(auto i = 0; i < 10; ++i)
+    {
+        const VectorXd x = randompoint();
+        CHECK( tree.nearest(x, 5) == bruteforce(points, scaling, x, 5) );
+    }
+
+    CHECK_THROWS( tree.remove({ 296 }) );
+
+    tree.clear();
+
+    CHECK( tree.size() == 0 );
+    CHECK( tree.nearest(points[0], 3).empty() );
+}
@@ -113,6 +113,41 @@ auto PriorityQueue::extend() -> void
     _order.push_back(_order.size());
 }
 
+auto PriorityQueue::remove(Indices const& identities) -> void
+{
+    if(identities.empty())
+        return;
+
+    const auto size = _priorities.size();
+
+    Vec<bool> removed(size, false);
+    for(auto identity : identities)
+    {
+        assert(identity < size);
+        removed[identity] = true;
+    }
+
+    // The new index of each remaining entity
+    Indices inew(size, size);
+
+    Deque<Index> priorities;
+    for(Index i = 0; i < size; ++i)
+    {
+        if(removed[i])
+            continue;
+        inew[i] = priorities.size();
+        priorities.push_back(_priorities[i]);
+    }
+
+    Deque<Index> order;
+    for(auto i : _order)
+        if(!removed[i])
+            order.push_back(inew[i]);
+
+    _priorities = std::move(priorities);
+    _order = std::move(order);
+}
+
 auto PriorityQueue::priorities() const -> Deque<Index> const&
 {
     return _priorities;
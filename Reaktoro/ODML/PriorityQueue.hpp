@@ -56,6 +56,10 @@ public:
     /// Extend the queue with the introduction of a new tracked entity.
     auto extend() -> void;
 
+    /// Remove tracked entities from the queue, after which the remaining ones are renumbered keeping their priorities and order.
+    /// @param identities The indices of the tracked entities to be removed.
+    auto remove(Indices const& identities) -> void;
+
     /// Return the current priorities of each tracked entity in the queue.
     auto priorities() const -> Deque<Index> const&;
 
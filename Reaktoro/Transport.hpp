@@ -17,4 +17,5 @@
 
 #pragma once
 
+#include <Reaktoro/Transport/ReactiveTransportSolver.hpp>
 #include <Reaktoro/Transport/TransportSolver.hpp>
@@ -0,0 +1,371 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ReactiveTransportSolver.hpp"
+
+// C++ includes
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumHotStart.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Kinetics/KineticsResult.hpp>
+#include <Reaktoro/Kinetics/KineticsSolver.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return true if a phase is fluid (i.e., aqueous, liquid or gaseous), so that its species are transported.
+auto isFluidPhase(Phase const& phase) -> bool
+{
+    switch(phase.aggregateState())
+    {
+    case AggregateState::Aqueous: return true;
+    case AggregateState::Liquid:  return true;
+    case AggregateState::Gas:     return true;
+    case AggregateState::Fluid:   return true;
+    default:                      return false;
+    }
+}
+
+} // namespace
+
+ChemicalField::ChemicalField(Index size, ChemicalSystem const& system)
+: m_states(size, ChemicalState(system))
+{}
+
+ChemicalField::ChemicalField(Index size, ChemicalState const& state)
+: m_states(size, state)
+{}
+
+auto ChemicalField::set(ChemicalState const& state) -> void
+{
+    for(auto& item : m_states)
+        item = state;
+}
+
+auto ChemicalField::temperature(VectorXdRef values) const -> void
+{
+    errorif(values.size() != size(), "Expecting a vector with ", size(), " entries in ChemicalField::temperature, but got ", values.size(), ".");
+    for(Index i = 0; i < size(); ++i)
+        values[i] = m_states[i].temperature().val();
+}
+
+auto ChemicalField::pressure(VectorXdRef values) const -> void
+{
+    errorif(values.size() != size(), "Expecting a vector with ", size(), " entries in ChemicalField::pressure, but got ", values.size(), ".");
+    for(Index i = 0; i < size(); ++i)
+        values[i] = m_states[i].pressure().val();
+}
+
+struct ReactiveTransportSolver::Impl
+{
+    /// The synchronization primitives used in the reaction calculations on the cells.
+    /// These are never copied, so copies of a reactive transport solver do not share them.
+    struct Sync
+    {
+        /// The thread pool used in the reaction calculations (created on first use).
+        Ptr<ThreadPool> pool;
+
+        Sync() {}
+        Sync(Sync const&) {}
+        auto operator=(Sync const&) -> Sync& { return *this; }
+    };
+
+    /// The chemical system common to all cells.
+    ChemicalSystem system;
+
+    /// The options of the reactive transport solver.
+    ReactiveTransportOptions options;
+
+    /// The solver of the transport equations.
+    TransportSolver transportsolver;
+
+    /// The indices of the species in fluid phases.
+    Indices ifs;
+
+    /// The amounts of the fluid species on the left boundary.
+    VectorXd nbc;
+
+    /// The amounts of the fluid species on the cells (one row per cell).
+    MatrixXd nf;
+
+    /// The chemical equilibrium solvers of each thread.
+    Deque<EquilibriumSolver> equilibriumsolvers;
+
+    /// The states of the last equilibrium calculation on each cell used to hot-start the next one.
+    Vec<EquilibriumHotStart> hotstarts;
+
+    /// The chemical kinetics solvers of each thread.
+    Deque<KineticsSolver> kineticssolvers;
+
+    /// The smart chemical equilibrium solver (which uses its own threads in batch calculations).
+    Optional<SmartEquilibriumSolver> smartsolver;
+
+    /// The synchronization primitives used in the reaction calculations on the cells.
+    Sync sync;
+
+    /// Construct a ReactiveTransportSolver::Impl object.
+    Impl(ChemicalSystem const& system)
+    : system(system)
+    {
+        const auto& phases = system.phases();
+        auto offset = 0;
+        for(auto const& phase : phases)
+        {
+            const auto size = phase.species().size();
+            if(isFluidPhase(phase))
+                for(auto i = 0; i < size; ++i)
+                    ifs.push_back(offset + i);
+            offset += size;
+        }
+
+        nbc = zeros(ifs.size());
+    }
+
+    auto setOptions(ReactiveTransportOptions const& opts) -> void
+    {
+        errorif(opts.use_kinetics && opts.use_smart_equilibrium, "Could not set the options of ReactiveTransportSolver. Smart equilibrium acceleration is not supported with chemical kinetics calculations.");
+        options = opts;
+
+        // Solvers are recreated with the new options in the next step
+        equilibriumsolvers.clear();
+        kineticssolvers.clear();
+        smartsolver.reset();
+    }
+
+    auto setBoundaryState(ChemicalState const& state) -> void
+    {
+        errorif(state.system().species().size() != system.species().size(), "Could not set the boundary state of ReactiveTransportSolver. The given chemical state is not of the same chemical system.");
+        auto const& n = state.speciesAmounts();
+        for(auto j = 0; j < ifs.size(); ++j)
+            nbc[j] = n[ifs[j]].val();
+    }
+
+    /// Return the number of threads used in the reaction calculations.
+    auto numThreads() const -> Index
+    {
+        return options.threads ? options.threads : std::max<Index>(std::thread::hardware_concurrency(), 1);
+    }
+
+    /// Create the solvers used in the reaction calculations if not yet created.
+    auto initializeSolvers() -> void
+    {
+        const auto nthreads = numThreads();
+
+        if(!sync.pool || sync.pool->size() != nthreads)
+            sync.pool = std::make_unique<ThreadPool>(nthreads);
+
+        if(options.use_smart_equilibrium)
+        {
+            if(!smartsolver)
+            {
+                auto smartoptions = options.smart_equilibrium;
+                smartoptions.batch_threads = nthreads;
+                smartsolver.emplace(system);
+                smartsolver->setOptions(smartoptions);
+            }
+        }
+        else if(options.use_kinetics)
+        {
+            while(kineticssolvers.size() < nthreads)
+            {
+                kineticssolvers.emplace_back(system);
+                kineticssolvers.back().setOptions(options.kinetics);
+            }
+        }
+        else
+        {
+            while(equilibriumsolvers.size() < nthreads)
+            {
+                equilibriumsolvers.emplace_back(system);
+                equilibriumsolvers.back().setOptions(options.equilibrium);
+            }
+        }
+    }
+
+    auto initialize() -> void
+    {
+        transportsolver.initialize();
+        initializeSolvers();
+    }
+
+    auto step(ChemicalField& field) -> ReactiveTransportResult
+    {
+        const auto num_cells = transportsolver.mesh().numCells();
+        const auto Nf = ifs.size();
+
+        errorif(field.size() != num_cells, "Could not step the reactive transport solver. The chemical field has ", field.size(), " cells, but the mesh has ", num_cells, " cells.");
+
+        ReactiveTransportResult result;
+
+        initializeSolvers();
+
+        //---------------------------------------------------------------------
+        // TRANSPORT STEP
+        //---------------------------------------------------------------------
+        const auto begintransport = time();
+
+        // Collect the amounts of the fluid species on the cells
+        nf.resize(num_cells, Nf);
+        for(auto icell = 0; icell < num_cells; ++icell)
+        {
+            auto const& n = field[icell].speciesAmounts();
+            for(auto j = 0; j < Nf; ++j)
+                nf(icell, j) = n[ifs[j]].val();
+        }
+
+        // Transport the amounts of each fluid species
+        for(auto j = 0; j < Nf; ++j)
+        {
+            transportsolver.setBoundaryValue(nbc[j]);
+            transportsolver.step(nf.col(j));
+        }
+
+        // Remove negative amounts that the transport scheme may produce near sharp fronts
+        nf = nf.cwiseMax(0.0);
+
+        // Update the amounts of the fluid species on the cells
+        for(auto icell = 0; icell < num_cells; ++icell)
+        {
+            ArrayXr n = field[icell].speciesAmounts();
+            for(auto j = 0; j < Nf; ++j)
+                n[ifs[j]] = nf(icell, j);
+            field[icell].setSpeciesAmounts(n);
+        }
+
+        result.time_transport = elapsed(begintransport);
+
+        //---------------------------------------------------------------------
+        // REACTION STEP
+        //---------------------------------------------------------------------
+        const auto beginreaction = time();
+
+        if(options.use_smart_equilibrium)
+        {
+            auto results = smartsolver->solveBatch(field.states());
+            for(auto& res : results)
+            {
+                result.failures += res.failed();
+                result.predictions += res.predicted();
+            }
+        }
+        else
+        {
+            const auto dt = transportsolver.getTimeStep();
+
+            Vec<char> failed(num_cells, false);
+
+            hotstarts.resize(num_cells);
+
+            sync.pool->run(num_cells, [&](Index icell, Index ithread)
+            {
+                failed[icell] = options.use_kinetics ?
+                    kineticssolvers[ithread].solve(field[icell], dt).failed() :
+                    equilibriumsolvers[ithread].solve(field[icell], hotstarts[icell]).failed();
+            });
+
+            for(auto f : failed)
+                result.failures += f;
+        }
+
+        result.time_reaction = elapsed(beginreaction);
+
+        return result;
+    }
+};
+
+ReactiveTransportSolver::ReactiveTransportSolver(ChemicalSystem const& system)
+: pimpl(new Impl(system))
+{}
+
+ReactiveTransportSolver::ReactiveTransportSolver(ReactiveTransportSolver const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ReactiveTransportSolver::~ReactiveTransportSolver()
+{}
+
+auto ReactiveTransportSolver::operator=(ReactiveTransportSolver other) -> ReactiveTransportSolver&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ReactiveTransportSolver::setOptions(ReactiveTransportOptions const& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto ReactiveTransportSolver::setMesh(Mesh const& mesh) -> void
+{
+    pimpl->transportsolver.setMesh(mesh);
+}
+
+auto ReactiveTransportSolver::setVelocity(double val) -> void
+{
+    pimpl->transportsolver.setVelocity(val);
+}
+
+auto ReactiveTransportSolver::setDiffusionCoeff(double val) -> void
+{
+    pimpl->transportsolver.setDiffusionCoeff(val);
+}
+
+auto ReactiveTransportSolver::setBoundaryState(ChemicalState const& state) -> void
+{
+    pimpl->setBoundaryState(state);
+}
+
+auto ReactiveTransportSolver::setTimeStep(double val) -> void
+{
+    pimpl->transportsolver.setTimeStep(val);
+}
+
+auto ReactiveTransportSolver::system() const -> ChemicalSystem const&
+{
+    return pimpl->system;
+}
+
+auto ReactiveTransportSolver::mesh() const -> Mesh const&
+{
+    return pimpl->transportsolver.mesh();
+}
+
+auto ReactiveTransportSolver::indicesFluidSpecies() const -> Indices const&
+{
+    return pimpl->ifs;
+}
+
+auto ReactiveTransportSolver::initialize() -> void
+{
+    pimpl->initialize();
+}
+
+auto ReactiveTransportSolver::step(ChemicalField& field) -> ReactiveTransportResult
+{
+    return pimpl->step(field);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,173 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumOptions.hpp>
+#include <Reaktoro/Kinetics/KineticsOptions.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalSystem;
+
+/// Used to represent the chemical states on the cells of a mesh.
+class ChemicalField
+{
+public:
+    /// Construct a ChemicalField object with given number of cells, each with a default chemical state of a system.
+    ChemicalField(Index size, ChemicalSystem const& system);
+
+    /// Construct a ChemicalField object with given number of cells, each with a copy of a chemical state.
+    ChemicalField(Index size, ChemicalState const& state);
+
+    /// Return the number of cells in the chemical field.
+    auto size() const -> Index { return m_states.size(); }
+
+    /// Return the chemical state on a cell.
+    auto operator[](Index index) const -> ChemicalState const& { return m_states[index]; }
+
+    /// Return the chemical state on a cell.
+    auto operator[](Index index) -> ChemicalState& { return m_states[index]; }
+
+    /// Return the chemical states on the cells.
+    auto states() const -> Vec<ChemicalState> const& { return m_states; }
+
+    /// Return the chemical states on the cells.
+    auto states() -> Vec<ChemicalState>& { return m_states; }
+
+    /// Set the chemical state on every cell.
+    auto set(ChemicalState const& state) -> void;
+
+    /// Write the temperatures on the cells into a vector (in K).
+    auto temperature(VectorXdRef values) const -> void;
+
+    /// Write the pressures on the cells into a vector (in Pa).
+    auto pressure(VectorXdRef values) const -> void;
+
+private:
+    /// The chemical states on the cells.
+    Vec<ChemicalState> m_states;
+};
+
+/// The options for the reactive transport calculations.
+/// @see ReactiveTransportSolver
+struct ReactiveTransportOptions
+{
+    /// The options for the chemical equilibrium calculations on the cells.
+    EquilibriumOptions equilibrium;
+
+    /// The options for the smart chemical equilibrium calculations on the cells (if @ref use_smart_equilibrium is true).
+    SmartEquilibriumOptions smart_equilibrium;
+
+    /// The options for the chemical kinetics calculations on the cells (if @ref use_kinetics is true).
+    KineticsOptions kinetics;
+
+    /// The flag indicating if chemical kinetics calculations are performed on the cells instead of chemical equilibrium calculations.
+    bool use_kinetics = false;
+
+    /// The flag indicating if chemical equilibrium calculations on the cells are accelerated with SmartEquilibriumSolver.
+    bool use_smart_equilibrium = false;
+
+    /// The number of threads used in the calculations on the cells (zero means the number of hardware threads).
+    Index threads = 0;
+};
+
+/// The result of a step of a reactive transport calculation.
+/// @see ReactiveTransportSolver
+struct ReactiveTransportResult
+{
+    /// The number of cells whose reaction calculation failed.
+    Index failures = 0;
+
+    /// The number of cells whose chemical equilibrium state was predicted with SmartEquilibriumSolver.
+    Index predictions = 0;
+
+    /// The wall time spent in the transport calculation (in s).
+    double time_transport = 0.0;
+
+    /// The wall time spent in the reaction calculations on the cells (in s).
+    double time_reaction = 0.0;
+};
+
+/// Used for solving one-dimensional reactive transport problems with operator splitting.
+/// In each step, the amounts of the species in fluid phases (aqueous, liquid and
+/// gaseous) are transported with a TransportSolver, and then each cell is reacted
+/// with either chemical equilibrium or chemical kinetics calculations. The cells
+/// are reacted concurrently on a pool of threads, each with its own solver.
+class ReactiveTransportSolver
+{
+public:
+    /// Construct a ReactiveTransportSolver object for a chemical system.
+    ReactiveTransportSolver(ChemicalSystem const& system);
+
+    /// Construct a copy of a ReactiveTransportSolver object.
+    ReactiveTransportSolver(ReactiveTransportSolver const& other);
+
+    /// Destroy this ReactiveTransportSolver object.
+    ~ReactiveTransportSolver();
+
+    /// Assign a copy of a ReactiveTransportSolver object to this.
+    auto operator=(ReactiveTransportSolver other) -> ReactiveTransportSolver&;
+
+    /// Set the options of the reactive transport solver.
+    auto setOptions(ReactiveTransportOptions const& options) -> void;
+
+    /// Set the mesh for the numerical solution of the transport problem.
+    auto setMesh(Mesh const& mesh) -> void;
+
+    /// Set the velocity of the fluid (in m/s).
+    auto setVelocity(double val) -> void;
+
+    /// Set the diffusion coefficient of the fluid species (in m²/s).
+    auto setDiffusionCoeff(double val) -> void;
+
+    /// Set the chemical state on the left boundary, whose fluid species enter the domain.
+    auto setBoundaryState(ChemicalState const& state) -> void;
+
+    /// Set the time step (in s).
+    auto setTimeStep(double val) -> void;
+
+    /// Return the chemical system of the reactive transport problem.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Return the mesh of the reactive transport problem.
+    auto mesh() const -> Mesh const&;
+
+    /// Return the indices of the species in fluid phases, whose amounts are transported.
+    auto indicesFluidSpecies() const -> Indices const&;
+
+    /// Initialize the reactive transport solver before method @ref step is executed.
+    /// This must be called again after the mesh, diffusion coefficient or time step change.
+    auto initialize() -> void;
+
+    /// Step the reactive transport solver.
+    /// @param[in,out] field The chemical states on the cells of the mesh
+    auto step(ChemicalField& field) -> ReactiveTransportResult;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
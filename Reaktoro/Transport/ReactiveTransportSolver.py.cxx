@@ -0,0 +1,72 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Transport/ReactiveTransportSolver.hpp>
+using namespace Reaktoro;
+
+void exportReactiveTransportSolver(py::module& m)
+{
+    py::class_<ChemicalField>(m, "ChemicalField")
+        .def(py::init<Index, ChemicalSystem const&>())
+        .def(py::init<Index, ChemicalState const&>())
+        .def("size", &ChemicalField::size, "Return the number of cells in the chemical field.")
+        .def("set", &ChemicalField::set, "Set the chemical state on every cell.")
+        .def("temperature", &ChemicalField::temperature, "Write the temperatures on the cells into a vector (in K).")
+        .def("pressure", &ChemicalField::pressure, "Write the pressures on the cells into a vector (in Pa).")
+        .def("__len__", &ChemicalField::size)
+        .def("__getitem__", [](ChemicalField& self, Index i) -> ChemicalState& { return self[i]; }, return_internal_ref)
+        .def("__setitem__", [](ChemicalField& self, Index i, ChemicalState const& state) { self[i] = state; })
+        ;
+
+    py::class_<ReactiveTransportOptions>(m, "ReactiveTransportOptions")
+        .def(py::init<>())
+        .def_readwrite("equilibrium", &ReactiveTransportOptions::equilibrium)
+        .def_readwrite("smart_equilibrium", &ReactiveTransportOptions::smart_equilibrium)
+        .def_readwrite("kinetics", &ReactiveTransportOptions::kinetics)
+        .def_readwrite("use_kinetics", &ReactiveTransportOptions::use_kinetics)
+        .def_readwrite("use_smart_equilibrium", &ReactiveTransportOptions::use_smart_equilibrium)
+        .def_readwrite("threads", &ReactiveTransportOptions::threads)
+        ;
+
+    py::class_<ReactiveTransportResult>(m, "ReactiveTransportResult")
+        .def(py::init<>())
+        .def_readwrite("failures", &ReactiveTransportResult::failures, "The number of cells whose reaction calculation failed.")
+        .def_readwrite("predictions", &ReactiveTransportResult::predictions, "The number of cells whose chemical equilibrium state was predicted with SmartEquilibriumSolver.")
+        .def_readwrite("time_transport", &ReactiveTransportResult::time_transport, "The wall time spent in the transport calculation (in s).")
+        .def_readwrite("time_reaction", &ReactiveTransportResult::time_reaction, "The wall time spent in the reaction calculations on the cells (in s).")
+        ;
+
+    py::class_<ReactiveTransportSolver>(m, "ReactiveTransportSolver")
+        .def(py::init<ChemicalSystem const&>())
+        .def("setOptions", &ReactiveTransportSolver::setOptions, "Set the options of the reactive transport solver.")
+        .def("setMesh", &ReactiveTransportSolver::setMesh, "Set the mesh for the numerical solution of the transport problem.")
+        .def("setVelocity", &ReactiveTransportSolver::setVelocity, "Set the velocity of the fluid (in m/s).")
+        .def("setDiffusionCoeff", &ReactiveTransportSolver::setDiffusionCoeff, "Set the diffusion coefficient of the fluid species (in m²/s).")
+        .def("setBoundaryState", &ReactiveTransportSolver::setBoundaryState, "Set the chemical state on the left boundary, whose fluid species enter the domain.")
+        .def("setTimeStep", &ReactiveTransportSolver::setTimeStep, "Set the time step (in s).")
+        .def("system", &ReactiveTransportSolver::system, return_internal_ref, "Return the chemical system of the reactive transport problem.")
+        .def("mesh", &ReactiveTransportSolver::mesh, return_internal_ref, "Return the mesh of the reactive transport problem.")
+        .def("indicesFluidSpecies", &ReactiveTransportSolver::indicesFluidSpecies, return_internal_ref, "Return the indices of the species in fluid phases, whose amounts are transported.")
+        .def("initialize", &ReactiveTransportSolver::initialize, "Initialize the reactive transport solver before method step is executed.")
+        .def("step", &ReactiveTransportSolver::step, "Step the reactive transport solver.")
+        ;
+}
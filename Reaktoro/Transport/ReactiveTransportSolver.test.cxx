@@ -0,0 +1,157 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Database.hpp>
+#include <Reaktoro/Core/Phases.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Transport/ReactiveTransportSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ReactiveTransportSolver", "[ReactiveTransportSolver]")
+{
+    const auto db = Database({
+        Species("H2O"     ).withStandardGibbsEnergy( -237181.72),
+        Species("H+"      ).withStandardGibbsEnergy(       0.00),
+        Species("OH-"     ).withStandardGibbsEnergy( -157297.48),
+        Species("H2"      ).withStandardGibbsEnergy(   17723.42),
+        Species("O2"      ).withStandardGibbsEnergy(   16543.54),
+        Species("Cl-"     ).withStandardGibbsEnergy( -131289.74),
+        Species("HCl"     ).withStandardGibbsEnergy( -127235.44),
+        Species("Ca++"    ).withStandardGibbsEnergy( -552790.08),
+        Species("CO2"     ).withStandardGibbsEnergy( -385974.00),
+        Species("HCO3-"   ).withStandardGibbsEnergy( -586939.89),
+        Species("CO3--"   ).withStandardGibbsEnergy( -527983.14),
+        Species("CaCl2"   ).withStandardGibbsEnergy( -811696.00),
+        Species("CaCO3"   ).withStandardGibbsEnergy(-1099764.40),
+        Species("CaCO3(s)").withStandardGibbsEnergy(-1129177.92).withName("Calcite"),
+    });
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O C Ca Cl")) );
+    phases.add( MineralPhase("Calcite") );
+
+    ChemicalSystem system(phases);
+
+    const auto icalcite = system.species().index("Calcite");
+
+    EquilibriumOptions eqoptions;
+    eqoptions.hessian = GibbsHessian::Exact;
+    eqoptions.optima.backtracksearch.apply_min_max_fix_and_accept = true;
+
+    EquilibriumSolver solver(system);
+    solver.setOptions(eqoptions);
+
+    ChemicalState initial(system);
+    initial.setTemperature(60.0, "celsius");
+    initial.setPressure(100.0, "bar");
+    initial.setSpeciesAmount("H2O", 55.0, "mol");
+    initial.setSpeciesAmount("Calcite", 1.0, "mol");
+
+    REQUIRE( solver.solve(initial).succeeded() );
+
+    ChemicalState boundary(system);
+    boundary.setTemperature(60.0, "celsius");
+    boundary.setPressure(100.0, "bar");
+    boundary.setSpeciesAmount("H2O", 55.0, "mol");
+    boundary.setSpeciesAmount("HCl", 0.1, "mol");
+
+    REQUIRE( solver.solve(boundary).succeeded() );
+
+    const auto num_cells = 10;
+    const auto num_steps = 5;
+
+    ReactiveTransportOptions options;
+    options.equilibrium = eqoptions;
+
+    // Return the chemical field after a few steps using given number of threads
+    auto simulate = [&](Index threads)
+    {
+        options.threads = threads;
+
+        ReactiveTransportSolver rtsolver(system);
+        rtsolver.setOptions(options);
+        rtsolver.setMesh(Mesh(num_cells, 0.0, 1.0));
+        rtsolver.setVelocity(1.0e-5);
+        rtsolver.setDiffusionCoeff(1.0e-9);
+        rtsolver.setTimeStep(5000.0);
+        rtsolver.setBoundaryState(boundary);
+        rtsolver.initialize();
+
+        CHECK( rtsolver.indicesFluidSpecies().size() == system.species().size() - 1 );
+        CHECK( !contains(rtsolver.indicesFluidSpecies(), icalcite) );
+
+        ChemicalField field(num_cells, initial);
+
+        for(auto i = 0; i < num_steps; ++i)
+        {
+            const auto result = rtsolver.step(field);
+            CHECK( result.failures == 0 );
+            if(!options.use_smart_equilibrium)
+                CHECK( result.predictions == 0 );
+            else if(i > 0)
+                CHECK( result.predictions > 0 ); // the cells not yet reached by the acidic water keep states learned in previous steps
+        }
+
+        return field;
+    };
+
+    const auto field1 = simulate(1);
+    const auto field4 = simulate(4);
+
+    // Calcite dissolves near the left boundary, where acidic water enters the domain
+    CHECK( field1[0].speciesAmount(icalcite) < field1[num_cells - 1].speciesAmount(icalcite) );
+
+    // The results do not depend on the number of threads
+    for(auto icell = 0; icell < num_cells; ++icell)
+        CHECK( field1[icell].speciesAmounts().isApprox(field4[icell].speciesAmounts()) );
+
+    // Nor do they depend on memoization, which the threads may not rely on for safe concurrent model evaluation
+    Memoization::disable();
+    const auto field4u = simulate(4);
+    Memoization::enable();
+
+    for(auto icell = 0; icell < num_cells; ++icell)
+        CHECK( field1[icell].speciesAmounts().isApprox(field4u[icell].speciesAmounts()) );
+
+    // Smart equilibrium calculations predict most cells after the first step, with results close to those of conventional ones
+    options.use_smart_equilibrium = true;
+    options.smart_equilibrium.learning = eqoptions;
+    const auto fieldsmart = simulate(1);
+    options.use_smart_equilibrium = false;
+
+    for(auto icell = 0; icell < num_cells; ++icell)
+    {
+        CHECK( fieldsmart[icell].speciesAmounts().isApprox(field1[icell].speciesAmounts(), 1e-3) );
+        CHECK( fieldsmart[icell].speciesAmount(icalcite) == Approx(field1[icell].speciesAmount(icalcite)).epsilon(1e-3) );
+    }
+
+    // Chemical kinetics and smart equilibrium calculations cannot be combined
+    options.use_kinetics = true;
+    options.use_smart_equilibrium = true;
+
+    ReactiveTransportSolver rtsolver(system);
+    CHECK_THROWS( rtsolver.setOptions(options) );
+}
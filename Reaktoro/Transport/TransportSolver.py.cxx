@@ -0,0 +1,50 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+void exportTransportSolver(py::module& m)
+{
+    py::class_<Mesh>(m, "Mesh")
+        .def(py::init<>())
+        .def(py::init<Index, double, double>(), py::arg("num_cells"), py::arg("xl") = 0.0, py::arg("xr") = 1.0)
+        .def("setDiscretization", &Mesh::setDiscretization, "Set the number of cells and the boundary coordinates of the mesh (in m).", py::arg("num_cells"), py::arg("xl") = 0.0, py::arg("xr") = 1.0)
+        .def("numCells", &Mesh::numCells, "Return the number of cells in the mesh.")
+        .def("xl", &Mesh::xl, "Return the x-coordinate of the left boundary (in m).")
+        .def("xr", &Mesh::xr, "Return the x-coordinate of the right boundary (in m).")
+        .def("dx", &Mesh::dx, "Return the length of the cells (in m).")
+        .def("xcells", &Mesh::xcells, "Return the x-coordinates of the centers of the cells (in m).")
+        ;
+
+    py::class_<TransportSolver>(m, "TransportSolver")
+        .def(py::init<>())
+        .def("setMesh", &TransportSolver::setMesh, "Set the mesh for the numerical solution of the transport problem.")
+        .def("setVelocity", &TransportSolver::setVelocity, "Set the velocity for the transport problem (in m/s).")
+        .def("setDiffusionCoeff", &TransportSolver::setDiffusionCoeff, "Set the diffusion coefficient for the transport problem (in m²/s).")
+        .def("setBoundaryValue", &TransportSolver::setBoundaryValue, "Set the value of the transported quantity on the left boundary.")
+        .def("setTimeStep", &TransportSolver::setTimeStep, "Set the time step for the numerical solution of the transport problem (in s).")
+        .def("mesh", &TransportSolver::mesh, return_internal_ref, "Return the mesh.")
+        .def("initialize", &TransportSolver::initialize, "Initialize the transport solver before method step is executed.")
+        .def("step", py::overload_cast<VectorXdRef, VectorXdConstRef>(&TransportSolver::step), "Step the transport solver with given source rates.", py::arg("u"), py::arg("q"))
+        .def("step", py::overload_cast<VectorXdRef>(&TransportSolver::step), "Step the transport solver.", py::arg("u"))
+        ;
+}
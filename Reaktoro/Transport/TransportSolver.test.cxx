@@ -0,0 +1,106 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing TridiagonalMatrix", "[TransportSolver]")
+{
+    const auto n = 6;
+
+    TridiagonalMatrix A(n);
+    for(auto i = 0; i < n; ++i)
+        A.row(i) << -1.0 - 0.1*i, 4.0 + i, -2.0 + 0.2*i;
+
+    const MatrixXd Adense = A;
+
+    CHECK( Adense(0, 0) == 4.0 );
+    CHECK( Adense(0, 1) == -2.0 );
+    CHECK( Adense(n - 1, n - 2) == Approx(-1.0 - 0.1*(n - 1)) );
+
+    const VectorXd d = linspace(1.0, 2.0, n);
+
+    A.factorize();
+
+    VectorXd x(n);
+    A.solve(x, d);
+
+    CHECK( (Adense * x).isApprox(d) );
+
+    x = d;
+    A.solve(x);
+
+    CHECK( (Adense * x).isApprox(d) );
+}
+
+TEST_CASE("Testing TransportSolver", "[TransportSolver]")
+{
+    Mesh mesh(20, 0.0, 1.0);
+
+    CHECK( mesh.numCells() == 20 );
+    CHECK( mesh.dx() == Approx(0.05) );
+    CHECK( mesh.xcells()[0] == Approx(0.025) );
+
+    TransportSolver transport;
+    transport.setMesh(mesh);
+    transport.setTimeStep(0.01);
+
+    WHEN("there is only diffusion")
+    {
+        transport.setDiffusionCoeff(1e-2);
+        transport.setBoundaryValue(0.0);
+        transport.initialize();
+
+        VectorXd u = zeros(mesh.numCells());
+        u[10] = 1.0;
+
+        transport.step(u);
+
+        CHECK( u.minCoeff() >= 0.0 );
+        CHECK( u[10] < 1.0 );
+        CHECK( u[9] == Approx(u[11]) );
+        CHECK( u.sum() == Approx(1.0).epsilon(1e-3) );
+    }
+
+    WHEN("there is only advection with a constant value on the left boundary")
+    {
+        transport.setVelocity(1.0);
+        transport.setBoundaryValue(1.0);
+        transport.initialize();
+
+        VectorXd u = zeros(mesh.numCells());
+
+        for(auto i = 0; i < 400; ++i)
+            transport.step(u);
+
+        CHECK( (u.array() - 1.0).abs().maxCoeff() < 1e-6 );
+    }
+
+    WHEN("the Courant number is larger than one")
+    {
+        transport.setVelocity(10.0);
+        transport.initialize();
+
+        VectorXd u = zeros(mesh.numCells());
+
+        CHECK_THROWS( transport.step(u) );
+    }
+}
@@ -19,10 +19,9 @@
 
 // C++ includes
 #include <cmath>
-using std::log;
-using std::pow;
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 
@@ -147,12 +146,43 @@ const double E[] = { 0.3, 0.3 };
 template<typename T> auto pow2(T const& x) { return x*x; }
 template<typename T> auto pow3(T const& x) { return x*x*x; }
 
-} // namespace
+/// The largest integer exponent of delta in the residual terms.
+const int max_d = 15;
 
-auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
+/// The largest integer exponent of tau in the residual terms 8 to 54.
+const int max_t = 50;
+
+/// The largest exponent c of delta in the exponential factors of the residual terms 8 to 51.
+const int max_c = 6;
+
+/// Calculate the Helmholtz free energy state of water with a scalar type that is either `real` or `double`.
+template<typename Scalar>
+auto waterHelmholtzPropsWagnerPrussImpl(Scalar const& T, Scalar const& D) -> WaterHelmholtzProps
 {
-    const auto tau   = waterCriticalTemperature/T;
-    const auto delta = D/waterCriticalDensity;
+    // Bring the standard functions into scope for `double` (those for `real` are found by argument-dependent lookup)
+    using std::exp;
+    using std::log;
+    using std::pow;
+
+    const Scalar tau   = waterCriticalTemperature/T;
+    const Scalar delta = D/waterCriticalDensity;
+
+    // The integer powers of delta and tau in the residual terms (all exponents are integers except those of tau in terms 1 to 7)
+    Scalar deltapow[max_d + 1];
+    Scalar taupow[max_t + 1];
+
+    deltapow[0] = 1.0;
+    for(int k = 1; k <= max_d; ++k)
+        deltapow[k] = deltapow[k - 1] * delta;
+
+    taupow[0] = 1.0;
+    for(int k = 1; k <= max_t; ++k)
+        taupow[k] = taupow[k - 1] * tau;
+
+    // The factors exp(-delta^c) of the residual terms 8 to 51, which take only a few distinct values of c
+    Scalar expdc[max_c + 1];
+    for(int k = 0; k <= max_c; ++k)
+        expdc[k] = exp(-deltapow[k]);
 
     auto phio     =  log(delta) + no[1] + no[2]*tau + no[3]*log(tau);
     auto phio_d   =  1.0/delta;
@@ -177,20 +207,20 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
         phio_ttt += no[i] * ee * (1 + ee) * pow3((gammao[j]/(ee - 1)));
     }
 
-    real phir = {};
-    real phir_d = {};
-    real phir_t = {};
-    real phir_dd = {};
-    real phir_tt = {};
-    real phir_dt = {};
-    real phir_ddd = {};
-    real phir_ttt = {};
-    real phir_dtt = {};
-    real phir_ddt = {};
+    Scalar phir = {};
+    Scalar phir_d = {};
+    Scalar phir_t = {};
+    Scalar phir_dd = {};
+    Scalar phir_tt = {};
+    Scalar phir_dt = {};
+    Scalar phir_ddd = {};
+    Scalar phir_ttt = {};
+    Scalar phir_dtt = {};
+    Scalar phir_ddt = {};
 
     for(int i = 1; i <= 7; ++i)
     {
-        const auto A     = n[i]*pow(delta, d[i])*pow(tau, t[i]);
+        const auto A     = n[i]*deltapow[static_cast<int>(d[i])]*pow(tau, t[i]);
         const auto A_d   = d[i]/delta * A;
         const auto A_t   = t[i]/tau * A;
         const auto A_dd  = (d[i] - 1)/delta * A_d;
@@ -215,9 +245,9 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
 
     for(int i = 8; i <= 51; ++i)
     {
-        const auto dci = pow(delta, c[i]);
+        const auto dci = deltapow[static_cast<int>(c[i])];
 
-        const auto B     =  n[i]*pow(delta, d[i])*pow(tau, t[i])*exp(-dci);
+        const auto B     =  n[i]*deltapow[static_cast<int>(d[i])]*taupow[static_cast<int>(t[i])]*expdc[static_cast<int>(c[i])];
         const auto B_d   = (d[i] - c[i]*dci)/delta * B;
         const auto B_t   =  t[i]/tau * B;
         const auto B_dd  = (d[i] - c[i]*dci - 1)/delta * B_d - dci*pow2(c[i]/delta) * B;
@@ -250,7 +280,7 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
         const auto aux2d = (d[i]/pow2(delta) + 2*alpha[j]);
         const auto aux2t = (t[i]/pow2(tau) + 2*beta[j]);
 
-        const auto C     = n[i]*pow(delta, d[i])*pow(tau, t[i])*exp(-alpha[j]*pow2(delta - epsilon[j]) - beta[j]*pow2(tau - gamma[j]));
+        const auto C     = n[i]*deltapow[static_cast<int>(d[i])]*taupow[static_cast<int>(t[i])]*exp(-alpha[j]*pow2(delta - epsilon[j]) - beta[j]*pow2(tau - gamma[j]));
         const auto C_d   = aux1d * C;
         const auto C_t   = aux1t * C;
         const auto C_dd  = aux1d * C_d - aux2d * C;
@@ -389,4 +419,22 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
     return res;
 }
 
+} // namespace
+
+auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
+{
+    return waterHelmholtzPropsWagnerPrussImpl(T, D);
+}
+
+auto waterHelmholtzPropsWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef D) -> Vec<WaterHelmholtzProps>
+{
+    errorif(T.size() != D.size(), "Expecting arrays of temperatures and densities with the same size in waterHelmholtzPropsWagnerPrussBatch.");
+
+    Vec<WaterHelmholtzProps> res;
+    res.reserve(T.size());
+    for(Index i = 0; i < T.size(); ++i)
+        res.push_back(waterHelmholtzPropsWagnerPrussImpl(T[i], D[i]));
+    return res;
+}
+
 } // namespace Reaktoro
@@ -18,7 +18,9 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
 
 namespace Reaktoro {
 
@@ -32,4 +34,13 @@ struct WaterHelmholtzProps;
 /// @see WaterHelmholtzProps
 auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps;
 
+/// Calculate the Helmholtz free energy states of water at many temperature-density points using the Wagner and Pruss (1995) equation of state
+/// The calculations are performed in double precision, without the overhead of automatic differentiation, so
+/// the returned states carry no derivatives with respect to temperature or density seeded by the caller.
+/// @param T The temperatures of water (in units of K)
+/// @param D The densities of water (in units of kg/m3)
+/// @return The Helmholtz free energy states of water, one per temperature-density point
+/// @see WaterHelmholtzProps
+auto waterHelmholtzPropsWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef D) -> Vec<WaterHelmholtzProps>;
+
 } // namespace Reaktoro
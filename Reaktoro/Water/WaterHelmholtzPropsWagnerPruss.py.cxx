@@ -26,4 +26,5 @@ using namespace Reaktoro;
 void exportWaterHelmholtzPropsWagnerPruss(py::module& m)
 {
     m.def("waterHelmholtzPropsWagnerPruss", waterHelmholtzPropsWagnerPruss);
+    m.def("waterHelmholtzPropsWagnerPrussBatch", waterHelmholtzPropsWagnerPrussBatch);
 }
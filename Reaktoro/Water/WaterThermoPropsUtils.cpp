@@ -24,6 +24,7 @@ using std::sqrt;
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Common/Tracing.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsHGK.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
@@ -68,6 +69,7 @@ auto createMemoizedWaterThermoPropsFnWagnerPrussInterp()
 
 auto waterThermoPropsHGK(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
+    RKT_TRACE_COUNT("WaterThermoProps::evaluations", 1);
     const real D = waterDensityHGK(T, P, som);
     const WaterHelmholtzProps whp = waterHelmholtzPropsHGK(T, D);
     return waterThermoProps(T, P, whp);
@@ -81,11 +83,24 @@ auto waterThermoPropsHGKMemoized(real const& T, real const& P, StateOfMatter som
 
 auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
+    RKT_TRACE_COUNT("WaterThermoProps::evaluations", 1);
     const real D = waterDensityWagnerPruss(T, P, som);
     const WaterHelmholtzProps whp = waterHelmholtzPropsWagnerPruss(T, D);
     return waterThermoProps(T, P, whp);
 }
 
+auto waterThermoPropsWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter som) -> Vec<WaterThermoProps>
+{
+    RKT_TRACE_COUNT("WaterThermoProps::evaluations", T.size());
+    const ArrayXd D = waterDensityWagnerPrussBatch(T, P, som);
+    const auto whps = waterHelmholtzPropsWagnerPrussBatch(T, D);
+    Vec<WaterThermoProps> res;
+    res.reserve(T.size());
+    for(Index i = 0; i < T.size(); ++i)
+        res.push_back(waterThermoProps(T[i], P[i], whps[i]));
+    return res;
+}
+
 auto waterThermoPropsWagnerPrussMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
     static thread_local auto fn = createMemoizedWaterThermoPropsFnWagnerPruss();
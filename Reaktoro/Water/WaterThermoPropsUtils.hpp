@@ -18,7 +18,9 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
 namespace Reaktoro {
@@ -56,6 +58,17 @@ auto waterThermoPropsHGKMemoized(real const& T, real const& P, StateOfMatter som
 /// @see WaterThermoProps
 auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
 
+/// Calculate the thermodynamic properties of water at many temperature-pressure points using the Wagner and Pruss (1995) equation of state.
+/// This is intended for calculations over many distinct temperatures and pressures (e.g., the cells of a transport
+/// simulation), in which the properties are computed in one pass in double precision. Thus, unlike
+/// @ref waterThermoPropsWagnerPruss, no derivatives with respect to temperature and pressure are propagated.
+/// @param T The temperatures of water (in units of K)
+/// @param P The pressures of water (in units of Pa)
+/// @param som The desired state of matter for water (the actual state of matter may end up being different!)
+/// @return The thermodynamic states of water, one per temperature-pressure point
+/// @see WaterThermoProps
+auto waterThermoPropsWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter som) -> Vec<WaterThermoProps>;
+
 /// Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.
 /// @note This function will skip the computation if given arguments are the same as
 /// in its last invocation. The cached result will be returned, thus improving performance.
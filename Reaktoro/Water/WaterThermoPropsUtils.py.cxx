@@ -29,6 +29,7 @@ void exportWaterThermoPropsUtils(py::module& m)
     m.def("waterThermoPropsHGK", waterThermoPropsHGK, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
     m.def("waterThermoPropsWagnerPruss", waterThermoPropsWagnerPruss, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
     m.def("waterThermoPropsHGKMemoized", waterThermoPropsHGKMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
+    m.def("waterThermoPropsWagnerPrussBatch", waterThermoPropsWagnerPrussBatch, "Calculate the thermodynamic properties of water at many temperature-pressure points using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussMemoized", waterThermoPropsWagnerPrussMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussInterpMemoized", waterThermoPropsWagnerPrussInterpMemoized, "Calculate the thermodynamic properties of water using interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoProps", waterThermoProps, "Calculate the thermodynamic properties of water.");
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <cmath>
+#include <numeric>
 using std::abs;
 using std::exp;
 using std::pow;
@@ -33,40 +34,51 @@ using std::pow;
 #include <Reaktoro/Water/WaterInterpolation.hpp>
 
 namespace Reaktoro {
+namespace {
 
-template<typename HelmholtsModel>
-auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, StateOfMatter stateofmatter) -> real
+/// The maximum number of Newton iterations in the calculation of water density.
+const auto waterdensity_max_iters = 100;
+
+/// Perform a Newton iteration in the calculation of water density `D` at pressure `P` given the
+/// derivatives of the Helmholtz free energy of water with respect to density at `D`.
+/// @return True if the residual of the density equation at `D` (before the update) is within tolerance
+template<typename Scalar>
+auto waterDensityNewtonStep(Scalar& D, Scalar const& P, Scalar const& AD, Scalar const& ADD, Scalar const& ADDD) -> bool
 {
-    // Auxiliary constants for the Newton's iterations
-    const auto max_iters = 100;
+    using std::abs;
+
     const auto tolerance = 1.0e-06;
 
-    // Determine an adequate initial guess for density based on the desired physical state of water
-    real D = waterDensityWagnerPrussInterp(T, P, stateofmatter);
+    const auto F = D*D*AD/P - 1;
+    const auto FD = (2*D*AD + D*D*ADD)/P;
+    const auto FDD = (2*AD + 2*D*ADD + 2*D*ADD + D*D*ADDD)/P;
 
-    for(int i = 1; i <= max_iters; ++i)
-    {
-        WaterHelmholtzProps h = model(T, D);
+    const auto f = 0.5 * F*F;
+    const auto g = F*FD;
+    const auto H = FD*FD + F*FDD;
 
-        const auto AD = h.helmholtzD;
-        const auto ADD = h.helmholtzDD;
-        const auto ADDD = h.helmholtzDDD;
+    if(D > g/H)
+        D -= g/H;
+    else if(D > F/FD)
+        D -= F/FD;
+    else D *= 0.1;
 
-        const auto F = D*D*AD/P - 1;
-        const auto FD = (2*D*AD + D*D*ADD)/P;
-        const auto FDD = (2*AD + 2*D*ADD + 2*D*ADD + D*D*ADDD)/P;
+    return abs(F) < tolerance || abs(g) < tolerance;
+}
 
-        const auto f = 0.5 * F*F;
-        const auto g = F*FD;
-        const auto H = FD*FD + F*FDD;
+} // namespace
 
-        if(D > g/H)
-            D -= g/H;
-        else if(D > F/FD)
-            D -= F/FD;
-        else D *= 0.1;
+template<typename HelmholtsModel>
+auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, StateOfMatter stateofmatter) -> real
+{
+    // Determine an adequate initial guess for density based on the desired physical state of water
+    real D = waterDensityWagnerPrussInterp(T, P, stateofmatter);
 
-        if(abs(F) < tolerance || abs(g) < tolerance)
+    for(int i = 1; i <= waterdensity_max_iters; ++i)
+    {
+        WaterHelmholtzProps h = model(T, D);
+
+        if(waterDensityNewtonStep(D, P, h.helmholtzD, h.helmholtzDD, h.helmholtzDDD))
             return D;
     }
 
@@ -105,6 +117,46 @@ auto waterVaporDensityWagnerPruss(real const& T, real const& P) -> real
     return waterDensityWagnerPruss(T, P, StateOfMatter::Gas);
 }
 
+auto waterDensityWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter stateofmatter) -> ArrayXd
+{
+    errorif(T.size() != P.size(), "Expecting arrays of temperatures and pressures with the same size in waterDensityWagnerPrussBatch.");
+
+    const auto size = T.size();
+
+    // Determine an adequate initial guess for density at every point based on the desired physical state of water
+    ArrayXd D(size);
+    for(Index k = 0; k < size; ++k)
+        D[k] = waterDensityWagnerPrussInterp(T[k], P[k], stateofmatter).val();
+
+    // The indices of the points whose density has not yet converged
+    Indices active(size);
+    std::iota(active.begin(), active.end(), 0);
+
+    ArrayXd Ta, Da;
+
+    // Perform the Newton iterations at all points not yet converged with a single evaluation of the Helmholtz free energy per iteration
+    for(int i = 1; i <= waterdensity_max_iters && !active.empty(); ++i)
+    {
+        Ta = T(active);
+        Da = D(active);
+
+        const auto h = waterHelmholtzPropsWagnerPrussBatch(Ta, Da);
+
+        Indices remaining;
+        for(Index k = 0; k < active.size(); ++k)
+        {
+            const auto j = active[k];
+            if(!waterDensityNewtonStep(D[j], P[j], h[k].helmholtzD.val(), h[k].helmholtzDD.val(), h[k].helmholtzDDD.val()))
+                remaining.push_back(j);
+        }
+        active = std::move(remaining);
+    }
+
+    errorif(!active.empty(), "Unable to calculate the density of water because the calculations did not converge at temperature ", T[active.front()], " K and pressure ", P[active.front()], " Pa.");
+
+    return D;
+}
+
 template<typename HelmholtzModel>
 auto waterPressure(real const& T, real const& D, HelmholtzModel const& model) -> real
 {
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
@@ -61,6 +62,15 @@ auto waterVaporDensityHGK(real const& T, real const& P) -> real;
 /// @return The density of water (in kg/m3)
 auto waterVaporDensityWagnerPruss(real const& T, real const& P) -> real;
 
+/// Calculate the densities of water at many temperature-pressure points using the Wagner and Pruss (1995) equation of state
+/// The Newton iterations of all points are performed together, in double precision, with one batch evaluation
+/// of the Helmholtz free energy of water per iteration over the points that have not yet converged.
+/// @param T The temperatures of water (in K)
+/// @param P The pressures of water (in Pa)
+/// @param stateofmatter The state of matter of water
+/// @return The densities of water (in kg/m3), one per temperature-pressure point
+auto waterDensityWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter stateofmatter) -> ArrayXd;
+
 /// Calculate the pressure of water using the Haar--Gallagher--Kell (1984) equation of state
 /// @param T The temperature of water (in K)
 /// @param D The density of water (in kg/m3)
@@ -26,6 +26,7 @@ void exportWaterUtils(py::module& m)
 {
     m.def("waterDensityHGK", waterDensityHGK);
     m.def("waterDensityWagnerPruss", waterDensityWagnerPruss);
+    m.def("waterDensityWagnerPrussBatch", waterDensityWagnerPrussBatch);
     m.def("waterLiquidDensityHGK", waterLiquidDensityHGK);
     m.def("waterLiquidDensityWagnerPruss", waterLiquidDensityWagnerPruss);
     m.def("waterVaporDensityHGK", waterVaporDensityHGK);
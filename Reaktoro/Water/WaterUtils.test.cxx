@@ -19,6 +19,10 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Water/WaterHelmholtzProps.hpp>
+#include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 #include <Reaktoro/Water/WaterUtils.hpp>
 using namespace Reaktoro;
 
@@ -41,3 +45,90 @@ TEST_CASE("Testing water utility methods", "[WaterUtils]")
     CHECK( waterDensityWagnerPruss(T + 400, P, StateOfMatter::Liquid) == Approx(0.322301) );
     CHECK( waterDensityWagnerPruss(T + 500, P, StateOfMatter::Liquid) == Approx(0.280463) );
 }
+
+TEST_CASE("Testing water utility methods for many temperature-pressure points", "[WaterUtils]")
+{
+    const ArrayXd T = ArrayXd::LinSpaced(12, 273.15, 773.15);
+    const ArrayXd P = ArrayXd::LinSpaced(12, 1e5, 500e5);
+
+    for(auto som : { StateOfMatter::Liquid, StateOfMatter::Gas })
+    {
+        const ArrayXd D = waterDensityWagnerPrussBatch(T, P, som);
+
+        REQUIRE( D.size() == T.size() );
+
+        for(auto i = 0; i < T.size(); ++i)
+            CHECK( D[i] == Approx(waterDensityWagnerPruss(T[i], P[i], som).val()) );
+    }
+
+    CHECK_THROWS( waterDensityWagnerPrussBatch(T, P.head(3), StateOfMatter::Liquid) );
+}
+
+TEST_CASE("Testing batch water properties against their scalar counterparts", "[WaterUtils]")
+{
+    // Temperatures below the critical point with pressures away from and near the saturation curve of water
+    const Vec<double> temperatures = { 298.15, 373.15, 473.15, 573.15, 623.15, 643.15 };
+    const Vec<double> psatfactors = { 0.5, 0.999, 1.001, 2.0 };
+
+    Vec<double> Tvals, Pvals;
+    for(auto T : temperatures)
+    {
+        const auto Psat = waterSaturationPressureWagnerPruss(T).val();
+        for(auto factor : psatfactors)
+        {
+            Tvals.push_back(T);
+            Pvals.push_back(factor * Psat);
+        }
+    }
+
+    const ArrayXd T = ArrayXd::Map(Tvals.data(), Tvals.size());
+    const ArrayXd P = ArrayXd::Map(Pvals.data(), Pvals.size());
+
+    for(auto som : { StateOfMatter::Liquid, StateOfMatter::Gas })
+    {
+        const auto wtps = waterThermoPropsWagnerPrussBatch(T, P, som);
+
+        REQUIRE( wtps.size() == T.size() );
+
+        for(auto i = 0; i < T.size(); ++i)
+        {
+            INFO("T = " << T[i] << " K, P = " << P[i] << " Pa");
+
+            const auto expected = waterThermoPropsWagnerPruss(T[i], P[i], som);
+
+            CHECK( wtps[i].T  == Approx(expected.T.val())  );
+            CHECK( wtps[i].D  == Approx(expected.D.val())  );
+            CHECK( wtps[i].V  == Approx(expected.V.val())  );
+            CHECK( wtps[i].S  == Approx(expected.S.val())  );
+            CHECK( wtps[i].H  == Approx(expected.H.val())  );
+            CHECK( wtps[i].G  == Approx(expected.G.val())  );
+            CHECK( wtps[i].Cp == Approx(expected.Cp.val()) );
+            CHECK( wtps[i].Cv == Approx(expected.Cv.val()) );
+            CHECK( wtps[i].DT == Approx(expected.DT.val()) );
+            CHECK( wtps[i].DP == Approx(expected.DP.val()) );
+        }
+
+        const ArrayXd D = waterDensityWagnerPrussBatch(T, P, som);
+        const auto whps = waterHelmholtzPropsWagnerPrussBatch(T, D);
+
+        REQUIRE( whps.size() == T.size() );
+
+        for(auto i = 0; i < T.size(); ++i)
+        {
+            INFO("T = " << T[i] << " K, D = " << D[i] << " kg/m3");
+
+            const auto expected = waterHelmholtzPropsWagnerPruss(T[i], D[i]);
+
+            CHECK( whps[i].helmholtz    == Approx(expected.helmholtz.val())    );
+            CHECK( whps[i].helmholtzT   == Approx(expected.helmholtzT.val())   );
+            CHECK( whps[i].helmholtzD   == Approx(expected.helmholtzD.val())   );
+            CHECK( whps[i].helmholtzTT  == Approx(expected.helmholtzTT.val())  );
+            CHECK( whps[i].helmholtzTD  == Approx(expected.helmholtzTD.val())  );
+            CHECK( whps[i].helmholtzDD  == Approx(expected.helmholtzDD.val())  );
+            CHECK( whps[i].helmholtzTTT == Approx(expected.helmholtzTTT.val()) );
+            CHECK( whps[i].helmholtzTTD == Approx(expected.helmholtzTTD.val()) );
+            CHECK( whps[i].helmholtzTDD == Approx(expected.helmholtzTDD.val()) );
+            CHECK( whps[i].helmholtzDDD == Approx(expected.helmholtzDDD.val()) );
+        }
+    }
+}
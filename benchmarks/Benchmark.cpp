@@ -0,0 +1,284 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+
+#ifndef REAKTORO_BENCHMARKS_BUILD_TYPE
+#define REAKTORO_BENCHMARKS_BUILD_TYPE "unknown"
+#endif
+
+//======================================================================
+// Heap allocation counting
+//======================================================================
+
+namespace {
+
+std::atomic<Reaktoro::Index> allocation_counter{0};
+
+} // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    allocation_counter.fetch_add(1, std::memory_order_relaxed);
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+auto operator new[](std::size_t size) -> void*
+{
+    return ::operator new(size);
+}
+
+auto operator delete(void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete[](void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete[](void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+namespace Reaktoro {
+namespace benchmarks {
+namespace {
+
+/// The registered benchmarks, in order of registration.
+auto registry() -> Vec<Pair<String, BenchmarkFn>>&
+{
+    static Vec<Pair<String, BenchmarkFn>> benchmarks;
+    return benchmarks;
+}
+
+/// The statistics of the samples of a benchmark.
+struct BenchmarkStats
+{
+    double median = 0.0;
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double stddev = 0.0;
+};
+
+auto computeStats(Vec<double> samples) -> BenchmarkStats
+{
+    BenchmarkStats stats;
+    if(samples.empty())
+        return stats;
+    std::sort(samples.begin(), samples.end());
+    const auto n = samples.size();
+    stats.median = n % 2 ? samples[n/2] : 0.5 * (samples[n/2 - 1] + samples[n/2]);
+    stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+    stats.min = samples.front();
+    stats.max = samples.back();
+    double sum = 0.0;
+    for(auto x : samples)
+        sum += (x - stats.mean) * (x - stats.mean);
+    stats.stddev = n > 1 ? std::sqrt(sum / (n - 1)) : 0.0;
+    return stats;
+}
+
+/// Return a string with escaped characters so that it can be used as a JSON string.
+auto escapeJson(String const& str) -> String
+{
+    String res;
+    for(auto c : str)
+    {
+        if(c == '"' || c == '\\') res += '\\';
+        res += c;
+    }
+    return res;
+}
+
+/// Return the time per call of a benchmark formatted with a convenient unit.
+auto formatTime(double ns) -> String
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    if(ns < 1e3) ss << ns << " ns";
+    else if(ns < 1e6) ss << ns * 1e-3 << " us";
+    else if(ns < 1e9) ss << ns * 1e-6 << " ms";
+    else ss << ns * 1e-9 << " s";
+    return ss.str();
+}
+
+auto printResult(BenchmarkResult const& res) -> void
+{
+    const auto stats = computeStats(res.samples);
+    std::cout << std::left << std::setw(60) << res.name
+              << std::right << std::setw(14) << formatTime(stats.median)
+              << std::setw(14) << formatTime(stats.min)
+              << std::setw(12) << res.iterations
+              << std::setw(12) << std::fixed << std::setprecision(1) << res.allocations;
+    if(res.items > 0.0 && stats.median > 0.0)
+        std::cout << std::setw(16) << std::setprecision(0) << res.items / (stats.median * 1e-9) << " items/s";
+    std::cout << std::endl;
+}
+
+auto writeJson(std::ostream& out, Vec<BenchmarkResult> const& results) -> void
+{
+    out << std::setprecision(10);
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"library\": \"Reaktoro\",\n";
+    out << "    \"build_type\": \"" << REAKTORO_BENCHMARKS_BUILD_TYPE << "\",\n";
+    out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for(auto i = 0u; i < results.size(); ++i)
+    {
+        auto const& res = results[i];
+        const auto stats = computeStats(res.samples);
+        out << (i ? ",\n" : "\n");
+        out << "    {\n";
+        out << "      \"name\": \"" << escapeJson(res.name) << "\",\n";
+        out << "      \"iterations\": " << res.iterations << ",\n";
+        out << "      \"repetitions\": " << res.samples.size() << ",\n";
+        out << "      \"time_unit\": \"ns\",\n";
+        out << "      \"median\": " << stats.median << ",\n";
+        out << "      \"mean\": " << stats.mean << ",\n";
+        out << "      \"min\": " << stats.min << ",\n";
+        out << "      \"max\": " << stats.max << ",\n";
+        out << "      \"stddev\": " << stats.stddev << ",\n";
+        out << "      \"allocations_per_call\": " << res.allocations;
+        if(res.items > 0.0 && stats.median > 0.0)
+            out << ",\n      \"items_per_second\": " << res.items / (stats.median * 1e-9);
+        out << "\n    }";
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+auto printUsage() -> void
+{
+    std::cout <<
+        "Usage: reaktoro-benchmarks [options]\n"
+        "  --filter <substring>   Run only benchmarks whose names contain the given substring\n"
+        "  --json <file>          Write the results to the given JSON file\n"
+        "  --min-time <seconds>   The minimum duration of each timed sample (default: 0.1)\n"
+        "  --repetitions <n>      The number of timed samples of each benchmark (default: 5)\n"
+        "  --list                 List the names of the benchmarks and exit\n"
+        "  --help                 Show this message and exit\n";
+}
+
+} // namespace
+
+auto numAllocations() -> Index
+{
+    return allocation_counter.load(std::memory_order_relaxed);
+}
+
+auto registerBenchmark(String const& name, BenchmarkFn const& fn) -> bool
+{
+    registry().emplace_back(name, fn);
+    return true;
+}
+
+} // namespace benchmarks
+} // namespace Reaktoro
+
+int main(int argc, char** argv)
+{
+    using namespace Reaktoro;
+    using namespace Reaktoro::benchmarks;
+
+    BenchmarkOptions options;
+    String filter;
+    String jsonfile;
+    bool list = false;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const String arg = argv[i];
+        const auto next = [&]() -> String
+        {
+            errorif(i + 1 >= argc, "Expecting a value after command line argument `", arg, "`.");
+            return argv[++i];
+        };
+        if(arg == "--filter") filter = next();
+        else if(arg == "--json") jsonfile = next();
+        else if(arg == "--min-time") options.min_sample_time = std::stod(next());
+        else if(arg == "--repetitions") options.repetitions = std::stoul(next());
+        else if(arg == "--list") list = true;
+        else if(arg == "--help") { printUsage(); return 0; }
+        else { printUsage(); return 1; }
+    }
+
+    errorif(options.repetitions == 0, "Expecting a positive number of repetitions.");
+
+    Vec<BenchmarkResult> results;
+
+    if(!list)
+        std::cout << std::left << std::setw(60) << "Benchmark"
+                  << std::right << std::setw(14) << "Median"
+                  << std::setw(14) << "Min"
+                  << std::setw(12) << "Iterations"
+                  << std::setw(12) << "Allocs" << std::endl;
+
+    for(auto const& [name, fn] : registry())
+    {
+        if(filter.size() && name.find(filter) == String::npos)
+            continue;
+        if(list)
+        {
+            std::cout << name << std::endl;
+            continue;
+        }
+        Benchmark bench(name, options);
+        fn(bench);
+        if(bench.result().samples.empty()) // the benchmark did not call Benchmark::run
+            continue;
+        printResult(bench.result());
+        results.push_back(bench.result());
+    }
+
+    if(jsonfile.size())
+    {
+        std::ofstream out(jsonfile);
+        errorif(!out, "Could not open file `", jsonfile, "` for writing the benchmark results.");
+        writeJson(out, results);
+    }
+
+    return 0;
+}
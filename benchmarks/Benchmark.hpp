@@ -0,0 +1,155 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+
+// Reaktoro includes
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace benchmarks {
+
+/// Return the number of heap allocations performed so far by this process.
+/// Only allocations through `operator new` are counted (e.g., not those of Eigen, which calls `malloc` directly).
+auto numAllocations() -> Index;
+
+/// The options controlling how the body of a benchmark is timed.
+struct BenchmarkOptions
+{
+    /// The minimum duration of a sample, used to calibrate the number of calls per sample (in s).
+    double min_sample_time = 0.1;
+
+    /// The number of timed samples collected after calibration.
+    Index repetitions = 5;
+};
+
+/// The timing results of a benchmark.
+struct BenchmarkResult
+{
+    /// The name of the benchmark.
+    String name;
+
+    /// The number of calls of the body in each sample.
+    Index iterations = 0;
+
+    /// The wall time per call of the body in each sample (in ns).
+    Vec<double> samples;
+
+    /// The number of heap allocations through `operator new` per call of the body.
+    double allocations = 0.0;
+
+    /// The number of items processed per call of the body (e.g., cells or records), zero if not applicable.
+    double items = 0.0;
+};
+
+/// Used to time the body of a benchmark.
+class Benchmark
+{
+public:
+    /// Construct a Benchmark object with given name and options.
+    Benchmark(String const& name, BenchmarkOptions const& options)
+    : options(options)
+    {
+        res.name = name;
+    }
+
+    /// Set the number of items processed per call of the body, so that a throughput is also reported.
+    auto setItemsPerCall(double items) -> void { res.items = items; }
+
+    /// Time the body of the benchmark.
+    /// The body is called once to warm up, then a number of calls per sample is calibrated so that
+    /// each sample lasts at least BenchmarkOptions::min_sample_time, and finally the samples are timed.
+    template<typename Body>
+    auto run(Body&& body) -> void
+    {
+        body(); // warm up caches and lazily initialized data
+
+        Index iterations = 1;
+        while(true)
+        {
+            const auto begin = time();
+            for(Index i = 0; i < iterations; ++i)
+                body();
+            const auto duration = elapsed(begin);
+            if(duration >= options.min_sample_time || iterations >= (Index(1) << 30))
+                break;
+            const auto factor = duration > 0.0 ? 1.4 * options.min_sample_time / duration : 10.0;
+            iterations = std::max<Index>(iterations + 1, iterations * std::min(factor, 10.0));
+        }
+
+        res.iterations = iterations;
+        res.samples.clear();
+
+        const auto allocations0 = numAllocations();
+        for(Index r = 0; r < options.repetitions; ++r)
+        {
+            const auto begin = time();
+            for(Index i = 0; i < iterations; ++i)
+                body();
+            res.samples.push_back(elapsed(begin) * 1e9 / iterations);
+        }
+        const auto allocations1 = numAllocations();
+
+        res.allocations = double(allocations1 - allocations0) / (iterations * options.repetitions);
+    }
+
+    /// Return the timing results of the benchmark.
+    auto result() const -> BenchmarkResult const& { return res; }
+
+private:
+    /// The options controlling how the body of the benchmark is timed.
+    BenchmarkOptions options;
+
+    /// The timing results of the benchmark.
+    BenchmarkResult res;
+};
+
+/// The function type of a benchmark, which sets up its data and calls Benchmark::run.
+using BenchmarkFn = Fn<void(Benchmark&)>;
+
+/// Register a benchmark with given name (returns true so that it can initialize a static variable).
+auto registerBenchmark(String const& name, BenchmarkFn const& fn) -> bool;
+
+/// Prevent the compiler from optimizing away the computation of a value.
+template<typename T>
+inline auto doNotOptimize(T const& value) -> void
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static void const* volatile sink;
+    sink = &value;
+#endif
+}
+
+} // namespace benchmarks
+} // namespace Reaktoro
+
+#define REAKTORO_BENCHMARK_CONCAT_(a, b) a##b
+#define REAKTORO_BENCHMARK_CONCAT(a, b) REAKTORO_BENCHMARK_CONCAT_(a, b)
+
+/// Define and register a benchmark with given name, whose body receives a `Benchmark& bench` argument.
+#define REAKTORO_BENCHMARK(name) \
+    static auto REAKTORO_BENCHMARK_CONCAT(benchmark_fn_, __LINE__)(Reaktoro::benchmarks::Benchmark& bench) -> void; \
+    static const auto REAKTORO_BENCHMARK_CONCAT(benchmark_registered_, __LINE__) = \
+        Reaktoro::benchmarks::registerBenchmark(name, REAKTORO_BENCHMARK_CONCAT(benchmark_fn_, __LINE__)); \
+    static auto REAKTORO_BENCHMARK_CONCAT(benchmark_fn_, __LINE__)(Reaktoro::benchmarks::Benchmark& bench) -> void
@@ -0,0 +1,288 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+namespace {
+
+/// The aqueous species used to benchmark the aqueous activity models.
+const auto aqueous_species = "H2O H+ OH- Na+ Cl- Ca+2 Mg+2 HCO3- CO3-2 CO2 SO4-2 K+";
+
+/// The aqueous species of a seawater/brine system used to benchmark the Pitzer activity models.
+const auto brine_species = "H2O H+ OH- Na+ K+ Mg+2 Ca+2 Sr+2 Cl- Br- SO4-2 HSO4- HCO3- CO3-2 CO2 MgOH+";
+
+/// The gaseous species used to benchmark the gaseous activity models.
+const auto gaseous_species = "H2O CO2 CH4 N2";
+
+/// Time the evaluation of an activity model for given species at given temperature (in K) and pressure (in Pa).
+auto benchmarkActivityModel(Benchmark& bench, ActivityModelGenerator const& generator, SpeciesList const& species, double T, double P) -> void
+{
+    ActivityModel fn = generator(species);
+
+    ActivityProps props = ActivityProps::create(species.size());
+
+    const ArrayXr x = ArrayXr::Constant(species.size(), 1.0 / species.size());
+
+    bench.run([&] { fn(props, {T, P, x}); doNotOptimize(props); });
+}
+
+/// Time the evaluation of an aqueous activity model at 60 °C and 100 bar.
+auto benchmarkAqueousActivityModel(Benchmark& bench, ActivityModelGenerator const& generator) -> void
+{
+    const auto species = SpeciesList(aqueous_species);
+    benchmarkActivityModel(bench, generator, species, 333.15, 100.0e5);
+}
+
+/// Time the evaluation of a gaseous activity model at 60 °C and 100 bar.
+auto benchmarkGaseousActivityModel(Benchmark& bench, ActivityModelGenerator const& generator, String const& formulas = gaseous_species) -> void
+{
+    const auto species = SpeciesList(formulas);
+    benchmarkActivityModel(bench, generator, species, 333.15, 100.0e5);
+}
+
+/// Time the evaluation of an ion exchange activity model for the exchange species in the PHREEQC database at 60 °C and 100 bar.
+/// The aqueous mixture state exported by an aqueous activity model is made available to the model, as in a system with an aqueous phase,
+/// so that the activity coefficients of the exchange species are also computed.
+auto benchmarkIonExchangeActivityModel(Benchmark& bench, ActivityModelGenerator const& generator) -> void
+{
+    const auto T = 333.15;
+    const auto P = 100.0e5;
+
+    PhreeqcDatabase db("phreeqc.dat");
+
+    const auto aqspecies = db.species().withNames(aqueous_species);
+
+    ActivityProps aqprops = ActivityProps::create(aqspecies.size());
+
+    const ArrayXr xaq = ArrayXr::Constant(aqspecies.size(), 1.0 / aqspecies.size());
+
+    ActivityModel aqfn = ActivityModelDavies()(aqspecies);
+    aqfn(aqprops, {T, P, xaq});
+
+    const auto species = db.species().withAggregateState(AggregateState::IonExchange).withCharge(0.0);
+
+    ActivityModel fn = generator(species);
+
+    ActivityProps props = ActivityProps::create(species.size());
+    props.extra = aqprops.extra;
+
+    const ArrayXr x = ArrayXr::Constant(species.size(), 1.0 / species.size());
+
+    bench.run([&] { fn(props, {T, P, x}); doNotOptimize(props); });
+}
+
+} // namespace
+
+//======================================================================
+// Aqueous activity models
+//======================================================================
+
+REAKTORO_BENCHMARK("ActivityModel/IdealAqueous")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelIdealAqueous());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Davies")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelDavies());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/DebyeHuckel")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelDebyeHuckel());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/DebyeHuckelPHREEQC")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelDebyeHuckelPHREEQC());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/HKF")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelHKF());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Pitzer")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelPitzer());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Pitzer/brine")
+{
+    benchmarkActivityModel(bench, ActivityModelPitzer(), SpeciesList(brine_species), 333.15, 100.0e5);
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Pitzer/brine/3-temperatures")
+{
+    const auto species = SpeciesList(brine_species);
+
+    ActivityModel fn = ActivityModelPitzer()(species);
+
+    ActivityProps props = ActivityProps::create(species.size());
+
+    const ArrayXr x = ArrayXr::Constant(species.size(), 1.0 / species.size());
+
+    bench.setItemsPerCall(3);
+    bench.run([&]
+    {
+        for(auto T : { 298.15, 333.15, 373.15 })
+            fn(props, {T, 100.0e5, x});
+        doNotOptimize(props);
+    });
+}
+
+REAKTORO_BENCHMARK("ActivityModel/PitzerHMW")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelPitzerHMW());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/ExtendedUNIQUAC")
+{
+    const auto params = Params::embedded("ExtendedUNIQUAC.v2024.yaml");
+    const auto species = SpeciesList("H2O CO2 HCO3- CO3-2 Na+ Ba+2 H+ Cl- HSO4- SO4-2 OH-");
+    benchmarkActivityModel(bench, ActivityModelExtendedUNIQUAC(params), species, 333.15, 100.0e5);
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Phreeqc")
+{
+    PhreeqcDatabase db("phreeqc.dat");
+    const auto species = db.species().withNames(aqueous_species);
+    benchmarkActivityModel(bench, ActivityModelPhreeqc(db), species, 333.15, 100.0e5);
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Phreeqc/IonicStrengthPressureCorrection")
+{
+    // The correction needs the aqueous mixture state of a base model, so this times both (see ActivityModel/Phreeqc for the base model alone)
+    PhreeqcDatabase db("phreeqc.dat");
+    const auto species = db.species().withNames(aqueous_species);
+    benchmarkActivityModel(bench, chain(ActivityModelPhreeqc(db), ActivityModelPhreeqcIonicStrengthPressureCorrection()), species, 333.15, 100.0e5);
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Drummond")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelDrummond("CO2"));
+}
+
+REAKTORO_BENCHMARK("ActivityModel/DuanSun")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelDuanSun("CO2"));
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Rumpf")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelRumpf("CO2"));
+}
+
+REAKTORO_BENCHMARK("ActivityModel/Setschenow")
+{
+    benchmarkAqueousActivityModel(bench, ActivityModelSetschenow("CO2", 0.1));
+}
+
+//======================================================================
+// Gaseous activity models
+//======================================================================
+
+REAKTORO_BENCHMARK("ActivityModel/IdealGas")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelIdealGas());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/VanDerWaals")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelVanDerWaals());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/RedlichKwong")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelRedlichKwong());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/SoaveRedlichKwong")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelSoaveRedlichKwong());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/PengRobinson")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelPengRobinson());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/PengRobinsonPhreeqc")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelPengRobinsonPhreeqc());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/PengRobinsonSoreideWhitson")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelPengRobinsonSoreideWhitson());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/SpycherPruessEnnis")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelSpycherPruessEnnis(), "H2O CO2");
+}
+
+REAKTORO_BENCHMARK("ActivityModel/SpycherReed")
+{
+    benchmarkGaseousActivityModel(bench, ActivityModelSpycherReed(), "H2O CO2 CH4");
+}
+
+//======================================================================
+// Solid solution activity models
+//======================================================================
+
+REAKTORO_BENCHMARK("ActivityModel/IdealSolution")
+{
+    const auto species = SpeciesList("CaCO3 MgCO3");
+    benchmarkActivityModel(bench, ActivityModelIdealSolution(StateOfMatter::Solid), species, 333.15, 100.0e5);
+}
+
+REAKTORO_BENCHMARK("ActivityModel/RedlichKister")
+{
+    const auto species = SpeciesList("CaCO3 MgCO3");
+    benchmarkActivityModel(bench, ActivityModelRedlichKister(0.1, 0.2, 0.3), species, 333.15, 100.0e5);
+}
+
+//======================================================================
+// Ion exchange activity models
+//======================================================================
+
+REAKTORO_BENCHMARK("ActivityModel/IdealIonExchange")
+{
+    benchmarkIonExchangeActivityModel(bench, ActivityModelIdealIonExchange());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/IonExchange")
+{
+    benchmarkIonExchangeActivityModel(bench, ActivityModelIonExchange());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/IonExchangeGainesThomas")
+{
+    benchmarkIonExchangeActivityModel(bench, ActivityModelIonExchangeGainesThomas());
+}
+
+REAKTORO_BENCHMARK("ActivityModel/IonExchangeVanselow")
+{
+    benchmarkIonExchangeActivityModel(bench, ActivityModelIonExchangeVanselow());
+}
@@ -0,0 +1,195 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+namespace {
+
+/// Return a chemical system with aqueous, gaseous and mineral phases from phreeqc.dat.
+auto createSystem() -> ChemicalSystem
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O C Na Cl Ca Mg")) );
+    phases.add( GaseousPhase("H2O(g) CO2(g)") );
+    phases.add( MineralPhases("Calcite Dolomite Halite") );
+
+    return ChemicalSystem(phases);
+}
+
+/// Return a chemical state of the system in equilibrium with given temperature (in °C) and amount of NaCl (in mol).
+auto createState(ChemicalSystem const& system, double T, double nNaCl) -> ChemicalState
+{
+    ChemicalState state(system);
+    state.temperature(T, "celsius");
+    state.pressure(10.0, "bar");
+    state.set("H2O", 1.0, "kg");
+    state.set("Na+", nNaCl, "mol");
+    state.set("Cl-", nNaCl, "mol");
+    state.set("CO2(g)", 0.5, "mol");
+    state.set("Calcite", 1.0, "mol");
+    state.set("Dolomite", 0.5, "mol");
+
+    EquilibriumSolver solver(system);
+    solver.solve(state);
+
+    return state;
+}
+
+/// Record 10000 rows of chemical properties with a ChemicalOutput object writing to a file with given format.
+auto benchmarkChemicalOutput(Benchmark& bench, ChemicalOutputFormat format) -> void
+{
+    const auto system = createSystem();
+    const auto state = createState(system, 60.0, 1.0);
+
+    ChemicalProps props(system);
+    props.update(state);
+
+    const auto numrows = 10000;
+
+    ChemicalOutputOptions options;
+    options.filename = "reaktoro-benchmark-chemical-output";
+    options.format = format;
+    options.blocksize = 1000;
+
+    bench.setItemsPerCall(numrows);
+    bench.run([&] {
+        ChemicalOutput output(options);
+        output.add("T", [](ChemicalProps const& props) { return props.temperature(); });
+        output.add("P", [](ChemicalProps const& props) { return props.pressure(); });
+        for(auto const& name : {"H2O", "Na+", "Cl-", "HCO3-", "Ca+2", "Mg+2"})
+            output.add(String("n[") + name + "]", [=](ChemicalProps const& props) { return props.speciesAmount(name); });
+        output.add("pH", [](ChemicalProps const& props) { return AqueousProps::compute(props).pH(); });
+        for(auto i = 0; i < numrows; ++i)
+            output.update(props);
+        output.close();
+    });
+
+    std::remove(options.filename.c_str());
+}
+
+} // namespace
+
+REAKTORO_BENCHMARK("ChemicalProps/update")
+{
+    const auto system = createSystem();
+    const auto state = createState(system, 60.0, 1.0);
+
+    ChemicalProps props(system);
+
+    bench.run([&] { props.update(state); doNotOptimize(props); });
+}
+
+REAKTORO_BENCHMARK("ChemicalProps/update/varying-temperature")
+{
+    const auto system = createSystem();
+    const auto state = createState(system, 60.0, 1.0);
+
+    ChemicalProps props(system);
+
+    const auto T0 = state.temperature();
+    const auto P = state.pressure();
+    const auto n = state.speciesAmounts();
+
+    // Alternate temperatures so that standard thermodynamic properties are recomputed on every call
+    Index i = 0;
+    bench.run([&] { props.update(T0 + double(++i % 2), P, n); doNotOptimize(props); });
+}
+
+REAKTORO_BENCHMARK("ChemicalProps/update/varying-temperature/no-standard-thermo-cache")
+{
+    const auto system = createSystem();
+    const auto state = createState(system, 60.0, 1.0);
+
+    system.standardThermoPropsCache().disable();
+
+    ChemicalProps props(system);
+
+    const auto T0 = state.temperature();
+    const auto P = state.pressure();
+    const auto n = state.speciesAmounts();
+
+    Index i = 0;
+    bench.run([&] { props.update(T0 + double(++i % 2), P, n); doNotOptimize(props); });
+}
+
+REAKTORO_BENCHMARK("ChemicalProps/updateIdeal")
+{
+    const auto system = createSystem();
+    const auto state = createState(system, 60.0, 1.0);
+
+    ChemicalProps props(system);
+
+    bench.run([&] { props.updateIdeal(state); doNotOptimize(props); });
+}
+
+REAKTORO_BENCHMARK("ChemicalPropsBatch/update/1000-cells")
+{
+    const auto system = createSystem();
+
+    const auto numcells = 1000;
+
+    // Cells share a few temperatures so that standard thermodynamic properties are evaluated once per distinct (T, P) pair
+    Vec<ChemicalState> states;
+    for(auto i = 0; i < 10; ++i)
+        states.push_back(createState(system, 25.0 + 10.0 * i, 0.1 + 0.2 * i));
+    for(auto i = 10; i < numcells; ++i)
+        states.push_back(states[i % 10]);
+
+    ChemicalPropsBatch batch(system);
+
+    bench.setItemsPerCall(numcells);
+    bench.run([&] { batch.update(states); doNotOptimize(batch); });
+}
+
+REAKTORO_BENCHMARK("ChemicalProps/update/1000-cells")
+{
+    const auto system = createSystem();
+
+    const auto numcells = 1000;
+
+    Vec<ChemicalState> states;
+    for(auto i = 0; i < 10; ++i)
+        states.push_back(createState(system, 25.0 + 10.0 * i, 0.1 + 0.2 * i));
+    for(auto i = 10; i < numcells; ++i)
+        states.push_back(states[i % 10]);
+
+    ChemicalProps props(system);
+
+    bench.setItemsPerCall(numcells);
+    bench.run([&] { for(auto const& state : states) props.update(state); doNotOptimize(props); });
+}
+
+REAKTORO_BENCHMARK("ChemicalOutput/update/10000-rows/csv")
+{
+    benchmarkChemicalOutput(bench, ChemicalOutputFormat::Csv);
+}
+
+REAKTORO_BENCHMARK("ChemicalOutput/update/10000-rows/binary")
+{
+    benchmarkChemicalOutput(bench, ChemicalOutputFormat::Binary);
+}
@@ -0,0 +1,75 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+namespace {
+
+/// Time the construction of a chemical system with many species from a large database.
+auto benchmarkChemicalSystemConstruction(Benchmark& bench, Database const& db) -> void
+{
+    bench.run([&] {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O C Na Cl Ca Mg K Fe Si Al S N")) );
+        phases.add( GaseousPhase(speciate("H O C S N")) );
+        phases.add( MineralPhases(speciate("H O C Na Cl Ca Mg K Fe Si Al S")) );
+        ChemicalSystem system(phases);
+        doNotOptimize(system);
+    });
+}
+
+/// Time the lookup of every species in a large database by name and by formula.
+auto benchmarkSpeciesLookup(Benchmark& bench, Database const& db) -> void
+{
+    SpeciesList const& species = db.species();
+
+    bench.setItemsPerCall(2 * species.size());
+    bench.run([&] {
+        Index sum = 0;
+        for(auto const& s : species)
+            sum += species.findWithName(s.name()) + species.findWithFormula(s.formula());
+        doNotOptimize(sum);
+    });
+}
+
+} // namespace
+
+REAKTORO_BENCHMARK("ChemicalSystem/construct/supcrtbl")
+{
+    benchmarkChemicalSystemConstruction(bench, SupcrtDatabase("supcrtbl"));
+}
+
+REAKTORO_BENCHMARK("ChemicalSystem/construct/slop98-thermofun")
+{
+    benchmarkChemicalSystemConstruction(bench, ThermoFunDatabase("slop98"));
+}
+
+REAKTORO_BENCHMARK("SpeciesList/lookup/supcrtbl")
+{
+    benchmarkSpeciesLookup(bench, SupcrtDatabase("supcrtbl"));
+}
+
+REAKTORO_BENCHMARK("SpeciesList/lookup/slop98-thermofun")
+{
+    benchmarkSpeciesLookup(bench, ThermoFunDatabase("slop98"));
+}
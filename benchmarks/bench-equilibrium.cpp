@@ -0,0 +1,375 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Extensions/DEW/DEWDatabase.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+namespace {
+
+/// Return a chemical system with aqueous, gaseous and mineral phases from phreeqc.dat.
+auto createSystem() -> ChemicalSystem
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O C Na Cl Ca Mg")) );
+    phases.add( GaseousPhase("H2O(g) CO2(g)") );
+    phases.add( MineralPhases("Calcite Dolomite Halite") );
+
+    return ChemicalSystem(phases);
+}
+
+/// Return an initial chemical state, not in equilibrium, with given amount of NaCl (in mol).
+auto createState(ChemicalSystem const& system, double nNaCl) -> ChemicalState
+{
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(10.0, "bar");
+    state.set("H2O", 1.0, "kg");
+    state.set("Na+", nNaCl, "mol");
+    state.set("Cl-", nNaCl, "mol");
+    state.set("CO2(g)", 0.5, "mol");
+    state.set("Calcite", 1.0, "mol");
+    state.set("Dolomite", 0.5, "mol");
+    return state;
+}
+
+/// Return a SmartEquilibriumSolver that has learned given number of records (one per amount of NaCl).
+auto createSmartSolver(ChemicalSystem const& system, Index numrecords) -> SmartEquilibriumSolver
+{
+    SmartEquilibriumSolver solver(system);
+
+    // Zero tolerances reject every prediction, so that each solve below stores a new record
+    SmartEquilibriumOptions options;
+    options.reltol = 0.0;
+    options.abstol = 0.0;
+    solver.setOptions(options);
+
+    for(Index i = 0; i < numrecords; ++i)
+    {
+        auto state = createState(system, 0.01 + 2.0 * i / numrecords);
+        solver.solve(state);
+    }
+
+    solver.setOptions(SmartEquilibriumOptions());
+
+    return solver;
+}
+
+/// Time the prediction of a SmartEquilibriumSolver with given number of learned records.
+auto benchmarkSmartPrediction(Benchmark& bench, Index numrecords) -> void
+{
+    const auto system = createSystem();
+
+    auto solver = createSmartSolver(system, numrecords);
+
+    // The query state is a tiny perturbation of a learned input state, so that its prediction is accepted
+    const auto state0 = createState(system, 0.01 + 2.0 * (numrecords / 2) / numrecords + 1.0e-8);
+
+    ChemicalState state(state0);
+    bench.run([&] { state = state0; const auto res = solver.solve(state); doNotOptimize(res); });
+}
+
+} // namespace
+
+//======================================================================
+// EquilibriumSolver
+//======================================================================
+
+REAKTORO_BENCHMARK("EquilibriumSolver/construct+solve")
+{
+    const auto system = createSystem();
+    const auto state0 = createState(system, 1.0);
+
+    ChemicalState state(state0);
+    bench.run([&] {
+        state = state0;
+        EquilibriumSolver solver(system);
+        const auto res = solver.solve(state);
+        doNotOptimize(res);
+    });
+}
+
+REAKTORO_BENCHMARK("EquilibriumSolver/solve/cold")
+{
+    const auto system = createSystem();
+    const auto state0 = createState(system, 1.0);
+
+    EquilibriumSolver solver(system);
+
+    // Every call starts from the same initial state, far from equilibrium
+    ChemicalState state(state0);
+    bench.run([&] { state = state0; const auto res = solver.solve(state); doNotOptimize(res); });
+}
+
+REAKTORO_BENCHMARK("EquilibriumSolver/solve/warm")
+{
+    const auto system = createSystem();
+
+    EquilibriumSolver solver(system);
+
+    auto state0 = createState(system, 1.0);
+    solver.solve(state0);
+
+    // Every call starts from an equilibrium state at slightly different conditions, as in a sequence of time steps
+    ChemicalState state(state0);
+    Index i = 0;
+    bench.run([&] {
+        state = state0;
+        state.temperature(state0.temperature() + 0.01 * double(++i % 2));
+        const auto res = solver.solve(state);
+        doNotOptimize(res);
+    });
+}
+
+REAKTORO_BENCHMARK("EquilibriumSolver/solve/amounts-only")
+{
+    const auto system = createSystem();
+
+    EquilibriumSolver solver(system);
+
+    auto state0 = createState(system, 1.0);
+    solver.solve(state0);
+    state0.equilibrium().reset();
+
+    // Every call starts from the species amounts of an equilibrium state alone, as when these are updated by transport
+    ChemicalState state(state0);
+    Index i = 0;
+    bench.run([&] {
+        state = state0;
+        state.temperature(state0.temperature() + 0.01 * double(++i % 2));
+        const auto res = solver.solve(state);
+        doNotOptimize(res);
+    });
+}
+
+REAKTORO_BENCHMARK("EquilibriumSolver/solve/amounts-only/hot-start")
+{
+    const auto system = createSystem();
+
+    EquilibriumSolver solver(system);
+    EquilibriumHotStart hotstart;
+
+    auto state0 = createState(system, 1.0);
+    solver.solve(state0, hotstart);
+    state0.equilibrium().reset();
+
+    // As above, but the multipliers and basic variables of the previous calculation are kept in a hot-start state
+    ChemicalState state(state0);
+    Index i = 0;
+    bench.run([&] {
+        state = state0;
+        state.temperature(state0.temperature() + 0.01 * double(++i % 2));
+        const auto res = solver.solve(state, hotstart);
+        doNotOptimize(res);
+    });
+}
+
+REAKTORO_BENCHMARK("EquilibriumSolver/solve/warm/exact-hessian")
+{
+    const auto system = createSystem();
+
+    EquilibriumOptions options;
+    options.hessian = GibbsHessian::Exact;
+
+    EquilibriumSolver solver(system);
+    solver.setOptions(options);
+
+    auto state0 = createState(system, 1.0);
+    solver.solve(state0);
+
+    ChemicalState state(state0);
+    Index i = 0;
+    bench.run([&] {
+        state = state0;
+        state.temperature(state0.temperature() + 0.01 * double(++i % 2));
+        const auto res = solver.solve(state);
+        doNotOptimize(res);
+    });
+}
+
+REAKTORO_BENCHMARK("EquilibriumSolver/solve/warm/exact-hessian/compressed-seeding")
+{
+    const auto system = createSystem();
+
+    EquilibriumOptions options;
+    options.hessian = GibbsHessian::Exact;
+    options.use_compressed_hessian_seeding = true;
+
+    EquilibriumSolver solver(system);
+    solver.setOptions(options);
+
+    auto state0 = createState(system, 1.0);
+    solver.solve(state0);
+
+    ChemicalState state(state0);
+    Index i = 0;
+    bench.run([&] {
+        state = state0;
+        state.temperature(state0.temperature() + 0.01 * double(++i % 2));
+        const auto res = solver.solve(state);
+        doNotOptimize(res);
+    });
+}
+
+//======================================================================
+// SmartEquilibriumSolver
+//======================================================================
+
+REAKTORO_BENCHMARK("SmartEquilibriumSolver/learn")
+{
+    const auto system = createSystem();
+
+    SmartEquilibriumSolver solver(system);
+
+    // Zero tolerances reject every prediction so that each call learns, and the record limit keeps the search cost bounded
+    SmartEquilibriumOptions options;
+    options.reltol = 0.0;
+    options.abstol = 0.0;
+    options.max_records = 64;
+    solver.setOptions(options);
+
+    const auto state0 = createState(system, 1.0);
+
+    ChemicalState state(state0);
+    Index i = 0;
+    bench.run([&] {
+        state = state0;
+        state.set("Na+", 1.0 + 1.0e-3 * double(++i % 1000), "mol");
+        const auto res = solver.solve(state);
+        doNotOptimize(res);
+    });
+}
+
+REAKTORO_BENCHMARK("SmartEquilibriumSolver/predict/64-records")
+{
+    benchmarkSmartPrediction(bench, 64);
+}
+
+REAKTORO_BENCHMARK("SmartEquilibriumSolver/predict/256-records")
+{
+    benchmarkSmartPrediction(bench, 256);
+}
+
+REAKTORO_BENCHMARK("SmartEquilibriumSolver/predict/1024-records")
+{
+    benchmarkSmartPrediction(bench, 1024);
+}
+
+REAKTORO_BENCHMARK("SmartEquilibriumSolver/save/256-records")
+{
+    const auto system = createSystem();
+
+    const auto solver = createSmartSolver(system, 256);
+
+    const auto path = "reaktoro-benchmark-smart-equilibrium.bin";
+
+    bench.setItemsPerCall(256);
+    bench.run([&] { solver.save(path); });
+
+    std::remove(path);
+}
+
+REAKTORO_BENCHMARK("SmartEquilibriumSolver/load/256-records")
+{
+    const auto system = createSystem();
+
+    const auto path = "reaktoro-benchmark-smart-equilibrium.bin";
+
+    createSmartSolver(system, 256).save(path);
+
+    // Records are added to those already learned, so each call loads into a new solver
+    bench.setItemsPerCall(256);
+    bench.run([&] {
+        SmartEquilibriumSolver solver(system);
+        solver.load(path);
+        doNotOptimize(solver);
+    });
+
+    std::remove(path);
+}
+
+//======================================================================
+// Database loading
+//======================================================================
+
+REAKTORO_BENCHMARK("Database/PhreeqcDatabase/phreeqc.dat")
+{
+    bench.run([&] { PhreeqcDatabase db("phreeqc.dat"); doNotOptimize(db); });
+}
+
+REAKTORO_BENCHMARK("Database/SupcrtDatabase/supcrt98")
+{
+    bench.run([&] { SupcrtDatabase db("supcrt98"); doNotOptimize(db); });
+}
+
+REAKTORO_BENCHMARK("Database/SupcrtDatabase/supcrtbl")
+{
+    bench.run([&] { SupcrtDatabase db("supcrtbl"); doNotOptimize(db); });
+}
+
+REAKTORO_BENCHMARK("Database/ThermoFunDatabase/aq17")
+{
+    bench.run([&] { ThermoFunDatabase db("aq17"); doNotOptimize(db); });
+}
+
+REAKTORO_BENCHMARK("Database/DEWDatabase/dew2024-aqueous")
+{
+    bench.run([&] { DEWDatabase db("dew2024-aqueous"); doNotOptimize(db); });
+}
+
+REAKTORO_BENCHMARK("Database/fromFile/supcrtbl.json")
+{
+    const auto path = "reaktoro-benchmark-database.json";
+
+    Data(Database(SupcrtDatabase("supcrtbl"))).saveJson(path);
+
+    bench.run([&] { auto db = Database::fromFile(path); doNotOptimize(db); });
+
+    std::remove(path);
+}
+
+REAKTORO_BENCHMARK("Database/fromFile/supcrtbl.yaml")
+{
+    const auto path = "reaktoro-benchmark-database.yaml";
+
+    Data(Database(SupcrtDatabase("supcrtbl"))).saveYaml(path);
+
+    bench.run([&] { auto db = Database::fromFile(path); doNotOptimize(db); });
+
+    std::remove(path);
+}
+
+REAKTORO_BENCHMARK("Database/fromBinaryFile/supcrtbl")
+{
+    const auto path = "reaktoro-benchmark-database.rktdb";
+
+    SupcrtDatabase("supcrtbl").saveBinary(path);
+
+    bench.run([&] { auto db = Database::fromBinaryFile(path); doNotOptimize(db); });
+
+    std::remove(path);
+}
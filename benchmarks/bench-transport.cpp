@@ -0,0 +1,102 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+namespace {
+
+/// The number of cells in the mesh of the reactive transport benchmarks.
+const auto numcells = 100;
+
+/// Time a step of a reactive transport simulation of acidic brine injection into a calcite and dolomite column.
+auto benchmarkReactiveTransportStep(Benchmark& bench, ReactiveTransportOptions const& options) -> void
+{
+    PhreeqcDatabase db("phreeqc.dat");
+
+    Phases phases(db);
+    phases.add( AqueousPhase(speciate("H O C Na Cl Ca Mg")) );
+    phases.add( MineralPhases("Calcite Dolomite") );
+
+    ChemicalSystem system(phases);
+
+    EquilibriumSolver solver(system);
+
+    ChemicalState initial(system);
+    initial.temperature(60.0, "celsius");
+    initial.pressure(100.0, "bar");
+    initial.set("H2O", 1.0, "kg");
+    initial.set("Na+", 0.7, "mol");
+    initial.set("Cl-", 0.7, "mol");
+    initial.set("Calcite", 10.0, "mol");
+    initial.set("Dolomite", 5.0, "mol");
+    solver.solve(initial);
+
+    ChemicalState boundary(system);
+    boundary.temperature(60.0, "celsius");
+    boundary.pressure(100.0, "bar");
+    boundary.set("H2O", 1.0, "kg");
+    boundary.set("Na+", 0.9, "mol");
+    boundary.set("Cl-", 1.0, "mol");
+    boundary.set("H+", 0.1, "mol");
+    boundary.set("CO2", 0.75, "mol");
+    solver.solve(boundary);
+
+    ReactiveTransportSolver rtsolver(system);
+    rtsolver.setOptions(options);
+    rtsolver.setMesh(Mesh(numcells, 0.0, 1.0));
+    rtsolver.setVelocity(1.0e-5);
+    rtsolver.setDiffusionCoeff(1.0e-9);
+    rtsolver.setTimeStep(500.0);
+    rtsolver.setBoundaryState(boundary);
+    rtsolver.initialize();
+
+    ChemicalField field(numcells, initial);
+
+    // The reported throughput is the number of cells advanced per second (cells·steps/s)
+    bench.setItemsPerCall(numcells);
+    bench.run([&] { const auto res = rtsolver.step(field); doNotOptimize(res); });
+}
+
+} // namespace
+
+REAKTORO_BENCHMARK("ReactiveTransportSolver/step/1-thread")
+{
+    ReactiveTransportOptions options;
+    options.threads = 1;
+    benchmarkReactiveTransportStep(bench, options);
+}
+
+REAKTORO_BENCHMARK("ReactiveTransportSolver/step/all-threads")
+{
+    ReactiveTransportOptions options;
+    options.threads = 0; // the number of hardware threads
+    benchmarkReactiveTransportStep(bench, options);
+}
+
+REAKTORO_BENCHMARK("ReactiveTransportSolver/step/smart-equilibrium/all-threads")
+{
+    ReactiveTransportOptions options;
+    options.threads = 0; // the number of hardware threads
+    options.use_smart_equilibrium = true;
+    benchmarkReactiveTransportStep(bench, options);
+}
@@ -0,0 +1,161 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Extensions/DEW/WaterEosZhangDuan2005.hpp>
+#include <Reaktoro/Extensions/DEW/WaterGibbsModel.hpp>
+#include <Reaktoro/Extensions/DEW/WaterInterpolationDEW.hpp>
+#include <Reaktoro/Extensions/DEW/WaterStateCache.hpp>
+
+// Local includes
+#include "Benchmark.hpp"
+using namespace Reaktoro;
+using namespace Reaktoro::benchmarks;
+
+namespace {
+
+/// The temperature (in K) and pressure (in Pa) used to benchmark the conventional water models.
+const auto T = 333.15;
+const auto P = 100.0e5;
+
+/// The temperature (in K) and pressure (in Pa) used to benchmark the DEW water models.
+const auto Tdew = 873.15;
+const auto Pdew = 10.0e8;
+
+/// Time a water model evaluated at alternating temperatures, so that memoized results are never reused.
+template<typename WaterModel>
+auto benchmarkWaterModel(Benchmark& bench, WaterModel const& model, double T, double P) -> void
+{
+    Index i = 0;
+    bench.run([&] { const auto res = model(T + double(++i % 2), P); doNotOptimize(res); });
+}
+
+} // namespace
+
+//======================================================================
+// Water thermodynamic models
+//======================================================================
+
+REAKTORO_BENCHMARK("WaterModel/HGK")
+{
+    benchmarkWaterModel(bench, [](real T, real P) { return waterThermoPropsHGK(T, P, StateOfMatter::Liquid); }, T, P);
+}
+
+REAKTORO_BENCHMARK("WaterModel/WagnerPruss")
+{
+    benchmarkWaterModel(bench, [](real T, real P) { return waterThermoPropsWagnerPruss(T, P, StateOfMatter::Liquid); }, T, P);
+}
+
+REAKTORO_BENCHMARK("WaterModel/WagnerPrussInterp")
+{
+    benchmarkWaterModel(bench, [](real T, real P) { return waterThermoPropsWagnerPrussInterp(T, P, StateOfMatter::Liquid); }, T, P);
+}
+
+REAKTORO_BENCHMARK("WaterModel/WagnerPrussMemoized/hit")
+{
+    bench.run([&] { const auto res = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid); doNotOptimize(res); });
+}
+
+REAKTORO_BENCHMARK("WaterModel/ZhangDuan2005")
+{
+    benchmarkWaterModel(bench, [](real T, real P) { return waterThermoPropsZhangDuan2005(T, P); }, Tdew, Pdew);
+}
+
+//======================================================================
+// DEW water Gibbs energy models
+//======================================================================
+
+REAKTORO_BENCHMARK("WaterGibbsModel/DelaneyHelgeson1978")
+{
+    WaterGibbsModelOptions options;
+    options.model = WaterGibbsModel::DelaneyHelgeson1978;
+    benchmarkWaterModel(bench, [&](real T, real P) { return waterGibbsModel(T, P, options); }, Tdew, Pdew);
+}
+
+REAKTORO_BENCHMARK("WaterGibbsModel/DewIntegral/Trapezoidal")
+{
+    WaterGibbsModelOptions options;
+    options.model = WaterGibbsModel::DewIntegral;
+    options.integrationMethod = WaterIntegrationMethod::Trapezoidal;
+    benchmarkWaterModel(bench, [&](real T, real P) { return waterGibbsModel(T, P, options); }, Tdew, Pdew);
+}
+
+REAKTORO_BENCHMARK("WaterGibbsModel/DewIntegral/GaussLegendre16")
+{
+    WaterGibbsModelOptions options;
+    options.model = WaterGibbsModel::DewIntegral;
+    options.integrationMethod = WaterIntegrationMethod::GaussLegendre16;
+    options.integrationSteps = 16;
+    benchmarkWaterModel(bench, [&](real T, real P) { return waterGibbsModel(T, P, options); }, Tdew, Pdew);
+}
+
+REAKTORO_BENCHMARK("WaterGibbsModel/DewIntegral/AdaptiveGaussKronrod")
+{
+    WaterGibbsModelOptions options;
+    options.model = WaterGibbsModel::DewIntegral;
+    options.integrationMethod = WaterIntegrationMethod::AdaptiveGaussKronrod;
+    benchmarkWaterModel(bench, [&](real T, real P) { return waterGibbsModel(T, P, options); }, Tdew, Pdew);
+}
+
+REAKTORO_BENCHMARK("WaterGibbsModel/DewIntegral/Incremental/pressure-sweep")
+{
+    WaterGibbsModelOptions options;
+    options.model = WaterGibbsModel::DewIntegral;
+    options.integrationMethod = WaterIntegrationMethod::AdaptiveGaussKronrod;
+    options.useIncrementalIntegration = true;
+
+    clearWaterGibbsIntegralCache();
+
+    // Each call sweeps 100 pressures along an isotherm, as in a geotherm calculation
+    bench.setItemsPerCall(100);
+    bench.run([&] {
+        for(auto i = 1; i <= 100; ++i)
+        {
+            const auto res = waterGibbsModel(Tdew, Pdew * i / 100.0, options);
+            doNotOptimize(res);
+        }
+    });
+
+    clearWaterGibbsIntegralCache();
+}
+
+//======================================================================
+// DEW water states (thermodynamic, electrostatic and Gibbs properties)
+//======================================================================
+
+REAKTORO_BENCHMARK("WaterStateDEW")
+{
+    WaterModelOptions options;
+    benchmarkWaterModel(bench, [&](real T, real P) { return waterStateDEW(T, P, options); }, Tdew, Pdew);
+}
+
+REAKTORO_BENCHMARK("WaterStateDEW/Interpolation")
+{
+    WaterModelOptions options;
+    options.useInterpolation = true;
+    benchmarkWaterModel(bench, [&](real T, real P) { return waterStateDEW(T, P, options); }, Tdew, Pdew);
+}
+
+REAKTORO_BENCHMARK("WaterStateCache/hit")
+{
+    WaterModelOptions options;
+    WaterStateCache::enable();
+    WaterStateCache::clear();
+    bench.run([&] { const auto res = WaterStateCache::state(Tdew, Pdew, options); doNotOptimize(res); });
+    WaterStateCache::clear();
+}
@@ -0,0 +1,80 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright © 2014-2024 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+# ---------------------------------------------------------------------------------------------------------------------------
+# Compare the results of two runs of reaktoro-benchmarks and report the benchmarks that became slower. Execute this script using:
+#
+# python /path/to/benchmarks/compare.py baseline.json contender.json [--threshold 0.10]
+#
+# The script exits with a nonzero status if the median time of any benchmark increased by more than the given threshold
+# (relative to the baseline), so that it can be used to guard against performance regressions.
+# ---------------------------------------------------------------------------------------------------------------------------
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as file:
+        data = json.load(file)
+    return {b["name"]: b for b in data["benchmarks"]}, data.get("context", {})
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two JSON files produced by reaktoro-benchmarks.")
+    parser.add_argument("baseline", help="the JSON file with the baseline results")
+    parser.add_argument("contender", help="the JSON file with the results to be compared with the baseline")
+    parser.add_argument("--threshold", type=float, default=0.10, help="the relative increase of median time considered a regression (default: 0.10)")
+    args = parser.parse_args()
+
+    baseline, context0 = load(args.baseline)
+    contender, context1 = load(args.contender)
+
+    if context0.get("build_type") != context1.get("build_type"):
+        print(f"Warning: comparing results of different build types ({context0.get('build_type')} and {context1.get('build_type')}).")
+
+    regressions = []
+
+    print(f"{'Benchmark':<60}{'Baseline':>14}{'Contender':>14}{'Change':>10}{'Allocs':>16}")
+
+    for name, b1 in contender.items():
+        b0 = baseline.get(name)
+        if b0 is None:
+            print(f"{name:<60}{'-':>14}{b1['median']:>14.1f}{'new':>10}")
+            continue
+        change = b1["median"] / b0["median"] - 1.0 if b0["median"] > 0.0 else 0.0
+        allocs = f"{b0['allocations_per_call']:.1f} -> {b1['allocations_per_call']:.1f}"
+        flag = "  <-- slower" if change > args.threshold else ""
+        print(f"{name:<60}{b0['median']:>14.1f}{b1['median']:>14.1f}{change:>+10.1%}{allocs:>16}{flag}")
+        if change > args.threshold:
+            regressions.append(name)
+
+    for name in baseline.keys() - contender.keys():
+        print(f"{name:<60}{baseline[name]['median']:>14.1f}{'-':>14}{'removed':>10}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than the baseline by more than {args.threshold:.0%}:")
+        for name in regressions:
+            print(f"  {name}")
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
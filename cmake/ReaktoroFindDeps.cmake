@@ -43,6 +43,9 @@ ReaktoroFindPackage(ThermoFun 0.4.5 REQUIRED)
 ReaktoroFindPackage(tsl-ordered-map 1.0.0 REQUIRED)
 ReaktoroFindPackage(yaml-cpp 0.6.3 REQUIRED)
 
+# Find the system threads library (needed for the thread pool used in batch and parallel calculations)
+find_package(Threads REQUIRED)
+
 # Enable RUNPATH for executables and shared libraries on Linux for flexible library search paths
 if(DEFINED REAKTORO_USE_RPATH)
     SET(CMAKE_EXE_LINKER_FLAGS "-Wl,--enable-new-dtags")